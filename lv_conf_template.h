@@ -144,6 +144,24 @@
 /** The target buffer size for simple layer chunks. */
 #define LV_DRAW_LAYER_SIMPLE_BUF_SIZE    (24 * 1024)    /**< [bytes]*/
 
+/** 1: Drop or clip the draw tasks which are covered by a later opaque fill, image or layer
+ * in the same layer. Only the draw tasks not taken by a draw unit yet can be culled.
+ * See `lv_draw_occlusion_monitor()` for statistics. */
+#define LV_DRAW_OCCLUSION_CULLING 0
+
+/** If > 0 and the display uses more draw units (see `lv_display_set_tile_cnt()`) the refreshed
+ * areas are split into a grid of tiles of about this size so that each fits the data cache.
+ * The draw tasks are collected once and replayed on each tile, so the draw units can render
+ * the tiles in parallel. 0: split the areas into full width horizontal stripes instead. */
+#define LV_DRAW_TILE_SIZE 0         /**< [bytes]*/
+
+/** 1: Allow rendering displays on their own thread with `lv_display_set_render_thread()`.
+ * The widgets are drawn on the thread of `lv_timer_handler()` to record the draw tasks and
+ * the recorded draw tasks are rendered and flushed on the display's thread,
+ * so independent displays can be rendered in parallel. `flush_cb` is called from the display's thread too.
+ * Requires `LV_USE_OS` and can't be used with the SDL and OpenGL ES draw units. */
+#define LV_USE_DISPLAY_RENDER_THREAD 0
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -411,6 +429,11 @@
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Allow decoding image files on a background thread if they are not in the image cache yet.
+ *  Until an image is decoded a placeholder is drawn and the widget is redrawn when the image is ready.
+ *  Enable it with `lv_image_decoder_set_async(true)`. Requires `LV_USE_OS` and `LV_CACHE_DEF_SIZE > 0`. */
+#define LV_USE_IMAGE_DECODER_ASYNC  0
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
@@ -426,6 +449,39 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Keep the list of widgets using each style. `lv_obj_report_style_change(style)` then refreshes
+ *  only these widgets instead of walking all widgets, and only as much as the changed
+ *  properties require (e.g. color changes don't update the layout). */
+#define LV_OBJ_STYLE_USER_INDEX 0
+
+/** Allow recording the draw tasks of widgets having `LV_OBJ_FLAG_CACHE_DRAW_LIST` once
+ *  and replaying them on the next refreshes instead of sending the draw events again. */
+#define LV_OBJ_DRAW_LIST_CACHE  0
+
+/** Memory in bytes to keep the rendered layers of widgets with `lv_obj_set_layer_cache(obj, true)`
+ *  between refreshes. While only their transformation or opacity changes, the cached layer is
+ *  blended again instead of rendering the widget and its children. 0: disable the layer cache */
+#define LV_OBJ_LAYER_CACHE_SIZE 0
+
+/** Allocate the widgets and their `spec_attr` from slabs holding this many items each,
+ *  with one slab allocator per widget class. It reduces the heap fragmentation when screens
+ *  are created and deleted often. 0: allocate them from the heap one by one */
+#define LV_OBJ_SLAB_ITEM_CNT    0
+
+/** Number of calls `lv_async_call()` can queue. The calls can be made from any thread or
+ *  interrupt without the LVGL lock and are run by `lv_timer_handler()`.
+ *  0: create a one-shot timer for every call, which requires the LVGL lock */
+#define LV_ASYNC_QUEUE_SIZE     0
+#if LV_ASYNC_QUEUE_SIZE
+    /** Maximum number of calls to run in one `lv_timer_handler()`, the others run in the next ones.
+     *  0: run all the calls queued before `lv_timer_handler()` was started */
+    #define LV_ASYNC_QUEUE_BUDGET   0
+
+    /** 1: If the queue is full create a one-shot timer for the call. It's safe only in the LVGL thread.
+     *  0: Drop the call and return `LV_RESULT_INVALID` */
+    #define LV_ASYNC_QUEUE_OVERFLOW_TIMER   0
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -793,6 +849,13 @@
     #define LV_FS_POSIX_CACHE_SIZE 0    /**< >0 to cache this number of bytes in lv_fs_read() */
 #endif
 
+/** API for open and mmap. Read-only access to memory-mapped files, images can be drawn from the mapping directly. */
+#define LV_USE_FS_MMAP 0
+#if LV_USE_FS_MMAP
+    #define LV_FS_MMAP_LETTER '\0'      /**< Set an upper cased letter on which the drive will accessible (e.g. 'A') */
+    #define LV_FS_MMAP_PATH ""          /**< Set the working directory. File/directory paths will be appended to it. */
+#endif
+
 /** API for CreateFile, ReadFile, etc. */
 #define LV_USE_FS_WIN32 0
 #if LV_USE_FS_WIN32
@@ -860,6 +923,14 @@
 /** Decode bin images to RAM */
 #define LV_BIN_DECODER_RAM_LOAD 0
 
+/** Max. number of bytes to read at once when drawing a bin image file which is not loaded to RAM.
+ *  The drawn area is read in bands of lines with one read per band. 0: read one line at a time */
+#define LV_BIN_DECODER_BAND_SIZE 0
+
+/** Number of tiles of tiled bin image files (`LV_IMAGE_FLAGS_TILED`) to keep in RAM.
+ *  0: read the tiles every time they are drawn */
+#define LV_BIN_DECODER_TILE_CACHE_CNT 0
+
 /** RLE decompress library */
 #define LV_USE_RLE 0
 
@@ -1023,6 +1094,12 @@
 
 /** 1: Enable an observer pattern implementation */
 #define LV_USE_OBSERVER 1
+#if LV_USE_OBSERVER
+    /** Number of values other threads can post to subjects with `lv_subject_post_int()` and friends
+     *  without taking the LVGL lock. They are applied by `lv_timer_handler()`.
+     *  0: disable posting */
+    #define LV_OBSERVER_POST_QUEUE_SIZE 0
+#endif
 
 /** 1: Enable Pinyin input method
  *  - Requires: lv_keyboard */
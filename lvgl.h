@@ -35,6 +35,8 @@ extern "C" {
 #include "src/misc/lv_utils.h"
 #include "src/misc/lv_iter.h"
 #include "src/misc/lv_circle_buf.h"
+#include "src/misc/lv_slab.h"
+#include "src/misc/lv_mpsc_queue.h"
 #include "src/misc/lv_tree.h"
   
 #include "src/tick/lv_tick.h"
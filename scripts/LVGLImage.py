@@ -741,17 +741,23 @@ class LVGLImage:
 
     def to_bin(self,
                filename: str,
-               compress: CompressMethod = CompressMethod.NONE):
+               compress: CompressMethod = CompressMethod.NONE,
+               tile: tuple = None):
         """
         Write this image to file, filename should be ended with '.bin'
+        If tile is set to (tile_w, tile_h) the data is stored in tiles
         """
         self._check_ext(filename, ".bin")
         self._check_dir(filename)
 
+        if tile and compress != CompressMethod.NONE:
+            raise ParameterError("Tiled image can't be compressed")
+
         with open(filename, "wb+") as f:
             bin = bytearray()
             flags = 0
             flags |= 0x08 if compress != CompressMethod.NONE else 0
+            flags |= 0x04 if tile else 0
             flags |= 0x01 if self.premultiplied else 0
 
             header = LVGLImageHeader(self.cf,
@@ -760,13 +766,47 @@ class LVGLImage:
                                      self.stride,
                                      flags=flags)
             bin += header.binary
-            compressed = LVGLCompressData(self.cf, compress, self.data)
-            bin += compressed.compressed
+            if tile:
+                bin += self._tiled_data(*tile)
+            else:
+                compressed = LVGLCompressData(self.cf, compress, self.data)
+                bin += compressed.compressed
 
             f.write(bin)
 
         return self
 
+    def _tiled_data(self, tile_w: int, tile_h: int) -> bytearray:
+        """
+        Tile size followed by the tiles row by row. Every tile has
+        tile_w * tile_h pixels, the tiles on the edges are padded with 0.
+        """
+        if self.cf not in (ColorFormat.ARGB8888, ColorFormat.XRGB8888,
+                           ColorFormat.RGB888, ColorFormat.RGB565,
+                           ColorFormat.ARGB8565):
+            raise ParameterError(f"Tiled {self.cf.name} is not supported")
+
+        if tile_w <= 0 or tile_h <= 0 or tile_w > 0xffff or tile_h > 0xffff:
+            raise ParameterError(f"Invalid tile size: {tile_w}x{tile_h}")
+
+        px_size = self.cf.bpp // 8
+        tile_stride = tile_w * px_size
+
+        data = bytearray()
+        data += uint16_t(tile_w)
+        data += uint16_t(tile_h)
+        for tile_y in range(0, self.h, tile_h):
+            for tile_x in range(0, self.w, tile_w):
+                w = min(tile_w, self.w - tile_x)
+                for y in range(tile_y, tile_y + tile_h):
+                    line = bytearray(tile_stride)
+                    if y < self.h:
+                        offset = y * self.stride + tile_x * px_size
+                        line[:w * px_size] = self.data[offset:offset +
+                                                       w * px_size]
+                    data += line
+        return data
+
     def to_c_array(self,
                    filename: str,
                    compress: CompressMethod = CompressMethod.NONE):
@@ -1200,7 +1240,8 @@ class PNGConverter:
                  align: int = 1,
                  premultiply: bool = False,
                  compress: CompressMethod = CompressMethod.NONE,
-                 keep_folder=True) -> None:
+                 keep_folder=True,
+                 tile: tuple = None) -> None:
         self.files = files
         self.cf = cf
         self.ofmt = ofmt
@@ -1211,6 +1252,7 @@ class PNGConverter:
         self.premultiply = premultiply
         self.compress = compress
         self.background = background
+        self.tile = tile
 
     def _replace_ext(self, input, ext):
         if self.keep_folder:
@@ -1236,7 +1278,8 @@ class PNGConverter:
                 output.append((f, img))
                 if self.ofmt == OutputFormat.BIN_FILE:
                     img.to_bin(self._replace_ext(f, ".bin"),
-                               compress=self.compress)
+                               compress=self.compress,
+                               tile=self.tile)
                 elif self.ofmt == OutputFormat.C_ARRAY:
                     img.to_c_array(self._replace_ext(f, ".c"),
                                    compress=self.compress)
@@ -1271,6 +1314,12 @@ def main():
                         default="NONE",
                         choices=["NONE", "RLE", "LZ4"])
 
+    parser.add_argument('--tile',
+                        help=("store bin image in tiles of WxH pixels, "
+                              "e.g. 64x64"),
+                        default=None,
+                        metavar='WxH')
+
     parser.add_argument('--align',
                         help="stride alignment in bytes for bin image",
                         default=1,
@@ -1313,6 +1362,7 @@ def main():
     ofmt = OutputFormat(args.ofmt) if cf not in (
         ColorFormat.RAW, ColorFormat.RAW_ALPHA) else OutputFormat.C_ARRAY
     compress = CompressMethod[args.compress]
+    tile = tuple(int(v) for v in args.tile.split("x")) if args.tile else None
 
     converter = PNGConverter(files,
                              cf,
@@ -1322,7 +1372,8 @@ def main():
                              align=args.align,
                              premultiply=args.premultiply,
                              compress=compress,
-                             keep_folder=False)
+                             keep_folder=False,
+                             tile=tile)
     output = converter.convert()
     for f, img in output:
         logging.info(f"len: {img.data_len} for {path.basename(f)} ")
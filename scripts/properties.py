@@ -23,12 +23,13 @@ style_properties_type = {
 
 
 class Property:
-    def __init__(self, widget, name, type, index, id):
+    def __init__(self, widget, name, type, index, id, guard=None):
         self.widget = widget
         self.name = name
         self.type = type
         self.index = index
         self.id = id
+        self.guard = guard  # the `#if` condition around the ID in the enum
 
 
 def find_headers(directory):
@@ -46,15 +47,31 @@ def read_widget_properties(directory):
 
     def match_properties(file_path):
         pattern = r'^\s*LV_PROPERTY_ID\((\w+),\s*(\w+),\s*(\w+),\s*(\d+)\)'
+        in_enum = False
+        guards = []
         with open(file_path, 'r') as file:
             for line in file.readlines():
+                # Track the conditions opened inside the enums only
+                if re.match(r'^\s*enum\s*\{', line):
+                    in_enum = True
+                    guards = []
+                elif re.match(r'^\s*\}', line):
+                    in_enum = False
+                elif in_enum and re.match(r'^\s*#\s*if\s', line):
+                    guards.append(line.split(None, 1)[1].strip())
+                elif in_enum and re.match(r'^\s*#\s*endif', line):
+                    guards.pop()
+                elif in_enum and re.match(r'^\s*#\s*(else|elif)', line):
+                    raise ValueError(f"{file_path}: #else/#elif is not supported around properties")
+
                 match = re.match(pattern, line)
                 if match:
                     id = f"LV_PROPERTY_{match.group(1).upper()}_{match.group(2).upper()}"
                     yield Property(
                         match.group(1).lower(),
                         match.group(2).lower(), match.group(3), match.group(4),
-                        id)
+                        id, " && ".join(f"({g})" for g in guards) if len(guards) > 1 else
+                        (guards[0] if guards else None))
 
     def match_styles(file_path):
         pattern = r'^\s+LV_STYLE_(\w+)\s*=\s*(\d+),'
@@ -106,7 +123,11 @@ def write_widget_properties(output, properties_by_widget):
             file_name = f'lv_{widget}_properties.c'
             output_file = f'{output}/{file_name}'
 
-            count = len(properties)
+            # The conditional properties are counted only if they are enabled
+            count = str(len([p for p in properties if p.guard is None]))
+            for cond in sorted(set(p.guard for p in properties if p.guard)):
+                n = len([p for p in properties if p.guard == cond])
+                count += f" + (({cond}) ? {n} : 0)"
             if widget == 'style':
                 include = "lv_style_properties.h"
                 guard = None
@@ -140,7 +161,11 @@ const lv_property_name_t lv_{widget}_property_names[{count}] = {{
                 for property in properties:
                     name = property.name
                     name_str = '"' + name + '",'
+                    if property.guard:
+                        f.write(f"#if {property.guard}\n")
                     f.write(f"    {{{name_str :25} {property.id},}},\n")
+                    if property.guard:
+                        f.write("#endif\n")
 
                 f.write('};\n')
                 if guard:
@@ -24,6 +24,9 @@ extern "C" {
 #include "../misc/lv_area.h"
 #include "../misc/lv_color_op.h"
 #include "../misc/lv_ll.h"
+#include "../misc/lv_slab.h"
+#include "../misc/lv_mpsc_queue.h"
+#include "../misc/lv_rb_private.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_style.h"
 #include "../misc/lv_timer.h"
@@ -41,10 +44,12 @@ extern "C" {
 #include "../misc/lv_types.h"
 
 #include "../misc/lv_timer_private.h"
+#include "../misc/lv_async_private.h"
 #include "../misc/lv_anim_private.h"
 #include "../tick/lv_tick_private.h"
 #include "../draw/lv_draw_buf_private.h"
 #include "../draw/lv_draw_private.h"
+#include "../draw/lv_image_decoder_private.h"
 #include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../stdlib/builtin/lv_tlsf_private.h"
@@ -86,6 +91,22 @@ typedef struct _lv_global_t {
 
     lv_ll_t style_trans_ll;
     bool style_refresh;
+#if LV_OBJ_STYLE_USER_INDEX
+    lv_rb_t style_user_index;   /**< The objects using each style, keyed by the style's address*/
+#endif
+#if LV_OBJ_DRAW_LIST_CACHE
+    uint32_t draw_cache_stamp;  /**< Incremented when a style changes to invalidate all draw list caches*/
+#endif
+#if LV_OBJ_LAYER_CACHE_SIZE
+    lv_ll_t layer_cache_ll;         /**< The `lv_obj_layer_cache_t`s, the most recently used first*/
+    uint32_t layer_cache_used;      /**< Bytes used by the rendered layers*/
+    uint32_t layer_cache_frame;     /**< Incremented on each refresh to know which layers are being drawn*/
+    lv_obj_t * layer_cache_keep;    /**< Don't drop the layer of this object when it's invalidated*/
+#endif
+#if LV_OBJ_SLAB_ITEM_CNT
+    lv_ll_t obj_slab_ll;            /**< The `lv_obj_class_slab_t`s, one for each widget class in use*/
+    lv_slab_t spec_attr_slab;       /**< The `spec_attr` of all widgets*/
+#endif
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
@@ -120,6 +141,9 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_t img_decoder_async;
+#endif
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -161,6 +185,10 @@ typedef struct _lv_global_t {
     lv_fs_drv_t posix_fs_drv;
 #endif
 
+#if LV_USE_FS_MMAP
+    lv_fs_drv_t mmap_fs_drv;
+#endif
+
 #if LV_USE_FS_FATFS
     lv_fs_drv_t fatfs_fs_drv;
 #endif
@@ -207,6 +235,19 @@ typedef struct _lv_global_t {
 
 #if LV_USE_IME_PINYIN != 0
     size_t ime_cand_len;
+    lv_ll_t ime_pinyin_trie_ll;     /**< The `lv_ime_pinyin_shared_trie_t`s, one for each dictionary in use*/
+#endif
+
+#if LV_ASYNC_QUEUE_SIZE
+    lv_async_queue_t async_queue;
+#endif
+
+#if LV_USE_OBSERVER
+    lv_subject_t * subject_dirty_head;  /**< Deferred subjects to notify in the next refresh cycle*/
+    lv_subject_t * subject_dirty_tail;
+#if LV_OBSERVER_POST_QUEUE_SIZE
+    lv_mpsc_queue_t subject_post_queue; /**< Values posted to the subjects from other threads*/
+#endif
 #endif
 
 #if LV_USE_OBJ_ID_BUILTIN
@@ -12,6 +12,7 @@
 #include "lv_obj_style_private.h"
 #include "lv_obj_event_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_scroll_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "lv_refr.h"
@@ -26,6 +27,7 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
 #include "lv_obj_draw_private.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
@@ -241,6 +243,9 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags |= f;
 
+    /*Hidden and floating children are not considered when scrolling*/
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) lv_obj_scroll_invalidate_child_ext(lv_obj_get_parent(obj));
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         if(lv_obj_has_state(obj, LV_STATE_FOCUSED)) {
             lv_group_t * group = lv_obj_get_group(obj);
@@ -283,6 +288,8 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) lv_obj_scroll_invalidate_child_ext(lv_obj_get_parent(obj));
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         if(lv_obj_is_layout_positioned(obj)) {
@@ -383,7 +390,11 @@ void lv_obj_allocate_spec_attr(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     if(obj->spec_attr == NULL) {
+#if LV_OBJ_SLAB_ITEM_CNT
+        obj->spec_attr = lv_slab_alloc(&LV_GLOBAL_DEFAULT()->spec_attr_slab);
+#else
         obj->spec_attr = lv_malloc_zeroed(sizeof(lv_obj_spec_attr_t));
+#endif
         LV_ASSERT_MALLOC(obj->spec_attr);
         if(obj->spec_attr == NULL) return;
 
@@ -541,7 +552,19 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         lv_event_remove_all(&obj->spec_attr->event_list);
 
+#if LV_OBJ_DRAW_LIST_CACHE
+        lv_obj_draw_cache_delete(obj);
+#endif
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+        lv_obj_layer_cache_delete(obj);
+#endif
+
+#if LV_OBJ_SLAB_ITEM_CNT
+        lv_slab_free(&LV_GLOBAL_DEFAULT()->spec_attr_slab, obj->spec_attr);
+#else
         lv_free(obj->spec_attr);
+#endif
         obj->spec_attr = NULL;
     }
 
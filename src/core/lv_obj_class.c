@@ -8,15 +8,19 @@
  *********************/
 #include "lv_obj_class_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_scroll_private.h"
+#include "lv_obj_tree_private.h"
 #include "../themes/lv_theme.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../stdlib/lv_string.h"
+#include "../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_obj_class)
+#define obj_slab_ll_p (&(LV_GLOBAL_DEFAULT()->obj_slab_ll))
 
 /**********************
  *      TYPEDEFS
@@ -31,6 +35,9 @@
  **********************/
 static void lv_obj_construct(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static uint32_t get_instance_size(const lv_obj_class_t * class_p);
+#if LV_OBJ_SLAB_ITEM_CNT
+    static lv_slab_t * get_class_slab(const lv_obj_class_t * class_p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -47,8 +54,14 @@ static uint32_t get_instance_size(const lv_obj_class_t * class_p);
 lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * parent)
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
+#if LV_OBJ_SLAB_ITEM_CNT
+    lv_slab_t * slab = get_class_slab(class_p);
+    if(slab == NULL) return NULL;
+    lv_obj_t * obj = lv_slab_alloc(slab);
+#else
     uint32_t s = get_instance_size(class_p);
     lv_obj_t * obj = lv_malloc_zeroed(s);
+#endif
     if(obj == NULL) return NULL;
     obj->class_p = class_p;
     obj->parent = parent;
@@ -59,7 +72,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         lv_display_t * disp = lv_display_get_default();
         if(!disp) {
             LV_LOG_WARN("No display created yet. No place to assign the new screen");
-            lv_free(obj);
+            lv_obj_class_free_obj(class_p, obj);
             return NULL;
         }
 
@@ -70,7 +83,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         lv_obj_t ** screens = lv_realloc(disp->screens, sizeof(lv_obj_t *) * (disp->screen_cnt + 1));
         LV_ASSERT_MALLOC(screens);
         if(screens == NULL) {
-            lv_free(obj);
+            lv_obj_class_free_obj(class_p, obj);
             return NULL;
         }
 
@@ -92,10 +105,14 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
             lv_obj_allocate_spec_attr(parent);
         }
 
-        parent->spec_attr->child_cnt++;
-        parent->spec_attr->children = lv_realloc(parent->spec_attr->children,
-                                                 sizeof(lv_obj_t *) * parent->spec_attr->child_cnt);
-        parent->spec_attr->children[parent->spec_attr->child_cnt - 1] = obj;
+        if(lv_obj_children_append(parent, obj) != LV_RESULT_OK) {
+            lv_obj_class_free_obj(class_p, obj);
+            return NULL;
+        }
+        lv_obj_scroll_invalidate_child_ext(parent);
+
+        /*The style of the child will be refreshed at the end of the batch*/
+        if(parent->spec_attr->child_batch) obj->batch_new = 1;
     }
 
     return obj;
@@ -105,24 +122,33 @@ void lv_obj_class_init_obj(lv_obj_t * obj)
 {
     if(obj == NULL) return;
 
-    lv_obj_mark_layout_as_dirty(obj);
+    if(obj->batch_new) {
+        /*The path to the parent is marked at the end of the batch*/
+        obj->layout_inv = 1;
+        obj->layout_path_inv = 1;
+    }
+    else {
+        lv_obj_mark_layout_as_dirty(obj);
+    }
     lv_obj_enable_style_refresh(false);
 
     lv_theme_apply(obj);
     lv_obj_construct(obj->class_p, obj);
 
     lv_obj_enable_style_refresh(true);
-    lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
-
-    lv_obj_refresh_self_size(obj);
+    if(!obj->batch_new) {
+        lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
+        lv_obj_refresh_self_size(obj);
+    }
 
     lv_group_t * def_group = lv_group_get_default();
     if(def_group && lv_obj_is_group_def(obj)) {
         lv_group_add_obj(def_group, obj);
     }
 
+    /*In a batch the parent is notified only once at the end*/
     lv_obj_t * parent = lv_obj_get_parent(obj);
-    if(parent) {
+    if(parent && !obj->batch_new) {
         /*Call the ancestor's event handler to the parent to notify it about the new child.
          *Also triggers layout update*/
         lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -146,6 +172,67 @@ void lv_obj_destruct(lv_obj_t * obj)
     }
 }
 
+void lv_obj_class_free_obj(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+#if LV_OBJ_SLAB_ITEM_CNT
+    lv_slab_free(get_class_slab(class_p), obj);
+#else
+    LV_UNUSED(class_p);
+    lv_free(obj);
+#endif
+}
+
+#if LV_OBJ_SLAB_ITEM_CNT
+
+void lv_obj_class_reserve(const lv_obj_class_t * class_p, uint32_t cnt)
+{
+    lv_slab_t * slab = get_class_slab(class_p);
+    if(slab) lv_slab_reserve(slab, cnt);
+}
+
+void lv_obj_class_slab_reclaim(void)
+{
+    lv_obj_class_slab_t * class_slab;
+    LV_LL_READ(obj_slab_ll_p, class_slab) {
+        lv_slab_reclaim(&class_slab->slab);
+    }
+
+    lv_slab_reclaim(&LV_GLOBAL_DEFAULT()->spec_attr_slab);
+}
+
+void lv_obj_class_slab_monitor(const lv_obj_class_t * class_p, lv_slab_monitor_t * mon_p)
+{
+    if(class_p == NULL) {
+        lv_slab_monitor(&LV_GLOBAL_DEFAULT()->spec_attr_slab, mon_p);
+        return;
+    }
+
+    lv_obj_class_slab_t * class_slab;
+    LV_LL_READ(obj_slab_ll_p, class_slab) {
+        if(class_slab->class_p == class_p) {
+            lv_slab_monitor(&class_slab->slab, mon_p);
+            return;
+        }
+    }
+
+    /*No widget of this class was created yet*/
+    lv_memzero(mon_p, sizeof(lv_slab_monitor_t));
+    mon_p->item_size = get_instance_size(class_p);
+}
+
+void lv_obj_class_slab_deinit(void)
+{
+    lv_obj_class_slab_t * class_slab;
+    LV_LL_READ(obj_slab_ll_p, class_slab) {
+        lv_slab_deinit(&class_slab->slab);
+    }
+    lv_ll_clear(obj_slab_ll_p);
+
+    lv_slab_deinit(&LV_GLOBAL_DEFAULT()->spec_attr_slab);
+}
+
+#endif /*LV_OBJ_SLAB_ITEM_CNT*/
+
 bool lv_obj_is_editable(lv_obj_t * obj)
 {
     const lv_obj_class_t * class_p = obj->class_p;
@@ -202,3 +289,26 @@ static uint32_t get_instance_size(const lv_obj_class_t * class_p)
 
     return base->instance_size;
 }
+
+#if LV_OBJ_SLAB_ITEM_CNT
+static lv_slab_t * get_class_slab(const lv_obj_class_t * class_p)
+{
+    lv_obj_class_slab_t * class_slab;
+    LV_LL_READ(obj_slab_ll_p, class_slab) {
+        if(class_slab->class_p == class_p) {
+            /*Keep the recently used classes at the front to find them faster*/
+            lv_obj_class_slab_t * head = lv_ll_get_head(obj_slab_ll_p);
+            if(class_slab != head) lv_ll_move_before(obj_slab_ll_p, class_slab, head);
+            return &class_slab->slab;
+        }
+    }
+
+    class_slab = lv_ll_ins_head(obj_slab_ll_p);
+    LV_ASSERT_MALLOC(class_slab);
+    if(class_slab == NULL) return NULL;
+
+    class_slab->class_p = class_p;
+    lv_slab_init(&class_slab->slab, get_instance_size(class_p), LV_OBJ_SLAB_ITEM_CNT);
+    return &class_slab->slab;
+}
+#endif
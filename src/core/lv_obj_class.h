@@ -16,6 +16,7 @@ extern "C" {
 #include "../misc/lv_types.h"
 #include "../misc/lv_area.h"
 #include "lv_obj_property.h"
+#include "../misc/lv_slab.h"
 
 /*********************
  *      DEFINES
@@ -61,6 +62,31 @@ bool lv_obj_is_editable(lv_obj_t * obj);
 
 bool lv_obj_is_group_def(lv_obj_t * obj);
 
+#if LV_OBJ_SLAB_ITEM_CNT
+
+/**
+ * Allocate memory in advance for a given number of widgets of a class and keep it
+ * even if the widgets are deleted. Useful for the widgets of screens created often.
+ * @param class_p   pointer to a class, e.g. `&lv_button_class`
+ * @param cnt       number of widgets to reserve memory for. 0: release the reservation
+ */
+void lv_obj_class_reserve(const lv_obj_class_t * class_p, uint32_t cnt);
+
+/**
+ * Give the memory of the empty slabs of all widget classes back to the heap.
+ * The last slab of a class is kept when its widgets are deleted, this call frees it too.
+ */
+void lv_obj_class_slab_reclaim(void);
+
+/**
+ * Get the memory usage of the widgets of a class.
+ * @param class_p   pointer to a class, or NULL to get the usage of the `spec_attr` of all widgets
+ * @param mon_p     pointer to a `lv_slab_monitor_t` variable to fill
+ */
+void lv_obj_class_slab_monitor(const lv_obj_class_t * class_p, lv_slab_monitor_t * mon_p);
+
+#endif /*LV_OBJ_SLAB_ITEM_CNT*/
+
 /**********************
  *      MACROS
  **********************/
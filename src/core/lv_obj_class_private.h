@@ -60,6 +60,14 @@ struct _lv_obj_class_t {
     uint32_t theme_inheritable : 1;    /**< Value from ::lv_obj_class_theme_inheritable_t*/
 };
 
+#if LV_OBJ_SLAB_ITEM_CNT
+/** The slab allocator of the instances of a widget class*/
+typedef struct {
+    const lv_obj_class_t * class_p;
+    lv_slab_t slab;
+} lv_obj_class_slab_t;
+#endif
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -67,6 +75,20 @@ struct _lv_obj_class_t {
 
 void lv_obj_destruct(lv_obj_t * obj);
 
+/**
+ * Free the memory of an object allocated by `lv_obj_class_create_obj()`.
+ * @param class_p   the class the object was created with. Not `obj->class_p` as it's changed while destructing.
+ * @param obj       pointer to the object to free
+ */
+void lv_obj_class_free_obj(const lv_obj_class_t * class_p, lv_obj_t * obj);
+
+#if LV_OBJ_SLAB_ITEM_CNT
+/**
+ * Free the slab allocators of the widgets. All widgets have to be deleted before calling it.
+ */
+void lv_obj_class_slab_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -10,14 +10,25 @@
 #include "lv_obj_private.h"
 #include "lv_obj_style.h"
 #include "../display/lv_display.h"
+#include "../display/lv_display_private.h"
 #include "../indev/lv_indev.h"
 #include "../stdlib/lv_string.h"
 #include "../draw/lv_draw_arc.h"
+#include "../draw/lv_draw_private.h"
+#include "../misc/cache/lv_image_cache.h"
+#include "../misc/lv_area_private.h"
+#include "lv_refr.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_obj_class)
+#define draw_cache_stamp LV_GLOBAL_DEFAULT()->draw_cache_stamp
+#define layer_cache_ll_p &(LV_GLOBAL_DEFAULT()->layer_cache_ll)
+#define layer_cache_used LV_GLOBAL_DEFAULT()->layer_cache_used
+#define layer_cache_frame LV_GLOBAL_DEFAULT()->layer_cache_frame
+#define layer_cache_keep_obj LV_GLOBAL_DEFAULT()->layer_cache_keep
 
 /**********************
  *      TYPEDEFS
@@ -26,6 +37,16 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_OBJ_DRAW_LIST_CACHE
+    static bool draw_cache_is_up_to_date(const lv_obj_draw_cache_t * cache, const lv_layer_t * layer,
+                                         const lv_area_t * area, lv_opa_t opa);
+    static void draw_cache_release(lv_obj_draw_cache_t * cache);
+#endif
+#if LV_OBJ_LAYER_CACHE_SIZE
+    static bool layer_cache_reserve(uint32_t size);
+    static lv_draw_buf_t * layer_cache_render(lv_obj_t * obj, const lv_area_t * area);
+    static void layer_cache_release(lv_obj_layer_cache_t * cache);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -321,6 +342,296 @@ lv_layer_type_t lv_obj_get_layer_type(const lv_obj_t * obj)
     else return LV_LAYER_TYPE_NONE;
 }
 
+#if LV_OBJ_DRAW_LIST_CACHE
+
+bool lv_obj_draw_cache_replay(lv_layer_t * layer, lv_obj_t * obj)
+{
+    lv_obj_draw_cache_t * cache = obj->spec_attr ? obj->spec_attr->draw_cache : NULL;
+
+    /*Called from the recording itself, draw normally*/
+    if(cache && cache->recording) return false;
+
+    if(cache == NULL) {
+        lv_obj_allocate_spec_attr(obj);
+        if(obj->spec_attr == NULL) return false;
+
+        cache = lv_malloc_zeroed(sizeof(lv_obj_draw_cache_t));
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return false;
+        obj->spec_attr->draw_cache = cache;
+    }
+
+    lv_area_t area;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &area);
+    lv_area_increase(&area, ext_draw_size, ext_draw_size);
+
+    lv_opa_t opa = lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN);
+
+    if(!draw_cache_is_up_to_date(cache, layer, &area, opa)) {
+        LV_PROFILER_DRAW_BEGIN_TAG("draw_cache_record");
+        draw_cache_release(cache);
+
+        /*Record everything on the extended area, the recording will be clipped when replayed*/
+        lv_draw_recorder_t recorder;
+        lv_draw_recorder_begin(&recorder, layer, &area);
+        cache->recording = 1;
+        lv_obj_redraw(&recorder.layer, obj);
+        cache->recording = 0;
+        cache->task_head = lv_draw_recorder_end(&recorder);
+
+        cache->failed = recorder.failed;
+        cache->valid = 1;
+        cache->area = area;
+        cache->opa = opa;
+        cache->stamp = draw_cache_stamp;
+        cache->color_format = layer->color_format;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        cache->matrix = layer->matrix;
+#endif
+        if(cache->failed) LV_LOG_INFO("The draw tasks of %p can't be recorded, drawing it normally", (void *)obj);
+        LV_PROFILER_DRAW_END_TAG("draw_cache_record");
+    }
+
+    if(cache->failed) return false;
+
+    lv_draw_recorder_replay(layer, cache->task_head);
+    return true;
+}
+
+void lv_obj_draw_cache_invalidate(lv_obj_t * obj)
+{
+    while(obj) {
+        if(obj->spec_attr && obj->spec_attr->draw_cache) {
+            draw_cache_release(obj->spec_attr->draw_cache);
+        }
+        obj = obj->parent;
+    }
+}
+
+void lv_obj_draw_cache_delete(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->draw_cache == NULL) return;
+
+    draw_cache_release(obj->spec_attr->draw_cache);
+    lv_free(obj->spec_attr->draw_cache);
+    obj->spec_attr->draw_cache = NULL;
+}
+
+#endif /*LV_OBJ_DRAW_LIST_CACHE*/
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+
+void lv_obj_set_layer_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(lv_obj_get_layer_cache(obj) == en) return;
+
+    if(en) {
+        lv_obj_allocate_spec_attr(obj);
+        if(obj->spec_attr == NULL) return;
+
+        lv_obj_layer_cache_t * cache = lv_ll_ins_tail(layer_cache_ll_p);
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return;
+
+        lv_memzero(cache, sizeof(lv_obj_layer_cache_t));
+        cache->obj = obj;
+        obj->spec_attr->layer_cache = cache;
+    }
+    else {
+        lv_obj_layer_cache_delete(obj);
+    }
+}
+
+bool lv_obj_get_layer_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    return obj->spec_attr && obj->spec_attr->layer_cache;
+}
+
+lv_draw_buf_t * lv_obj_layer_cache_get(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_obj_layer_cache_t * cache = obj->spec_attr ? obj->spec_attr->layer_cache : NULL;
+    if(cache == NULL) return NULL;
+
+#if LV_OBJ_DRAW_LIST_CACHE
+    /*A recorded draw task would refer to the layer even after it's dropped*/
+    if(LV_GLOBAL_DEFAULT()->draw_info.recorder) return NULL;
+#endif
+
+    if(cache->draw_buf && !lv_area_is_equal(&cache->area, area)) {
+        layer_cache_release(cache);
+    }
+
+    if(cache->draw_buf == NULL) {
+        uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), LV_COLOR_FORMAT_ARGB8888);
+        uint32_t size = stride * lv_area_get_height(area);
+        if(!layer_cache_reserve(size)) return NULL;
+
+        /*Mark it as used already to not drop it while its children's layers are rendered*/
+        cache->frame = layer_cache_frame;
+        cache->draw_buf = layer_cache_render(obj, area);
+        if(cache->draw_buf == NULL) return NULL;
+
+        cache->area = *area;
+        layer_cache_used += cache->draw_buf->data_size;
+    }
+
+    cache->frame = layer_cache_frame;
+
+    /*Keep the most recently used layers at the head*/
+    lv_obj_layer_cache_t * head = lv_ll_get_head(layer_cache_ll_p);
+    if(head != cache) lv_ll_move_before(layer_cache_ll_p, cache, head);
+
+    return cache->draw_buf;
+}
+
+void lv_obj_layer_cache_invalidate(lv_obj_t * obj)
+{
+    lv_obj_t * obj_act = obj;
+    while(obj_act) {
+        if(obj_act->spec_attr && obj_act->spec_attr->layer_cache && obj_act != layer_cache_keep_obj) {
+            layer_cache_release(obj_act->spec_attr->layer_cache);
+        }
+        obj_act = obj_act->parent;
+    }
+}
+
+void lv_obj_layer_cache_invalidate_children(lv_obj_t * obj)
+{
+    lv_obj_layer_cache_t * cache;
+    LV_LL_READ(layer_cache_ll_p, cache) {
+        if(cache->draw_buf == NULL) continue;
+
+        lv_obj_t * parent = lv_obj_get_parent(cache->obj);
+        while(parent && parent != obj) parent = lv_obj_get_parent(parent);
+        if(parent) layer_cache_release(cache);
+    }
+}
+
+void lv_obj_layer_cache_keep(lv_obj_t * obj)
+{
+    layer_cache_keep_obj = obj;
+}
+
+void lv_obj_layer_cache_delete(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->layer_cache == NULL) return;
+
+    layer_cache_release(obj->spec_attr->layer_cache);
+    lv_ll_remove(layer_cache_ll_p, obj->spec_attr->layer_cache);
+    lv_free(obj->spec_attr->layer_cache);
+    obj->spec_attr->layer_cache = NULL;
+}
+
+#endif /*LV_OBJ_LAYER_CACHE_SIZE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_OBJ_DRAW_LIST_CACHE
+
+static bool draw_cache_is_up_to_date(const lv_obj_draw_cache_t * cache, const lv_layer_t * layer,
+                                     const lv_area_t * area, lv_opa_t opa)
+{
+    if(!cache->valid) return false;
+    if(cache->stamp != draw_cache_stamp) return false;
+    if(cache->opa != opa) return false;
+    if(cache->color_format != layer->color_format) return false;
+    if(!lv_area_is_equal(&cache->area, area)) return false;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(lv_memcmp(&cache->matrix, &layer->matrix, sizeof(lv_matrix_t)) != 0) return false;
+#endif
+
+    return true;
+}
+
+static void draw_cache_release(lv_obj_draw_cache_t * cache)
+{
+    if(cache->task_head) {
+        lv_draw_recorder_free(cache->task_head);
+        cache->task_head = NULL;
+    }
+    cache->valid = 0;
+    cache->failed = 0;
+}
+
+#endif /*LV_OBJ_DRAW_LIST_CACHE*/
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+
+/**
+ * Drop the least recently used layers until `size` bytes are free in the cache.
+ * The layers drawn in the current refresh are not dropped as their draw tasks might be pending.
+ */
+static bool layer_cache_reserve(uint32_t size)
+{
+    if(size > LV_OBJ_LAYER_CACHE_SIZE) return false;
+
+    lv_obj_layer_cache_t * cache = lv_ll_get_tail(layer_cache_ll_p);
+    while(cache && layer_cache_used + size > LV_OBJ_LAYER_CACHE_SIZE) {
+        if(cache->draw_buf && cache->frame != layer_cache_frame) {
+            layer_cache_release(cache);
+        }
+        cache = lv_ll_get_prev(layer_cache_ll_p, cache);
+    }
+
+    return layer_cache_used + size <= LV_OBJ_LAYER_CACHE_SIZE;
+}
+
+static lv_draw_buf_t * layer_cache_render(lv_obj_t * obj, const lv_area_t * area)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(lv_area_get_width(area), lv_area_get_height(area),
+                                                  LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    if(draw_buf == NULL) {
+        LV_LOG_WARN("Couldn't allocate the layer of %p", (void *)obj);
+        LV_PROFILER_DRAW_END;
+        return NULL;
+    }
+    lv_draw_buf_clear(draw_buf, NULL);
+
+    lv_layer_t layer;
+    lv_memzero(&layer, sizeof(layer));
+    layer.draw_buf = draw_buf;
+    layer.buf_area = *area;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    layer._clip_area = *area;
+    layer.phy_clip_area = *area;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_identity(&layer.matrix);
+#endif
+
+    /*Render the whole object now, independently from the layers of the current refresh*/
+    lv_display_t * disp = lv_obj_get_display(obj);
+    lv_layer_t * layer_head_ori = disp->layer_head;
+    disp->layer_head = &layer;
+
+    lv_obj_redraw(&layer, obj);
+
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+
+    disp->layer_head = layer_head_ori;
+
+    LV_PROFILER_DRAW_END;
+    return draw_buf;
+}
+
+static void layer_cache_release(lv_obj_layer_cache_t * cache)
+{
+    if(cache->draw_buf == NULL) return;
+
+    layer_cache_used -= cache->draw_buf->data_size;
+    lv_image_cache_drop(cache->draw_buf);
+    lv_draw_buf_destroy(cache->draw_buf);
+    cache->draw_buf = NULL;
+}
+
+#endif /*LV_OBJ_LAYER_CACHE_SIZE*/
@@ -102,6 +102,27 @@ int32_t lv_obj_calculate_ext_draw_size(lv_obj_t * obj, lv_part_t part);
  */
 void lv_obj_refresh_ext_draw_size(lv_obj_t * obj);
 
+#if LV_OBJ_LAYER_CACHE_SIZE
+
+/**
+ * Keep the rendered transform or opacity layer of an object between refreshes.
+ * While only the transformation, opacity, blend mode or bitmap mask of the object changes,
+ * the cached layer is blended again instead of redrawing the object and its children.
+ * The layers are kept in a cache of `LV_OBJ_LAYER_CACHE_SIZE` bytes.
+ * @param obj       pointer to an object
+ * @param en        true: enable the layer cache; false: disable it and free the cached layer
+ */
+void lv_obj_set_layer_cache(lv_obj_t * obj, bool en);
+
+/**
+ * Get whether the rendered layer of an object is kept between refreshes.
+ * @param obj       pointer to an object
+ * @return          true: the layer cache is enabled
+ */
+bool lv_obj_get_layer_cache(const lv_obj_t * obj);
+
+#endif /*LV_OBJ_LAYER_CACHE_SIZE*/
+
 /**********************
  *      MACROS
  **********************/
@@ -24,6 +24,37 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_OBJ_DRAW_LIST_CACHE
+/**
+ * The recorded draw tasks of an object having `LV_OBJ_FLAG_CACHE_DRAW_LIST`
+ */
+struct _lv_obj_draw_cache_t {
+    lv_draw_task_t * task_head;     /**< The recorded draw tasks of the object and its children*/
+    lv_area_t area;                 /**< The coordinates and extended draw area of the object when recorded*/
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_t matrix;             /**< The matrix of the layer when recorded*/
+#endif
+    uint32_t stamp;                 /**< The global style stamp when recorded*/
+    lv_color_format_t color_format; /**< The color format of the layer when recorded*/
+    lv_opa_t opa;                   /**< The opacity inherited from the parents when recorded*/
+    uint8_t valid : 1;              /**< There is a recording (or a failed attempt)*/
+    uint8_t failed : 1;             /**< The draw tasks couldn't be recorded, draw the object normally*/
+    uint8_t recording : 1;          /**< The draw tasks are being recorded now*/
+};
+#endif
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+/**
+ * The rendered layer of an object with enabled layer cache
+ */
+struct _lv_obj_layer_cache_t {
+    lv_obj_t * obj;                 /**< The object whose layer is cached*/
+    lv_draw_buf_t * draw_buf;       /**< The rendered layer or NULL if not rendered yet or dropped*/
+    lv_area_t area;                 /**< The coordinates and extended draw area of the object when rendered*/
+    uint32_t frame;                 /**< The refresh in which the layer was drawn last time*/
+};
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -37,6 +68,74 @@ int32_t lv_obj_get_ext_draw_size(const lv_obj_t * obj);
 
 lv_layer_type_t lv_obj_get_layer_type(const lv_obj_t * obj);
 
+#if LV_OBJ_DRAW_LIST_CACHE
+
+/**
+ * Replay the recorded draw tasks of an object having `LV_OBJ_FLAG_CACHE_DRAW_LIST`.
+ * If there is no up-to-date recording, record the draw tasks first.
+ * @param layer     pointer to a layer
+ * @param obj       pointer to an object
+ * @return          true: the draw tasks were added to the layer;
+ *                  false: the object couldn't be recorded and needs to be drawn normally
+ */
+bool lv_obj_draw_cache_replay(lv_layer_t * layer, lv_obj_t * obj);
+
+/**
+ * Drop the recorded draw tasks of an object and its parents
+ * as the recordings of the parents contain the object's draw tasks too.
+ * @param obj       pointer to an object
+ */
+void lv_obj_draw_cache_invalidate(lv_obj_t * obj);
+
+/**
+ * Free the recorded draw tasks of an object
+ * @param obj       pointer to an object
+ */
+void lv_obj_draw_cache_delete(lv_obj_t * obj);
+
+#endif /*LV_OBJ_DRAW_LIST_CACHE*/
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+
+/**
+ * Get the rendered layer of an object with enabled layer cache.
+ * If the layer is not rendered yet or it was dropped, render it now.
+ * @param obj       pointer to an object
+ * @param area      the coordinates and extended draw area of the object
+ * @return          the rendered layer as an ARGB8888 draw buffer,
+ *                  or NULL if the layer cache is disabled or the layer doesn't fit into the cache
+ */
+lv_draw_buf_t * lv_obj_layer_cache_get(lv_obj_t * obj, const lv_area_t * area);
+
+/**
+ * Drop the rendered layers of an object and its parents as their content has changed.
+ * The layer of the object itself is kept if only its transformation or opacity has changed.
+ * @param obj       pointer to an object
+ */
+void lv_obj_layer_cache_invalidate(lv_obj_t * obj);
+
+/**
+ * Drop the rendered layers of the descendants of an object,
+ * e.g. because an inherited style property of the object has changed.
+ * @param obj       pointer to an object
+ */
+void lv_obj_layer_cache_invalidate_children(lv_obj_t * obj);
+
+/**
+ * Keep the rendered layer of an object when the object is invalidated.
+ * Used while a property is refreshed which affects only how the layer is blended.
+ * @param obj       pointer to an object or NULL to drop the layers normally again
+ */
+void lv_obj_layer_cache_keep(lv_obj_t * obj);
+
+/**
+ * Disable the layer cache of an object and free its rendered layer
+ * @param obj       pointer to an object
+ */
+void lv_obj_layer_cache_delete(lv_obj_t * obj);
+
+#endif /*LV_OBJ_LAYER_CACHE_SIZE*/
+
 /**********************
  *      MACROS
  **********************/
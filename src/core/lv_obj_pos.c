@@ -11,6 +11,7 @@
 #include "lv_obj_event_private.h"
 #include "lv_obj_draw_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_scroll_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "lv_refr_private.h"
@@ -32,6 +33,7 @@
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void layout_mark_path(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 
 /**********************
@@ -187,6 +189,10 @@ bool lv_obj_refr_size(lv_obj_t * obj)
         obj->coords.x2 = obj->coords.x1 + w - 1;
     }
 
+    lv_obj_scroll_update_child_ext(obj, &ori);
+    /*The cached extent of the children is relative to the top left corner*/
+    if(ori.x1 != obj->coords.x1 || ori.y1 != obj->coords.y1) lv_obj_scroll_invalidate_child_ext(obj);
+
     /*Call the ancestor's event handler to the object with its new coordinates*/
     lv_obj_send_event(obj, LV_EVENT_SIZE_CHANGED, &ori);
 
@@ -197,6 +203,9 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    /*During the layout update the object is either the currently updated one or
+     *a child resized by the parent's layout. Both are readjusted in the same pass.*/
+    if(!update_layout_mutex) layout_mark_path(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -280,6 +289,7 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
+    layout_mark_path(obj);
 
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
     lv_obj_t * scr = lv_obj_get_screen(obj);
@@ -738,6 +748,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
     obj->coords.y2 += diff.y;
 
     lv_obj_move_children_by(obj, diff.x, diff.y, false);
+    lv_obj_scroll_update_child_ext(obj, &ori);
 
     /*Call the ancestor's event handler to the parent too*/
     if(parent) lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -814,6 +825,15 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_DRAW_LIST_CACHE
+    /*Drop the recordings even if the object is not visible now as its content has changed*/
+    lv_obj_draw_cache_invalidate((lv_obj_t *)obj);
+#endif
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+    lv_obj_layer_cache_invalidate((lv_obj_t *)obj);
+#endif
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return;
 
@@ -1123,8 +1143,27 @@ static int32_t calc_content_height(lv_obj_t * obj)
     return LV_MAX(self_h, child_res + space_bottom);
 }
 
+/**
+ * Mark the object and its ancestors to let the layout update find the object
+ * without visiting the unchanged parts of the tree.
+ * @param obj   pointer to an object which needs a layout update or scroll readjustment
+ */
+static void layout_mark_path(lv_obj_t * obj)
+{
+    /*Don't stop at the already marked ancestors because after `lv_obj_set_parent`
+     *a marked object can be under an unmarked parent*/
+    while(obj) {
+        obj->layout_path_inv = 1;
+        obj = obj->parent;
+    }
+}
+
 static void layout_update_core(lv_obj_t * obj)
 {
+    /*Nothing has changed in this subtree*/
+    if(!obj->layout_path_inv) return;
+    obj->layout_path_inv = 0;
+
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
     for(i = 0; i < child_cnt; i++) {
@@ -1132,6 +1171,9 @@ static void layout_update_core(lv_obj_t * obj)
         layout_update_core(child);
     }
 
+    /* The content size of the object is measured again only here, when it's marked as dirty.
+     * `lv_obj_refr_size()` notifies the parent only if the size really changed, so
+     * the relayout stops at the first container whose outer size stays the same.*/
     if(obj->layout_inv) {
         obj->layout_inv = 0;
         lv_obj_refr_size(obj);
@@ -1139,6 +1181,17 @@ static void layout_update_core(lv_obj_t * obj)
 
         if(child_cnt > 0) {
             lv_layout_apply(obj);
+
+            /*The children were already visited, so readjust the ones resized by the layout here.
+             *The event handlers of the children might have changed the tree, so count them again.*/
+            child_cnt = lv_obj_get_child_count(obj);
+            for(i = 0; i < child_cnt; i++) {
+                lv_obj_t * child = obj->spec_attr->children[i];
+                if(child->readjust_scroll_after_layout) {
+                    child->readjust_scroll_after_layout = 0;
+                    lv_obj_readjust_scroll(child, LV_ANIM_OFF);
+                }
+            }
         }
     }
 
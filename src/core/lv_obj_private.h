@@ -34,16 +34,28 @@ struct _lv_obj_spec_attr_t {
     lv_event_list_t event_list;
 
     lv_point_t scroll;              /**< The current X/Y scroll offset*/
+    lv_area_t child_ext;            /**< Bounding box of the scrolled children with their margins,
+                                         relative to the top left corner of the unscrolled object*/
 
     int32_t ext_click_pad;          /**< Extra click padding in all direction*/
     int32_t ext_draw_size;          /**< EXTend the size in every direction for drawing.*/
 
     uint16_t child_cnt;             /**< Number of children*/
+    uint16_t child_capacity;        /**< Number of children the `children` array can store*/
     uint16_t scrollbar_mode : 2;    /**< How to display scrollbars, see `lv_scrollbar_mode_t`*/
     uint16_t scroll_snap_x : 2;     /**< Where to align the snappable children horizontally, see `lv_scroll_snap_t`*/
     uint16_t scroll_snap_y : 2;     /**< Where to align the snappable children vertically*/
     uint16_t scroll_dir : 4;        /**< The allowed scroll direction(s), see `lv_dir_t`*/
     uint16_t layer_type : 2;        /**< Cache the layer type here. Element of lv_intermediate_layer_type_t */
+    uint16_t child_ext_valid : 1;   /**< `child_ext` is up to date*/
+    uint16_t child_batch : 1;       /**< Children are being added or deleted in a batch*/
+    uint16_t child_batch_deleted : 1; /**< A child was deleted in the current batch*/
+#if LV_OBJ_DRAW_LIST_CACHE
+    lv_obj_draw_cache_t * draw_cache; /**< The recorded draw tasks if `LV_OBJ_FLAG_CACHE_DRAW_LIST` is set*/
+#endif
+#if LV_OBJ_LAYER_CACHE_SIZE
+    lv_obj_layer_cache_t * layer_cache; /**< The rendered layer if the layer cache is enabled*/
+#endif
 };
 
 struct _lv_obj_t {
@@ -63,6 +75,7 @@ struct _lv_obj_t {
     lv_obj_flag_t flags;
     lv_state_t state;
     uint16_t layout_inv : 1;
+    uint16_t layout_path_inv : 1; /**< The object or one of its descendants needs a layout update*/
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
     uint16_t skip_trans : 1;
@@ -70,6 +83,7 @@ struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t is_deleting : 1;
+    uint16_t batch_new : 1;     /**< Added in a children batch of the parent, not refreshed yet*/
 };
 
 
@@ -38,6 +38,8 @@ static void scroll_y_anim(void * obj, int32_t v);
 static void scroll_end_cb(lv_anim_t * a);
 static void scroll_area_into_view(const lv_area_t * area, lv_obj_t * child, lv_point_t * scroll_value,
                                   lv_anim_enable_t anim_en);
+static bool get_child_ext(lv_obj_t * obj, lv_area_t * ext);
+static void child_ext_of(const lv_obj_t * child, const lv_area_t * coords, lv_area_t * ext);
 
 /**********************
  *  STATIC VARIABLES
@@ -138,15 +140,8 @@ int32_t lv_obj_get_scroll_bottom(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     int32_t child_res = LV_COORD_MIN;
-    uint32_t i;
-    uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        if(lv_obj_has_flag_any(child,  LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-
-        int32_t tmp_y = child->coords.y2 + lv_obj_get_style_margin_bottom(child, LV_PART_MAIN);
-        child_res = LV_MAX(child_res, tmp_y);
-    }
+    lv_area_t ext;
+    if(get_child_ext(obj, &ext)) child_res = ext.y2;
 
     int32_t space_top = lv_obj_get_style_space_top(obj, LV_PART_MAIN);
     int32_t space_bottom = lv_obj_get_style_space_bottom(obj, LV_PART_MAIN);
@@ -176,26 +171,9 @@ int32_t lv_obj_get_scroll_left(lv_obj_t * obj)
     int32_t space_right = lv_obj_get_style_space_right(obj, LV_PART_MAIN);
     int32_t space_left = lv_obj_get_style_space_left(obj, LV_PART_MAIN);
 
-    int32_t child_res = 0;
-
-    uint32_t i;
-    int32_t x1 = LV_COORD_MAX;
-    uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        if(lv_obj_has_flag_any(child,  LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-
-        int32_t tmp_x = child->coords.x1 - lv_obj_get_style_margin_left(child, LV_PART_MAIN);
-        x1 = LV_MIN(x1, tmp_x);
-    }
-
-    if(x1 != LV_COORD_MAX) {
-        child_res = x1;
-        child_res = (obj->coords.x1 + space_left) - child_res;
-    }
-    else {
-        child_res = LV_COORD_MIN;
-    }
+    int32_t child_res = LV_COORD_MIN;
+    lv_area_t ext;
+    if(get_child_ext(obj, &ext)) child_res = (obj->coords.x1 + space_left) - ext.x1;
 
     int32_t self_w = lv_obj_get_self_width(obj);
     self_w = self_w - (lv_obj_get_width(obj) - space_right - space_left);
@@ -217,15 +195,8 @@ int32_t lv_obj_get_scroll_right(lv_obj_t * obj)
 
     /*With other base direction (LTR) scrolling to the right is normal so find the right most coordinate*/
     int32_t child_res = LV_COORD_MIN;
-    uint32_t i;
-    uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        if(lv_obj_has_flag_any(child,  LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-
-        int32_t tmp_x = child->coords.x2 + lv_obj_get_style_margin_right(child, LV_PART_MAIN);
-        child_res = LV_MAX(child_res, tmp_x);
-    }
+    lv_area_t ext;
+    if(get_child_ext(obj, &ext)) child_res = ext.x2;
 
     int32_t space_right = lv_obj_get_style_space_right(obj, LV_PART_MAIN);
     int32_t space_left = lv_obj_get_style_space_left(obj, LV_PART_MAIN);
@@ -426,6 +397,39 @@ lv_result_t lv_obj_scroll_by_raw(lv_obj_t * obj, int32_t x, int32_t y)
     return LV_RESULT_OK;
 }
 
+void lv_obj_scroll_invalidate_child_ext(lv_obj_t * obj)
+{
+    if(obj && obj->spec_attr) obj->spec_attr->child_ext_valid = 0;
+}
+
+void lv_obj_scroll_update_child_ext(lv_obj_t * child, const lv_area_t * ori)
+{
+    lv_obj_t * parent = child->parent;
+    if(parent == NULL || parent->spec_attr == NULL || !parent->spec_attr->child_ext_valid) return;
+    if(lv_obj_has_flag_any(child, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) return;
+
+    lv_area_t * ext = &parent->spec_attr->child_ext;
+    lv_area_t ori_ext;
+    lv_area_t new_ext;
+    child_ext_of(child, ori, &ori_ext);
+    child_ext_of(child, &child->coords, &new_ext);
+
+    /*If the child was on an edge of the bounding box and moved inward,
+     *another child might be on the new edge. Find it only when it's needed.*/
+    if((ori_ext.x1 == ext->x1 && new_ext.x1 > ext->x1) ||
+       (ori_ext.y1 == ext->y1 && new_ext.y1 > ext->y1) ||
+       (ori_ext.x2 == ext->x2 && new_ext.x2 < ext->x2) ||
+       (ori_ext.y2 == ext->y2 && new_ext.y2 < ext->y2)) {
+        parent->spec_attr->child_ext_valid = 0;
+        return;
+    }
+
+    ext->x1 = LV_MIN(ext->x1, new_ext.x1);
+    ext->y1 = LV_MIN(ext->y1, new_ext.y1);
+    ext->x2 = LV_MAX(ext->x2, new_ext.x2);
+    ext->y2 = LV_MAX(ext->y2, new_ext.y2);
+}
+
 bool lv_obj_is_scrolling(const lv_obj_t * obj)
 {
     lv_indev_t * indev = lv_indev_get_next(NULL);
@@ -669,6 +673,72 @@ void lv_obj_readjust_scroll(lv_obj_t * obj, lv_anim_enable_t anim_en)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Get the bounding box of the not hidden and not floating children with their margins.
+ * It's calculated only if the children have changed since the last call.
+ * @param obj       pointer to an object
+ * @param ext       store the bounding box here in absolute coordinates
+ * @return          false: there are no such children
+ */
+static bool get_child_ext(lv_obj_t * obj, lv_area_t * ext)
+{
+    if(obj->spec_attr == NULL) return false;
+
+    lv_obj_spec_attr_t * spec_attr = obj->spec_attr;
+    if(!spec_attr->child_ext_valid) {
+        LV_PROFILER_BEGIN;
+        lv_area_t * cache = &spec_attr->child_ext;
+        cache->x1 = LV_COORD_MAX;
+        cache->y1 = LV_COORD_MAX;
+        cache->x2 = LV_COORD_MIN;
+        cache->y2 = LV_COORD_MIN;
+
+        uint32_t i;
+        for(i = 0; i < spec_attr->child_cnt; i++) {
+            lv_obj_t * child = spec_attr->children[i];
+            if(lv_obj_has_flag_any(child, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+
+            lv_area_t child_ext;
+            child_ext_of(child, &child->coords, &child_ext);
+            cache->x1 = LV_MIN(cache->x1, child_ext.x1);
+            cache->y1 = LV_MIN(cache->y1, child_ext.y1);
+            cache->x2 = LV_MAX(cache->x2, child_ext.x2);
+            cache->y2 = LV_MAX(cache->y2, child_ext.y2);
+        }
+        spec_attr->child_ext_valid = 1;
+        LV_PROFILER_END;
+    }
+
+    if(spec_attr->child_ext.x2 < spec_attr->child_ext.x1) return false;
+
+    /*The cache is relative to the unscrolled object as scrolling and moving the object
+     *move its children too and it shouldn't invalidate the cache*/
+    int32_t ofs_x = obj->coords.x1 + spec_attr->scroll.x;
+    int32_t ofs_y = obj->coords.y1 + spec_attr->scroll.y;
+    ext->x1 = spec_attr->child_ext.x1 + ofs_x;
+    ext->y1 = spec_attr->child_ext.y1 + ofs_y;
+    ext->x2 = spec_attr->child_ext.x2 + ofs_x;
+    ext->y2 = spec_attr->child_ext.y2 + ofs_y;
+    return true;
+}
+
+/**
+ * Get the area of a child with its margins, relative to the top left corner of its unscrolled parent
+ * @param child     pointer to a child
+ * @param coords    the coordinates of the child
+ * @param ext       store the result here
+ */
+static void child_ext_of(const lv_obj_t * child, const lv_area_t * coords, lv_area_t * ext)
+{
+    const lv_obj_t * parent = child->parent;
+    int32_t ofs_x = parent->coords.x1 + parent->spec_attr->scroll.x;
+    int32_t ofs_y = parent->coords.y1 + parent->spec_attr->scroll.y;
+    ext->x1 = coords->x1 - lv_obj_get_style_margin_left(child, LV_PART_MAIN) - ofs_x;
+    ext->y1 = coords->y1 - lv_obj_get_style_margin_top(child, LV_PART_MAIN) - ofs_y;
+    ext->x2 = coords->x2 + lv_obj_get_style_margin_right(child, LV_PART_MAIN) - ofs_x;
+    ext->y2 = coords->y2 + lv_obj_get_style_margin_bottom(child, LV_PART_MAIN) - ofs_y;
+}
+
 static void scroll_x_anim(void * obj, int32_t v)
 {
     lv_obj_scroll_by_raw(obj, v + lv_obj_get_scroll_x(obj), 0);
@@ -39,6 +39,20 @@ extern "C" {
  */
 lv_result_t lv_obj_scroll_by_raw(lv_obj_t * obj, int32_t x, int32_t y);
 
+/**
+ * Drop the cached bounding box of the children of an object.
+ * Call it when a child is added, removed, hidden or made floating.
+ * @param obj       pointer to an object, can be NULL
+ */
+void lv_obj_scroll_invalidate_child_ext(lv_obj_t * obj);
+
+/**
+ * Update the cached bounding box of the children of `child`'s parent after `child` has moved or resized.
+ * @param child     pointer to a child whose coordinates have changed
+ * @param ori       the original coordinates of `child`
+ */
+void lv_obj_scroll_update_child_ext(lv_obj_t * child, const lv_area_t * ori);
+
 /**********************
  *      MACROS
  **********************/
@@ -10,6 +10,8 @@
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_draw_private.h"
+#include "lv_obj_scroll_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_color.h"
@@ -20,7 +22,9 @@
  *********************/
 #define MY_CLASS (&lv_obj_class)
 #define style_refr LV_GLOBAL_DEFAULT()->style_refresh
+#define draw_cache_stamp LV_GLOBAL_DEFAULT()->draw_cache_stamp
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
+#define style_user_index_p &(LV_GLOBAL_DEFAULT()->style_user_index)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
 
@@ -36,6 +40,14 @@ typedef struct {
     lv_style_value_t end_value;
 } trans_t;
 
+#if LV_OBJ_STYLE_USER_INDEX
+typedef struct {
+    const lv_style_t * style;
+    lv_array_t objs;            /*The `lv_obj_t *`s using the style, each only once*/
+    uint8_t prop_flags;         /*Flags of the style's properties since the last report*/
+} style_users_t;
+#endif
+
 typedef enum {
     CACHE_ZERO = 0,
     CACHE_TRUE = 1,
@@ -56,7 +68,9 @@ static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_part_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                     lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
+static void refresh_style_core(lv_obj_t * obj, lv_part_t part, uint8_t prop_flags, bool keep_layer);
 static void refresh_children_style(lv_obj_t * obj);
+static void invalidate_obj(lv_obj_t * obj, bool keep_layer);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
 static void trans_anim_start_cb(lv_anim_t * a);
@@ -66,6 +80,17 @@ static void full_cache_refresh(lv_obj_t * obj, lv_part_t part);
 static void fade_anim_cb(void * obj, int32_t v);
 static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
+static uint8_t style_get_prop_flags(const lv_style_t * style);
+#if LV_OBJ_STYLE_USER_INDEX
+    static void report_style_change_users(const lv_style_t * style);
+    static lv_rb_compare_res_t style_users_compare(const void * a, const void * b);
+    static lv_rb_node_t * style_users_find(const lv_style_t * style);
+    static void style_users_add(const lv_style_t * style, lv_obj_t * obj);
+    static void style_users_remove(const lv_style_t * style, lv_obj_t * obj, uint32_t user_idx);
+    static uint32_t obj_get_style_user_idx(const lv_obj_t * obj, const lv_style_t * style);
+    static void obj_set_style_user_idx(lv_obj_t * obj, const lv_style_t * style, uint32_t user_idx);
+    static bool obj_has_style(const lv_obj_t * obj, const lv_style_t * style);
+#endif
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
 
@@ -84,11 +109,23 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 void lv_obj_style_init(void)
 {
     lv_ll_init(style_trans_ll_p, sizeof(trans_t));
+#if LV_OBJ_STYLE_USER_INDEX
+    lv_rb_init(style_user_index_p, style_users_compare, sizeof(style_users_t));
+#endif
 }
 
 void lv_obj_style_deinit(void)
 {
     lv_ll_clear(style_trans_ll_p);
+#if LV_OBJ_STYLE_USER_INDEX
+    lv_rb_node_t * node;
+    while((node = lv_rb_minimum(style_user_index_p)) != NULL) {
+        style_users_t * users = node->data;
+        lv_array_deinit(&users->objs);
+        lv_rb_drop_node(style_user_index_p, node);
+    }
+    lv_rb_destroy(style_user_index_p);
+#endif
     if(_style_custom_prop_flag_lookup_table != NULL) {
         lv_free(_style_custom_prop_flag_lookup_table);
         _style_custom_prop_flag_lookup_table = NULL;
@@ -110,6 +147,12 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
     /*Try removing the style first to be sure it won't be added twice*/
     lv_obj_remove_style(obj, style, selector);
 
+#if LV_OBJ_STYLE_USER_INDEX
+    /*The object might use the style with an other selector too*/
+    bool had_style = style && obj_has_style(obj, style);
+    uint32_t user_idx = had_style ? obj_get_style_user_idx(obj, style) : 0;
+#endif
+
     uint32_t i;
     /*Go after the transition and local styles*/
     for(i = 0; i < obj->style_cnt; i++) {
@@ -135,6 +178,11 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
     obj->styles[i].style = style;
     obj->styles[i].selector = selector;
 
+#if LV_OBJ_STYLE_USER_INDEX
+    if(had_style) obj->styles[i].user_idx = user_idx;
+    else if(style) style_users_add(style, obj);
+#endif
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t * prop_is_set = part == LV_PART_MAIN ? &obj->style_main_prop_is_set : &obj->style_other_prop_is_set;
     if(lv_style_is_const(style)) {
@@ -168,6 +216,12 @@ bool lv_obj_replace_style(lv_obj_t * obj, const lv_style_t * old_style, const lv
     /*Similar to lv_obj_add_style, delete transition*/
     trans_delete(obj, selector, LV_STYLE_PROP_ANY, NULL);
 
+#if LV_OBJ_STYLE_USER_INDEX
+    bool had_new_style = obj_has_style(obj, new_style);
+    uint32_t new_user_idx = had_new_style ? obj_get_style_user_idx(obj, new_style) : 0;
+    uint32_t old_user_idx = obj_get_style_user_idx(obj, old_style);
+#endif
+
     bool replaced = false;
     uint32_t i;
     for(i = 0; i < obj->style_cnt; i++) {
@@ -194,6 +248,11 @@ bool lv_obj_replace_style(lv_obj_t * obj, const lv_style_t * old_style, const lv
         /*Don't break and continue replacing other occurrences*/
     }
     if(replaced) {
+#if LV_OBJ_STYLE_USER_INDEX
+        if(!obj_has_style(obj, old_style)) style_users_remove(old_style, obj, old_user_idx);
+        if(had_new_style) obj_set_style_user_idx(obj, new_style, new_user_idx);
+        else style_users_add(new_style, obj);
+#endif
         full_cache_refresh(obj, part);
         lv_obj_refresh_style(obj, part, LV_STYLE_PROP_ANY);
     }
@@ -227,6 +286,12 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
             trans_delete(obj, part, LV_STYLE_PROP_ANY, NULL);
         }
 
+#if LV_OBJ_STYLE_USER_INDEX
+        const lv_style_t * shared_style = NULL;
+        uint32_t user_idx = obj->styles[i].user_idx;
+        if(!obj->styles[i].is_local && !obj->styles[i].is_trans) shared_style = obj->styles[i].style;
+#endif
+
         if(obj->styles[i].is_local || obj->styles[i].is_trans) {
             if(obj->styles[i].style) lv_style_reset((lv_style_t *)obj->styles[i].style);
             lv_free((lv_style_t *)obj->styles[i].style);
@@ -242,6 +307,10 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
         obj->style_cnt--;
         obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
 
+#if LV_OBJ_STYLE_USER_INDEX
+        if(shared_style && !obj_has_style(obj, shared_style)) style_users_remove(shared_style, obj, user_idx);
+#endif
+
         deleted = true;
         /*The style from the current `i` index is removed, so `i` points to the next style.
          *Therefore it doesn't needs to be incremented*/
@@ -261,6 +330,13 @@ void lv_obj_remove_style_all(lv_obj_t * obj)
 void lv_obj_report_style_change(lv_style_t * style)
 {
     if(!style_refr) return;
+
+#if LV_OBJ_STYLE_USER_INDEX
+    if(style) {
+        report_style_change_users(style);
+        return;
+    }
+#endif
     lv_display_t * d = lv_display_get_next(NULL);
 
     while(d) {
@@ -278,48 +354,13 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 
     if(!style_refr) return;
 
-    LV_PROFILER_STYLE_BEGIN;
-
-    lv_obj_invalidate(obj);
-
     lv_part_t part = lv_obj_style_get_selector_part(selector);
 
-    bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYOUT_UPDATE);
-    bool is_ext_draw = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_EXT_DRAW_UPDATE);
-    bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE);
-    bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYER_UPDATE);
-
-    if(is_layout_refr) {
-        if(part == LV_PART_ANY ||
-           part == LV_PART_MAIN ||
-           lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT ||
-           lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT) {
-            lv_obj_send_event(obj, LV_EVENT_STYLE_CHANGED, NULL);
-            lv_obj_mark_layout_as_dirty(obj);
-        }
-    }
-    if((part == LV_PART_ANY || part == LV_PART_MAIN) && (prop == LV_STYLE_PROP_ANY || is_layout_refr)) {
-        lv_obj_t * parent = lv_obj_get_parent(obj);
-        if(parent) lv_obj_mark_layout_as_dirty(parent);
-    }
-
-    /*Cache the layer type*/
-    if((part == LV_PART_ANY || part == LV_PART_MAIN) && is_layer_refr) {
-        lv_obj_update_layer_type(obj);
-    }
+    /*Only the way the layer is blended changes, its rendered content can be kept*/
+    bool keep_layer = part == LV_PART_MAIN && prop != LV_STYLE_PROP_ANY &&
+                      lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYER_UPDATE);
 
-    if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
-        lv_obj_refresh_ext_draw_size(obj);
-    }
-    lv_obj_invalidate(obj);
-
-    if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
-        if(part != LV_PART_SCROLLBAR) {
-            refresh_children_style(obj);
-        }
-    }
-
-    LV_PROFILER_STYLE_END;
+    refresh_style_core(obj, part, lv_style_prop_lookup_flags(prop), keep_layer);
 }
 
 void lv_obj_enable_style_refresh(bool en)
@@ -364,7 +405,7 @@ void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_
 
     lv_style_t * style = get_local_style(obj, selector);
     if(selector == LV_PART_MAIN && lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_TRANSFORM)) {
-        lv_obj_invalidate(obj);
+        invalidate_obj(obj, lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYER_UPDATE));
     }
 
     lv_style_set_prop(style, prop, value);
@@ -777,6 +818,94 @@ static void report_style_change_core(void * style, lv_obj_t * obj)
     }
 }
 
+/**
+ * Refresh an object after the properties of some of its styles have changed
+ * @param obj           pointer to an object
+ * @param part          the part whose styles have changed or `LV_PART_ANY`
+ * @param prop_flags    the `LV_STYLE_PROP_FLAG_...` flags of the changed properties
+ * @param keep_layer    true: keep the cached layer of the object as only its blending has changed
+ */
+static void refresh_style_core(lv_obj_t * obj, lv_part_t part, uint8_t prop_flags, bool keep_layer)
+{
+    /*It will be refreshed at the end of the parent's children batch*/
+    if(obj->batch_new) return;
+
+    LV_PROFILER_STYLE_BEGIN;
+
+#if LV_OBJ_DRAW_LIST_CACHE
+    /*Inherited and recursive properties (e.g. opa) can affect the recordings of the children too*/
+    draw_cache_stamp++;
+#endif
+
+    bool is_layout_refr = prop_flags & LV_STYLE_PROP_FLAG_LAYOUT_UPDATE;
+    bool is_ext_draw = prop_flags & LV_STYLE_PROP_FLAG_EXT_DRAW_UPDATE;
+    bool is_inheritable = prop_flags & LV_STYLE_PROP_FLAG_INHERITABLE;
+    bool is_layer_refr = prop_flags & LV_STYLE_PROP_FLAG_LAYER_UPDATE;
+
+    invalidate_obj(obj, keep_layer);
+
+    if(is_layout_refr) {
+        if(part == LV_PART_ANY ||
+           part == LV_PART_MAIN ||
+           lv_obj_get_style_height(obj, 0) == LV_SIZE_CONTENT ||
+           lv_obj_get_style_width(obj, 0) == LV_SIZE_CONTENT) {
+            lv_obj_send_event(obj, LV_EVENT_STYLE_CHANGED, NULL);
+            lv_obj_mark_layout_as_dirty(obj);
+        }
+
+        if(part == LV_PART_ANY || part == LV_PART_MAIN) {
+            lv_obj_t * parent = lv_obj_get_parent(obj);
+            if(parent) {
+                lv_obj_mark_layout_as_dirty(parent);
+                /*The margins might have changed*/
+                lv_obj_scroll_invalidate_child_ext(parent);
+            }
+        }
+    }
+
+    /*Cache the layer type*/
+    if((part == LV_PART_ANY || part == LV_PART_MAIN) && is_layer_refr) {
+        lv_obj_update_layer_type(obj);
+    }
+
+    if(is_ext_draw) {
+        lv_obj_refresh_ext_draw_size(obj);
+    }
+    invalidate_obj(obj, keep_layer);
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+    /*The children might have rendered the inherited value into their cached layers*/
+    if(is_inheritable && part != LV_PART_SCROLLBAR) {
+        lv_obj_layer_cache_invalidate_children(obj);
+    }
+#endif
+
+    if(is_inheritable && (is_ext_draw || is_layout_refr)) {
+        if(part != LV_PART_SCROLLBAR) {
+            refresh_children_style(obj);
+        }
+    }
+
+    LV_PROFILER_STYLE_END;
+}
+
+/**
+ * Invalidate an object
+ * @param obj           pointer to an object
+ * @param keep_layer    true: keep the cached layer of the object as only its blending has changed
+ */
+static void invalidate_obj(lv_obj_t * obj, bool keep_layer)
+{
+#if LV_OBJ_LAYER_CACHE_SIZE
+    if(keep_layer) lv_obj_layer_cache_keep(obj);
+    lv_obj_invalidate(obj);
+    if(keep_layer) lv_obj_layer_cache_keep(NULL);
+#else
+    LV_UNUSED(keep_layer);
+    lv_obj_invalidate(obj);
+#endif
+}
+
 /**
  * Recursively refresh the style of the children. Go deeper until a not NULL style is found
  * because the NULL styles are inherited from the parent
@@ -1039,27 +1168,184 @@ static void fade_in_anim_completed(lv_anim_t * a)
 
 static bool style_has_flag(const lv_style_t * style, uint32_t flag)
 {
+    return (style_get_prop_flags(style) & flag) != 0;
+}
+
+/**
+ * Get the union of the flags of the properties of a style
+ * @param style     pointer to a style
+ * @return          the `LV_STYLE_PROP_FLAG_...` flags
+ */
+static uint8_t style_get_prop_flags(const lv_style_t * style)
+{
+    uint8_t flags = 0;
+    uint32_t i;
     if(lv_style_is_const(style)) {
         lv_style_const_prop_t * props = style->values_and_props;
-        uint32_t i;
         for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
-            if(lv_style_prop_has_flag(props[i].prop, flag)) {
-                return true;
-            }
+            flags |= lv_style_prop_lookup_flags(props[i].prop);
         }
     }
     else {
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        uint32_t i;
         for(i = 0; i < style->prop_cnt; i++) {
-            if(lv_style_prop_has_flag(props[i], flag)) {
-                return true;
+            flags |= lv_style_prop_lookup_flags(props[i]);
+        }
+    }
+    return flags;
+}
+
+#if LV_OBJ_STYLE_USER_INDEX
+
+/**
+ * Refresh only the objects using a style and only as much as its properties require
+ * @param style     pointer to a style
+ */
+static void report_style_change_users(const lv_style_t * style)
+{
+    lv_rb_node_t * node = style_users_find(style);
+    if(node == NULL) return;
+
+    LV_PROFILER_STYLE_BEGIN;
+
+    /*The properties removed since the last report might have changed too*/
+    style_users_t * users = node->data;
+    uint8_t style_flags = style_get_prop_flags(style);
+    uint8_t prop_flags = users->prop_flags | style_flags;
+    users->prop_flags = style_flags;
+
+    /*The event handlers can add or remove styles so look up the users again for each object.
+     *A removed user is replaced by the last one, so go from the end: this way the objects not visited
+     *yet stay below `i` and at most an already visited object is refreshed again*/
+    uint32_t i = lv_array_size(&users->objs);
+    while(node != NULL) {
+        users = node->data;
+        uint32_t size = lv_array_size(&users->objs);
+        if(i > size) i = size;
+        if(i == 0) break;
+        i--;
+
+        lv_obj_t * obj = *(lv_obj_t **)lv_array_at(&users->objs, i);
+        uint32_t j;
+        for(j = 0; j < obj->style_cnt; j++) {
+            if(obj->styles[j].style == style) {
+                full_cache_refresh(obj, lv_obj_style_get_selector_part(obj->styles[j].selector));
             }
         }
+
+        refresh_style_core(obj, LV_PART_ANY, prop_flags, false);
+        node = style_users_find(style);
+    }
+
+    LV_PROFILER_STYLE_END;
+}
+
+static lv_rb_compare_res_t style_users_compare(const void * a, const void * b)
+{
+    const lv_style_t * style_a = ((const style_users_t *)a)->style;
+    const lv_style_t * style_b = ((const style_users_t *)b)->style;
+
+    if(style_a == style_b) return 0;
+    return style_a < style_b ? -1 : 1;
+}
+
+static lv_rb_node_t * style_users_find(const lv_style_t * style)
+{
+    style_users_t key;
+    key.style = style;
+    return lv_rb_find(style_user_index_p, &key);
+}
+
+static void style_users_add(const lv_style_t * style, lv_obj_t * obj)
+{
+    lv_rb_node_t * node = style_users_find(style);
+    if(node == NULL) {
+        style_users_t key;
+        key.style = style;
+        node = lv_rb_insert(style_user_index_p, &key);
+        LV_ASSERT_MALLOC(node);
+        if(node == NULL) return;
+
+        style_users_t * users = node->data;
+        users->style = style;
+        users->prop_flags = 0;
+        lv_array_init(&users->objs, 4, sizeof(lv_obj_t *));
+    }
+
+    style_users_t * users = node->data;
+    users->prop_flags |= style_get_prop_flags(style);
+
+    /*Grow geometrically as the styles of the themes are used by most objects*/
+    if(lv_array_is_full(&users->objs)) {
+        lv_array_resize(&users->objs, lv_array_capacity(&users->objs) * 2);
+    }
+    lv_array_push_back(&users->objs, &obj);
+    obj_set_style_user_idx(obj, style, lv_array_size(&users->objs) - 1);
+}
+
+static void style_users_remove(const lv_style_t * style, lv_obj_t * obj, uint32_t user_idx)
+{
+    lv_rb_node_t * node = style_users_find(style);
+    if(node == NULL) return;
+
+    style_users_t * users = node->data;
+    uint32_t last = lv_array_size(&users->objs) - 1;
+    LV_ASSERT(user_idx <= last);
+    LV_ASSERT(*(lv_obj_t **)lv_array_at(&users->objs, user_idx) == obj);
+    LV_UNUSED(obj);
+
+    /*Move the last user to the place of the removed one to unlink it in O(1)*/
+    if(user_idx != last) {
+        lv_obj_t * moved = *(lv_obj_t **)lv_array_at(&users->objs, last);
+        lv_array_assign(&users->objs, user_idx, &moved);
+        obj_set_style_user_idx(moved, style, user_idx);
+    }
+    lv_array_remove(&users->objs, last);
+
+    if(lv_array_is_empty(&users->objs)) {
+        lv_array_deinit(&users->objs);
+        lv_rb_drop_node(style_user_index_p, node);
+    }
+}
+
+static bool obj_has_style(const lv_obj_t * obj, const lv_style_t * style)
+{
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        if(obj->styles[i].style == style) return true;
     }
     return false;
 }
 
+static uint32_t obj_get_style_user_idx(const lv_obj_t * obj, const lv_style_t * style)
+{
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        if(obj->styles[i].style == style && !obj->styles[i].is_local && !obj->styles[i].is_trans) {
+            return obj->styles[i].user_idx;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Store the index of the object among the users of a style in every entry of the style
+ * @param obj       pointer to an object
+ * @param style     pointer to a shared style of the object
+ * @param user_idx  index of `obj` in the users of `style`
+ */
+static void obj_set_style_user_idx(lv_obj_t * obj, const lv_style_t * style, uint32_t user_idx)
+{
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        if(obj->styles[i].style == style && !obj->styles[i].is_local && !obj->styles[i].is_trans) {
+            obj->styles[i].user_idx = user_idx;
+        }
+    }
+}
+
+#endif /*LV_OBJ_STYLE_USER_INDEX*/
+
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act)
 {
@@ -94,7 +94,9 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
 void lv_obj_remove_style_all(lv_obj_t * obj);
 
 /**
- * Notify all object if a style is modified
+ * Notify all object if a style is modified.
+ * With `LV_OBJ_STYLE_USER_INDEX` only the objects using the style are visited and they are
+ * refreshed only as much as the style's current and removed properties require.
  * @param style     pointer to a style. Only the objects with this style will be notified
  *                  (NULL to notify all objects)
  */
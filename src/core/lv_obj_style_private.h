@@ -29,6 +29,9 @@ struct _lv_obj_style_t {
     uint32_t selector : 24;
     uint32_t is_local : 1;
     uint32_t is_trans : 1;
+#if LV_OBJ_STYLE_USER_INDEX
+    uint32_t user_idx;      /*Index of the object among the users of the style (only for shared styles)*/
+#endif
 };
 
 struct _lv_obj_style_transition_dsc_t {
@@ -8,6 +8,8 @@
  *********************/
 #include "lv_obj_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_scroll_private.h"
+#include "lv_obj_tree_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display.h"
@@ -36,6 +38,8 @@ static void obj_delete_core(lv_obj_t * obj);
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data);
 static void dump_tree_core(lv_obj_t * obj, int32_t depth);
 static lv_obj_t * lv_obj_get_first_not_deleting_child(lv_obj_t * obj);
+static bool children_resize(lv_obj_t * parent, uint32_t capacity);
+static void children_shrink(lv_obj_t * parent);
 
 /**********************
  *  STATIC VARIABLES
@@ -70,8 +74,9 @@ void lv_obj_delete(lv_obj_t * obj)
 
     obj_delete_core(obj);
 
-    /*Call the ancestor's event handler to the parent to notify it about the child delete*/
-    if(par && !par->is_deleting) {
+    /*Call the ancestor's event handler to the parent to notify it about the child delete.
+     *In a batch the parent is notified only once at the end.*/
+    if(par && !par->is_deleting && !lv_obj_is_in_children_batch(par)) {
         lv_obj_scrollbar_invalidate(par);
         lv_obj_send_event(par, LV_EVENT_CHILD_CHANGED, NULL);
         lv_obj_send_event(par, LV_EVENT_CHILD_DELETED, NULL);
@@ -94,6 +99,7 @@ void lv_obj_clean(lv_obj_t * obj)
 
     lv_obj_invalidate(obj);
 
+    /*Delete from the oldest child to send `LV_EVENT_DELETE` in the order of creation*/
     uint32_t cnt = lv_obj_get_child_count(obj);
     lv_obj_t * child = lv_obj_get_first_not_deleting_child(obj);
     while(child) {
@@ -106,6 +112,7 @@ void lv_obj_clean(lv_obj_t * obj)
         obj->spec_attr->scroll.x = 0;
         obj->spec_attr->scroll.y = 0;
     }
+    lv_obj_scroll_invalidate_child_ext(obj);
 
     if(lv_obj_get_child_count(obj) < cnt) {
         lv_obj_send_event(obj, LV_EVENT_CHILD_CHANGED, NULL);
@@ -117,6 +124,118 @@ void lv_obj_clean(lv_obj_t * obj)
     LV_LOG_TRACE("finished (clean %p)", (void *)obj);
 }
 
+void lv_obj_children_batch_begin(lv_obj_t * parent, uint32_t cnt_hint)
+{
+    LV_ASSERT_OBJ(parent, MY_CLASS);
+
+    lv_obj_allocate_spec_attr(parent);
+    lv_obj_spec_attr_t * spec_attr = parent->spec_attr;
+    if(spec_attr->child_batch) {
+        LV_LOG_WARN("A batch is already started on this object");
+        return;
+    }
+
+    spec_attr->child_batch = 1;
+    spec_attr->child_batch_deleted = 0;
+
+    uint32_t capacity = LV_MIN(spec_attr->child_cnt + cnt_hint, UINT16_MAX);
+    if(capacity > spec_attr->child_capacity) children_resize(parent, capacity);
+}
+
+void lv_obj_children_batch_end(lv_obj_t * parent)
+{
+    LV_ASSERT_OBJ(parent, MY_CLASS);
+
+    lv_obj_spec_attr_t * spec_attr = parent->spec_attr;
+    if(spec_attr == NULL || !spec_attr->child_batch) {
+        LV_LOG_WARN("No batch was started on this object");
+        return;
+    }
+
+    LV_PROFILER_BEGIN;
+    spec_attr->child_batch = 0;
+
+    /*The new children could be moved anywhere with `lv_obj_move_to_index()` so check all*/
+    bool created = false;
+    uint32_t i;
+    for(i = 0; i < spec_attr->child_cnt; i++) {
+        lv_obj_t * child = spec_attr->children[i];
+        if(!child->batch_new) continue;
+
+        child->batch_new = 0;
+        lv_obj_refresh_style(child, LV_PART_ANY, LV_STYLE_PROP_ANY);
+        lv_obj_refresh_self_size(child);
+        created = true;
+    }
+
+    bool deleted = spec_attr->child_batch_deleted;
+    if(deleted) {
+        spec_attr->child_batch_deleted = 0;
+        children_shrink(parent);
+    }
+
+    if(created || deleted) {
+        lv_obj_mark_layout_as_dirty(parent);
+        lv_obj_scroll_invalidate_child_ext(parent);
+        lv_obj_scrollbar_invalidate(parent);
+        lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
+        if(created) lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, NULL);
+        if(deleted) lv_obj_send_event(parent, LV_EVENT_CHILD_DELETED, NULL);
+    }
+
+    LV_PROFILER_END;
+}
+
+lv_result_t lv_obj_children_append(lv_obj_t * parent, lv_obj_t * child)
+{
+    lv_obj_spec_attr_t * spec_attr = parent->spec_attr;
+    if(spec_attr->child_cnt == spec_attr->child_capacity) {
+        if(spec_attr->child_capacity == UINT16_MAX) {
+            LV_LOG_WARN("Too many children");
+            return LV_RESULT_INVALID;
+        }
+
+        uint32_t capacity = spec_attr->child_capacity ? spec_attr->child_capacity * 2 : 1;
+        if(!children_resize(parent, LV_MIN(capacity, UINT16_MAX))) return LV_RESULT_INVALID;
+    }
+
+    spec_attr->children[spec_attr->child_cnt] = child;
+    spec_attr->child_cnt++;
+
+    return LV_RESULT_OK;
+}
+
+void lv_obj_children_remove(lv_obj_t * parent, lv_obj_t * child)
+{
+    lv_obj_spec_attr_t * spec_attr = parent->spec_attr;
+
+    /*Cleaning deletes the oldest child, else usually the youngest children are deleted*/
+    int32_t i = 0;
+    if(spec_attr->children[0] != child) {
+        for(i = (int32_t)spec_attr->child_cnt - 1; i >= 0; i--) {
+            if(spec_attr->children[i] == child) break;
+        }
+        if(i < 0) return;
+    }
+
+    lv_memmove(&spec_attr->children[i], &spec_attr->children[i + 1],
+               (spec_attr->child_cnt - i - 1) * sizeof(lv_obj_t *));
+    spec_attr->child_cnt--;
+
+    if(spec_attr->child_batch) {
+        /*Shrink only once at the end of the batch*/
+        spec_attr->child_batch_deleted = 1;
+        return;
+    }
+
+    children_shrink(parent);
+}
+
+bool lv_obj_is_in_children_batch(const lv_obj_t * obj)
+{
+    return obj->spec_attr && obj->spec_attr->child_batch;
+}
+
 void lv_obj_delete_delayed(lv_obj_t * obj, uint32_t delay_ms)
 {
     lv_anim_t a;
@@ -164,29 +283,23 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     lv_obj_allocate_spec_attr(parent);
 
     lv_obj_t * old_parent = obj->parent;
-    /*Remove the object from the old parent's child list*/
-    int32_t i;
-    for(i = lv_obj_get_index(obj); i <= (int32_t)lv_obj_get_child_count(old_parent) - 2; i++) {
-        old_parent->spec_attr->children[i] = old_parent->spec_attr->children[i + 1];
-    }
-    old_parent->spec_attr->child_cnt--;
-    if(old_parent->spec_attr->child_cnt) {
-        old_parent->spec_attr->children = lv_realloc(old_parent->spec_attr->children,
-                                                     old_parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
-    }
-    else {
-        lv_free(old_parent->spec_attr->children);
-        old_parent->spec_attr->children = NULL;
-    }
 
     /*Add the child to the new parent as the last (newest child)*/
-    parent->spec_attr->child_cnt++;
-    parent->spec_attr->children = lv_realloc(parent->spec_attr->children,
-                                             parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
-    parent->spec_attr->children[lv_obj_get_child_count(parent) - 1] = obj;
+    if(lv_obj_children_append(parent, obj) != LV_RESULT_OK) return;
+
+    /*Remove the object from the old parent's child list*/
+    lv_obj_children_remove(old_parent, obj);
 
     obj->parent = parent;
 
+    /*It won't be refreshed at the end of the old parent's batch*/
+    if(obj->batch_new) {
+        obj->batch_new = 0;
+        lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
+    }
+    lv_obj_scroll_invalidate_child_ext(old_parent);
+    lv_obj_scroll_invalidate_child_ext(parent);
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
     lv_obj_send_event(old_parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -555,7 +668,9 @@ static void obj_delete_core(lv_obj_t * obj)
         async_cancel_res = lv_async_call_cancel(lv_obj_delete_async_cb, obj);
     }
 
-    /*All children deleted. Now clean up the object specific data*/
+    /*All children deleted. Now clean up the object specific data.
+     *Save the class as the destructors change it to the base classes.*/
+    const lv_obj_class_t * class_p = obj->class_p;
     lv_obj_destruct(obj);
 
     /*Remove the screen for the screen list*/
@@ -576,18 +691,12 @@ static void obj_delete_core(lv_obj_t * obj)
     }
     /*Remove the object from the child list of its parent*/
     else {
-        int32_t id = lv_obj_get_index(obj);
-        uint16_t i;
-        for(i = id; i < obj->parent->spec_attr->child_cnt - 1; i++) {
-            obj->parent->spec_attr->children[i] = obj->parent->spec_attr->children[i + 1];
-        }
-        obj->parent->spec_attr->child_cnt--;
-        obj->parent->spec_attr->children = lv_realloc(obj->parent->spec_attr->children,
-                                                      obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
+        lv_obj_children_remove(obj->parent, obj);
+        lv_obj_scroll_invalidate_child_ext(obj->parent);
     }
 
     /*Free the object itself*/
-    lv_free(obj);
+    lv_obj_class_free_obj(class_p, obj);
 }
 
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data)
@@ -660,3 +769,34 @@ static lv_obj_t * lv_obj_get_first_not_deleting_child(lv_obj_t * obj)
 
     return NULL;
 }
+
+static bool children_resize(lv_obj_t * parent, uint32_t capacity)
+{
+    lv_obj_spec_attr_t * spec_attr = parent->spec_attr;
+    if(capacity == 0) {
+        lv_free(spec_attr->children);
+        spec_attr->children = NULL;
+        spec_attr->child_capacity = 0;
+        return true;
+    }
+
+    lv_obj_t ** children = lv_realloc(spec_attr->children, capacity * sizeof(lv_obj_t *));
+    LV_ASSERT_MALLOC(children);
+    if(children == NULL) return false;
+
+    spec_attr->children = children;
+    spec_attr->child_capacity = capacity;
+    return true;
+}
+
+static void children_shrink(lv_obj_t * parent)
+{
+    lv_obj_spec_attr_t * spec_attr = parent->spec_attr;
+
+    /*Leave room to grow to avoid reallocating back and forth around the same size*/
+    uint32_t capacity = spec_attr->child_capacity;
+    while(capacity > 1 && spec_attr->child_cnt <= capacity / 4) capacity /= 2;
+    if(spec_attr->child_cnt == 0) capacity = 0;
+
+    if(capacity != spec_attr->child_capacity) children_resize(parent, capacity);
+}
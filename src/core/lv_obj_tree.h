@@ -53,6 +53,23 @@ void lv_obj_delete(lv_obj_t * obj);
  */
 void lv_obj_clean(lv_obj_t * obj);
 
+/**
+ * Start adding or deleting many children of an object at once.
+ * Until `lv_obj_children_batch_end()` the parent is not notified about the
+ * individual children and the style of the new children is not refreshed.
+ * @param parent    pointer to an object
+ * @param cnt_hint  number of children expected to be added, used to reserve space for them. Can be 0.
+ */
+void lv_obj_children_batch_begin(lv_obj_t * parent, uint32_t cnt_hint);
+
+/**
+ * Finish a batch started with `lv_obj_children_batch_begin()`.
+ * Refresh the style of the new children and send a single `LV_EVENT_CHILD_CHANGED`,
+ * `LV_EVENT_CHILD_CREATED` and/or `LV_EVENT_CHILD_DELETED` to the parent.
+ * @param parent    pointer to an object
+ */
+void lv_obj_children_batch_end(lv_obj_t * parent);
+
 /**
  * Delete an object after some delay
  * @param obj       pointer to an object
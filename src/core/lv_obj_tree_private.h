@@ -0,0 +1,63 @@
+/**
+ * @file lv_obj_tree_private.h
+ *
+ */
+
+#ifndef LV_OBJ_TREE_PRIVATE_H
+#define LV_OBJ_TREE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj_tree.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Add a child to the end of the children array of an object.
+ * The array grows geometrically so adding many children is not quadratic.
+ * @param parent    pointer to an object with allocated `spec_attr`
+ * @param child     the child to add
+ * @return          `LV_RESULT_OK`: added; `LV_RESULT_INVALID`: out of memory or too many children
+ */
+lv_result_t lv_obj_children_append(lv_obj_t * parent, lv_obj_t * child);
+
+/**
+ * Remove a child from the children array of an object.
+ * The array is shrunk only if most of it is unused, or at the end of a batch.
+ * @param parent    pointer to an object
+ * @param child     the child to remove
+ */
+void lv_obj_children_remove(lv_obj_t * parent, lv_obj_t * child);
+
+/**
+ * Tell whether the children of an object are being added or deleted in a batch.
+ * @param obj       pointer to an object
+ * @return          true: `lv_obj_children_batch_begin()` was called but not `lv_obj_children_batch_end()` yet
+ */
+bool lv_obj_is_in_children_batch(const lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_TREE_PRIVATE_H*/
@@ -17,21 +17,33 @@
 #include "../display/lv_display_private.h"
 #include "../tick/lv_tick.h"
 #include "../misc/lv_timer_private.h"
+#include "../misc/lv_anim_private.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_profiler.h"
 #include "../misc/lv_types.h"
 #include "../draw/lv_draw_private.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../stdlib/lv_string.h"
+#include "../others/observer/lv_observer.h"
 #include "lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 
+/*Start a new band in delta flushing if there are more unchanged rows than this since the last changed row*/
+#define FLUSH_DELTA_BAND_GAP    8
+
+/*Finish rendering this much before the vsync to tolerate the jitter of the render time*/
+#define FRAME_SCHED_MARGIN_US   1000
+
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
 
+#if LV_USE_DISPLAY_RENDER_THREAD && LV_USE_OS == LV_OS_NONE
+    #error "LV_USE_DISPLAY_RENDER_THREAD requires an OS (LV_USE_OS)"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -39,18 +51,44 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void refr_display(lv_timer_t * tmr, bool sched);
+static bool frame_sched_delay(lv_display_t * disp, lv_timer_t * tmr);
+static void frame_sched_render_ready(lv_display_t * disp);
 static void lv_refr_join_area(void);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
+static void refr_parts(int32_t last_i);
+static void refr_part(const lv_area_t * area_p);
 static void refr_area(const lv_area_t * area_p);
+static void layer_set_area(lv_display_t * disp, lv_layer_t * layer, const lv_area_t * area_p);
 static void refr_configured_layer(lv_layer_t * layer);
+static void refr_layer_objs(lv_layer_t * layer);
+#if LV_DRAW_TILE_SIZE
+    static lv_draw_task_t * record_configured_layer(lv_layer_t * layer, bool * recorded);
+#endif
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj);
+static void layer_draw_dsc_init(lv_obj_t * obj, lv_draw_image_dsc_t * dsc, lv_opa_t opa, const lv_area_t * buf_area,
+                                const lv_area_t * obj_draw_size);
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
+static lv_result_t convert_for_flush(lv_display_t * disp, const lv_area_t * area, uint8_t ** px_map);
+static void flush_delta_check_period(lv_display_t * disp);
+static void flush_delta(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map, lv_color_format_t cf,
+                        uint32_t stride);
+static void flush_delta_band(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map, lv_color_format_t cf,
+                             uint32_t stride, const lv_area_t * band, bool first);
+static uint32_t hash_pixels(const uint8_t * buf, uint32_t len);
+#if LV_USE_DISPLAY_RENDER_THREAD
+    static void render_thread_record_part(lv_display_render_thread_t * rt, const lv_area_t * area_p);
+    static void render_thread_render_part(lv_display_t * disp, lv_display_render_part_t * part);
+    static void render_thread_free_parts(lv_display_render_thread_t * rt);
+    static void render_thread_wait(lv_display_t * disp);
+    static void render_thread_cb(void * ptr);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -85,15 +123,28 @@ void lv_refr_now(lv_display_t * disp)
     lv_anim_refr_now();
 
     if(disp) {
-        if(disp->refr_timer) lv_display_refr_timer(disp->refr_timer);
+#if LV_USE_DISPLAY_RENDER_THREAD
+        /*Finish the previous frame to refresh now and wait for the new one too*/
+        render_thread_wait(disp);
+        if(disp->refr_timer) refr_display(disp->refr_timer, false);
+        render_thread_wait(disp);
+#else
+        if(disp->refr_timer) refr_display(disp->refr_timer, false);
+#endif
     }
     else {
         lv_display_t * d;
         d = lv_display_get_next(NULL);
         while(d) {
-            if(d->refr_timer) lv_display_refr_timer(d->refr_timer);
+#if LV_USE_DISPLAY_RENDER_THREAD
+            render_thread_wait(d);
+#endif
+            if(d->refr_timer) refr_display(d->refr_timer, false);
             d = lv_display_get_next(d);
         }
+#if LV_USE_DISPLAY_RENDER_THREAD
+        LV_LL_READ(&LV_GLOBAL_DEFAULT()->disp_ll, d) render_thread_wait(d);
+#endif
     }
 }
 
@@ -109,6 +160,11 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     lv_area_increase(&obj_coords_ext, ext_draw_size, ext_draw_size);
 
     if(!lv_area_intersect(&clip_coords_for_obj, &clip_area_ori, &obj_coords_ext)) return;
+
+#if LV_OBJ_DRAW_LIST_CACHE
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHE_DRAW_LIST) && lv_obj_draw_cache_replay(layer, obj)) return;
+#endif
+
     /*If the object is visible on the current clip area*/
     layer->_clip_area = clip_coords_for_obj;
 
@@ -298,6 +354,13 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
         com_area.x2 |= 0x7;    /*Round up: Nx8 - 1*/
     }
 
+    /*Delta flushing compares whole blocks so invalidate whole blocks*/
+    if(disp->flush_delta_block_w) {
+        int32_t block_w = disp->flush_delta_block_w;
+        com_area.x1 -= com_area.x1 % block_w;
+        com_area.x2 = LV_MIN(com_area.x2 - com_area.x2 % block_w + block_w - 1, scr_area.x2);
+    }
+
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
         disp->inv_areas[0] = scr_area;
@@ -346,12 +409,96 @@ void lv_refr_set_disp_refreshing(lv_display_t * disp)
 }
 
 void lv_display_refr_timer(lv_timer_t * tmr)
+{
+    refr_display(tmr, true);
+}
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+lv_result_t lv_refr_render_thread_create(lv_display_t * disp)
+{
+    LV_ASSERT_NULL(disp);
+    if(disp->render_thread) return LV_RESULT_OK;
+
+#if LV_USE_DRAW_SDL || LV_USE_DRAW_OPENGLES
+    /*These draw units render on the calling thread with a context bound to the LVGL thread
+     *and create draw tasks while rendering, which would race with recording the next frame*/
+    LV_LOG_WARN("The SDL and OpenGL ES draw units can't be used with render threads");
+    return LV_RESULT_INVALID;
+#endif
+
+    lv_display_render_thread_t * rt = lv_malloc_zeroed(sizeof(lv_display_render_thread_t));
+    LV_ASSERT_MALLOC(rt);
+    if(rt == NULL) return LV_RESULT_INVALID;
+
+    lv_thread_sync_init(&rt->sync);
+    lv_thread_sync_init(&rt->done_sync);
+    lv_draw_add_dispatch_sync(&rt->sync);
+    disp->render_thread = rt;
+
+    if(lv_thread_init(&rt->thread, LV_THREAD_PRIO_HIGH, render_thread_cb, LV_DRAW_THREAD_STACK_SIZE,
+                      disp) != LV_RESULT_OK) {
+        LV_LOG_WARN("Couldn't create the render thread of the display");
+        disp->render_thread = NULL;
+        lv_draw_remove_dispatch_sync(&rt->sync);
+        lv_thread_sync_delete(&rt->sync);
+        lv_thread_sync_delete(&rt->done_sync);
+        lv_free(rt);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+void lv_refr_render_thread_delete(lv_display_t * disp)
+{
+    LV_ASSERT_NULL(disp);
+    lv_display_render_thread_t * rt = disp->render_thread;
+    if(rt == NULL) return;
+
+    render_thread_wait(disp);
+
+    lv_atomic_store(&rt->exit, 1);
+    lv_thread_sync_signal(&rt->sync);
+    lv_thread_delete(&rt->thread);
+
+    lv_draw_remove_dispatch_sync(&rt->sync);
+    lv_thread_sync_delete(&rt->sync);
+    lv_thread_sync_delete(&rt->done_sync);
+    lv_free(rt->parts);
+    lv_free(rt);
+    disp->render_thread = NULL;
+}
+#endif
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Refresh a display
+ * @param tmr       the refresh timer of the display or NULL to refresh the default display
+ * @param sched     true: align rendering to the vsyncs of the display if they are reported
+ */
+static void refr_display(lv_timer_t * tmr, bool sched)
 {
     LV_PROFILER_REFR_BEGIN;
     LV_TRACE_REFR("begin");
 
     if(tmr) {
         disp_refr = tmr->user_data;
+#if LV_USE_DISPLAY_RENDER_THREAD
+        /*The previous frame is still being rendered. Keep the timer running to try again later.*/
+        if(disp_refr->render_thread && lv_atomic_load(&disp_refr->render_thread->busy)) {
+            LV_PROFILER_REFR_END;
+            return;
+        }
+#endif
+        /*Wait until rendering can be finished just before the next vsync*/
+        if(sched && frame_sched_delay(disp_refr, tmr)) {
+            LV_PROFILER_REFR_END;
+            return;
+        }
+
         /* Ensure the timer does not run again automatically.
          * This is done before refreshing in case refreshing invalidates something else.
          * However if the performance monitor is enabled keep the timer running to count the FPS.*/
@@ -376,8 +523,14 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         return;
     }
 
+    disp_refr->render_start = lv_tick_get();
     lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
 
+#if LV_USE_OBSERVER
+    /*Apply the coalesced changes of the subjects before the layout*/
+    lv_subject_notify_deferred();
+#endif
+
     /*Refresh the screen's layout if required*/
     LV_PROFILER_LAYOUT_BEGIN_TAG("layout");
     lv_obj_update_layout(disp_refr->act_scr);
@@ -395,15 +548,16 @@ void lv_display_refr_timer(lv_timer_t * tmr)
         goto refr_finish;
     }
 
+    if(disp_refr->flush_delta_block_w && disp_refr->inv_p) {
+        flush_delta_check_period(disp_refr);
+    }
+
     lv_refr_join_area();
     refr_sync_areas();
     refr_invalid_areas();
 
     if(disp_refr->inv_p == 0) goto refr_finish;
 
-    /*If refresh happened ...*/
-    lv_display_send_event(disp_refr, LV_EVENT_RENDER_READY, NULL);
-
     /*In double buffered direct mode save the updated areas.
      *They will be used on the next call to synchronize the buffers.*/
     if(lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
@@ -433,10 +587,6 @@ refr_finish:
     LV_PROFILER_REFR_END;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
 /**
  * Join the areas which has got common parts
  */
@@ -562,6 +712,8 @@ static void refr_invalid_areas(void)
     if(disp_refr->inv_p == 0) return;
     LV_PROFILER_REFR_BEGIN;
 
+    lv_memzero(&disp_refr->flush_delta_stats, sizeof(disp_refr->flush_delta_stats));
+
     /*Find the last area which will be drawn*/
     int32_t i;
     int32_t last_i = 0;
@@ -579,6 +731,52 @@ static void refr_invalid_areas(void)
     disp_refr->last_part = 0;
     disp_refr->rendering_in_progress = true;
 
+#if LV_OBJ_LAYER_CACHE_SIZE
+    LV_GLOBAL_DEFAULT()->layer_cache_frame++;
+#endif
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+    lv_display_render_thread_t * rt = disp_refr->render_thread;
+    if(rt) {
+        /*Only record the draw tasks of the parts here and let the display's thread render them*/
+        rt->recording = true;
+        rt->record_failed = false;
+        refr_parts(last_i);
+        rt->recording = false;
+
+        if(!rt->record_failed) {
+            disp_refr->rendering_in_progress = false;
+            lv_atomic_store(&rt->busy, 1);
+            lv_thread_sync_signal(&rt->sync);
+            LV_PROFILER_REFR_END;
+            return;
+        }
+
+        LV_LOG_INFO("The draw tasks can't be recorded, rendering the frame without the render thread");
+        render_thread_free_parts(rt);
+    }
+#endif
+
+    refr_parts(last_i);
+
+    disp_refr->rendering_in_progress = false;
+
+    /*If refresh happened ...*/
+    frame_sched_render_ready(disp_refr);
+    lv_display_send_event(disp_refr, LV_EVENT_RENDER_READY, NULL);
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Split the not joined invalid areas to parts which fit into the buffer and refresh them
+ * @param last_i    index of the last not joined area
+ */
+static void refr_parts(int32_t last_i)
+{
+    disp_refr->last_area = 0;
+    disp_refr->last_part = 0;
+
+    int32_t i;
     for(i = 0; i < (int32_t)disp_refr->inv_p; i++) {
         /*Refresh the unjoined areas*/
         if(disp_refr->inv_area_joined[i]) continue;
@@ -606,8 +804,7 @@ static void refr_invalid_areas(void)
                 if(sub_area.y2 > inv_a.y2) sub_area.y2 = inv_a.y2;
                 row_last = sub_area.y2;
                 if(inv_a.y2 == row_last) disp_refr->last_part = 1;
-                refr_area(&sub_area);
-                draw_buf_flush(disp_refr);
+                refr_part(&sub_area);
             }
 
             /*If the last y coordinates are not handled yet ...*/
@@ -616,20 +813,32 @@ static void refr_invalid_areas(void)
                 sub_area.y1 = row;
                 sub_area.y2 = inv_a.y2;
                 disp_refr->last_part = 1;
-                refr_area(&sub_area);
-                draw_buf_flush(disp_refr);
+                refr_part(&sub_area);
             }
         }
         else if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_FULL ||
                 disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
             disp_refr->last_part = 1;
-            refr_area(&disp_refr->inv_areas[i]);
-            draw_buf_flush(disp_refr);
+            refr_part(&disp_refr->inv_areas[i]);
         }
     }
+}
 
-    disp_refr->rendering_in_progress = false;
-    LV_PROFILER_REFR_END;
+/**
+ * Render and flush a part of an invalidated area
+ * @param area_p  pointer to the area to refresh
+ */
+static void refr_part(const lv_area_t * area_p)
+{
+#if LV_USE_DISPLAY_RENDER_THREAD
+    if(disp_refr->render_thread && disp_refr->render_thread->recording) {
+        render_thread_record_part(disp_refr->render_thread, area_p);
+        return;
+    }
+#endif
+
+    refr_area(area_p);
+    draw_buf_flush(disp_refr);
 }
 
 /**
@@ -656,33 +865,11 @@ static void refr_area(const lv_area_t * area_p)
 {
     LV_PROFILER_REFR_BEGIN;
     lv_layer_t * layer = disp_refr->layer_head;
-    layer->draw_buf = disp_refr->buf_act;
-    layer->_clip_area = *area_p;
-    layer->phy_clip_area = *area_p;
-
-    if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
-        /*In full mode the area is always the full screen, so the buffer area to it too*/
-        layer->buf_area = *area_p;
-        layer_reshape_draw_buf(layer, layer->draw_buf->header.stride);
-
-    }
-    else if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
-        /*In partial mode render this area to the buffer*/
-        layer->buf_area = *area_p;
-        layer_reshape_draw_buf(layer, LV_STRIDE_AUTO);
-    }
-    else if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
-        /*In direct mode the the buffer area is always the whole screen*/
-        layer->buf_area.x1 = 0;
-        layer->buf_area.y1 = 0;
-        layer->buf_area.x2 = lv_display_get_horizontal_resolution(disp_refr) - 1;
-        layer->buf_area.y2 = lv_display_get_vertical_resolution(disp_refr) - 1;
-        layer_reshape_draw_buf(layer, layer->draw_buf->header.stride);
-    }
+    layer_set_area(disp_refr, layer, area_p);
 
     /*Try to divide the area to smaller tiles*/
-    uint32_t tile_cnt = 1;
-    int32_t tile_h = lv_area_get_height(area_p);
+    uint32_t tile_col_cnt = 1;
+    uint32_t tile_row_cnt = 1;
     if(LV_COLOR_FORMAT_IS_INDEXED(layer->color_format) == false) {
         /* Assume that the the buffer size (can be screen sized or smaller in case of partial mode)
          * and max tile size are the optimal scenario. From this calculate the ideal tile size
@@ -693,10 +880,21 @@ static void refr_area(const lv_area_t * area_p)
         uint32_t ideal_tile_size = total_buf_size / max_tile_cnt;
         uint32_t area_buf_size = lv_area_get_size(area_p) * lv_color_format_get_size(layer->color_format);
 
-        tile_cnt = (area_buf_size + (ideal_tile_size - 1)) / ideal_tile_size; /*Round up*/
-        tile_h = lv_area_get_height(area_p) / tile_cnt;
+        tile_row_cnt = (area_buf_size + (ideal_tile_size - 1)) / ideal_tile_size; /*Round up*/
+
+#if LV_DRAW_TILE_SIZE
+        /*Use about square tiles whose pixels fit in the cache of the draw units*/
+        if(max_tile_cnt > 1) {
+            uint32_t px_size = LV_MAX(lv_color_format_get_size(layer->color_format), 1);
+            int32_t tile_side = LV_MAX(lv_sqrt32(LV_DRAW_TILE_SIZE / px_size), 1);
+            tile_col_cnt = (lv_area_get_width(area_p) + tile_side - 1) / tile_side;
+            tile_row_cnt = (lv_area_get_height(area_p) + tile_side - 1) / tile_side;
+        }
+#endif
+        tile_row_cnt = LV_CLAMP(1, tile_row_cnt, (uint32_t)lv_area_get_height(area_p));
     }
 
+    uint32_t tile_cnt = tile_col_cnt * tile_row_cnt;
     if(tile_cnt == 1) {
         refr_configured_layer(layer);
     }
@@ -711,20 +909,37 @@ static void refr_area(const lv_area_t * area_p)
             LV_PROFILER_REFR_END;
             return;
         }
+
+#if LV_DRAW_TILE_SIZE
+        /*Traverse the widgets only once and bin the draw tasks to the tiles.
+         *If something can't be recorded (e.g. a layer), traverse the widgets for each tile instead.*/
+        bool recorded = false;
+        lv_draw_task_t * rec_task_head = record_configured_layer(layer, &recorded);
+#endif
+
+        int32_t area_w = lv_area_get_width(area_p);
+        int32_t area_h = lv_area_get_height(area_p);
         uint32_t i;
         for(i = 0; i < tile_cnt; i++) {
+            /*Distribute the remaining pixels evenly among the tiles*/
+            int32_t col = i % tile_col_cnt;
+            int32_t row = i / tile_col_cnt;
             lv_area_t tile_area;
-            lv_area_set(&tile_area, area_p->x1, area_p->y1 + i * tile_h,
-                        area_p->x2, area_p->y1 + (i + 1) * tile_h - 1);
-
-            if(i == tile_cnt - 1) {
-                tile_area.y2 = area_p->y2;
-            }
+            lv_area_set(&tile_area, area_p->x1 + col * area_w / (int32_t)tile_col_cnt,
+                        area_p->y1 + row * area_h / (int32_t)tile_row_cnt,
+                        area_p->x1 + (col + 1) * area_w / (int32_t)tile_col_cnt - 1,
+                        area_p->y1 + (row + 1) * area_h / (int32_t)tile_row_cnt - 1);
 
             lv_layer_t * tile_layer = &tile_layers[i];
             lv_draw_layer_init(tile_layer, NULL, layer->color_format, &tile_area);
             tile_layer->buf_area = layer->buf_area; /*the buffer is still large*/
             tile_layer->draw_buf = layer->draw_buf;
+#if LV_DRAW_TILE_SIZE
+            if(recorded) {
+                lv_draw_recorder_replay(tile_layer, rec_task_head);
+                continue;
+            }
+#endif
             refr_configured_layer(tile_layer);
         }
 
@@ -749,12 +964,50 @@ static void refr_area(const lv_area_t * area_p)
             if(disp_refr->layer_deinit) disp_refr->layer_deinit(disp_refr, tile_layer);
         }
         lv_free(tile_layers);
+
+#if LV_DRAW_TILE_SIZE
+        /*The replayed draw tasks might use the texts of the recording, so free it only now*/
+        lv_draw_recorder_free(rec_task_head);
+#endif
     }
 
     disp_refr->refreshed_area = *area_p;
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Set the display's buffer and the areas of the display's layer to render an area
+ * @param disp      pointer to a display
+ * @param layer     the display's layer
+ * @param area_p    the area to render
+ */
+static void layer_set_area(lv_display_t * disp, lv_layer_t * layer, const lv_area_t * area_p)
+{
+    layer->draw_buf = disp->buf_act;
+    layer->_clip_area = *area_p;
+    layer->phy_clip_area = *area_p;
+
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
+        /*In full mode the area is always the full screen, so the buffer area to it too*/
+        layer->buf_area = *area_p;
+        layer_reshape_draw_buf(layer, layer->draw_buf->header.stride);
+
+    }
+    else if(disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+        /*In partial mode render this area to the buffer*/
+        layer->buf_area = *area_p;
+        layer_reshape_draw_buf(layer, LV_STRIDE_AUTO);
+    }
+    else if(disp->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        /*In direct mode the the buffer area is always the whole screen*/
+        layer->buf_area.x1 = 0;
+        layer->buf_area.y1 = 0;
+        layer->buf_area.x2 = lv_display_get_horizontal_resolution(disp) - 1;
+        layer->buf_area.y2 = lv_display_get_vertical_resolution(disp) - 1;
+        layer_reshape_draw_buf(layer, layer->draw_buf->header.stride);
+    }
+}
+
 static void refr_configured_layer(lv_layer_t * layer)
 {
     LV_PROFILER_REFR_BEGIN;
@@ -773,6 +1026,17 @@ static void refr_configured_layer(lv_layer_t * layer)
         lv_draw_buf_clear(layer->draw_buf, &layer->_clip_area);
     }
 
+    refr_layer_objs(layer);
+
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Draw the widgets of the display being refreshed on a layer
+ * @param layer     pointer to a configured layer
+ */
+static void refr_layer_objs(lv_layer_t * layer)
+{
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
@@ -811,9 +1075,35 @@ static void refr_configured_layer(lv_layer_t * layer)
     /*Also refresh top and sys layer unconditionally*/
     refr_obj_and_children(layer, lv_display_get_layer_top(disp_refr));
     refr_obj_and_children(layer, lv_display_get_layer_sys(disp_refr));
+}
+
+#if LV_DRAW_TILE_SIZE
+/**
+ * Collect the draw tasks of a layer without drawing them, to replay them on the tiles
+ * @param layer     the layer to record
+ * @param recorded  set to true if the draw tasks could be recorded
+ * @return          the recorded draw tasks or NULL if there are none or they couldn't be recorded.
+ *                  Needs to be freed with `lv_draw_recorder_free()`
+ */
+static lv_draw_task_t * record_configured_layer(lv_layer_t * layer, bool * recorded)
+{
+    LV_PROFILER_REFR_BEGIN;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_identity(&layer->matrix);
+#endif
+
+    lv_draw_recorder_t recorder;
+    lv_draw_recorder_begin(&recorder, layer, &layer->_clip_area);
+    refr_configured_layer(&recorder.layer);
+    lv_draw_task_t * task_head = lv_draw_recorder_end(&recorder);
+
+    *recorded = !recorder.failed;
+    if(recorder.failed) LV_LOG_INFO("The draw tasks can't be recorded, drawing the tiles one by one");
 
     LV_PROFILER_REFR_END;
+    return task_head;
 }
+#endif
 
 /**
  * Search the most top object which fully covers an area
@@ -1091,6 +1381,18 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
         lv_result_t res = layer_get_area(layer, obj, layer_type, &layer_area_full, &obj_draw_size);
         if(res != LV_RESULT_OK) return;
 
+#if LV_OBJ_LAYER_CACHE_SIZE
+        /*Blend the whole cached layer instead of rendering the object again*/
+        lv_draw_buf_t * cached_layer = lv_obj_layer_cache_get(obj, &obj_draw_size);
+        if(cached_layer) {
+            lv_draw_image_dsc_t layer_draw_dsc;
+            layer_draw_dsc_init(obj, &layer_draw_dsc, opa, &obj_draw_size, &obj_draw_size);
+            layer_draw_dsc.src = cached_layer;
+            lv_draw_image(layer, &layer_draw_dsc, &obj_draw_size);
+            return;
+        }
+#endif
+
         /*Simple layers can be subdivided into smaller layers*/
         uint32_t max_rgb_row_height = lv_area_get_height(&layer_area_full);
         uint32_t max_argb_row_height = lv_area_get_height(&layer_area_full);
@@ -1122,35 +1424,8 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
                                                           area_need_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE, &layer_area_act);
             lv_obj_redraw(new_layer, obj);
 
-            lv_point_t pivot = {
-                .x = lv_obj_get_style_transform_pivot_x(obj, 0),
-                .y = lv_obj_get_style_transform_pivot_y(obj, 0)
-            };
-
-            if(LV_COORD_IS_PCT(pivot.x)) {
-                pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
-            }
-            if(LV_COORD_IS_PCT(pivot.y)) {
-                pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
-            }
-
             lv_draw_image_dsc_t layer_draw_dsc;
-            lv_draw_image_dsc_init(&layer_draw_dsc);
-            layer_draw_dsc.pivot.x = obj->coords.x1 + pivot.x - new_layer->buf_area.x1;
-            layer_draw_dsc.pivot.y = obj->coords.y1 + pivot.y - new_layer->buf_area.y1;
-
-            layer_draw_dsc.opa = opa;
-            layer_draw_dsc.rotation = lv_obj_get_style_transform_rotation(obj, 0);
-            while(layer_draw_dsc.rotation > 3600) layer_draw_dsc.rotation -= 3600;
-            while(layer_draw_dsc.rotation < 0) layer_draw_dsc.rotation += 3600;
-            layer_draw_dsc.scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
-            layer_draw_dsc.scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
-            layer_draw_dsc.skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
-            layer_draw_dsc.skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
-            layer_draw_dsc.blend_mode = lv_obj_get_style_blend_mode(obj, 0);
-            layer_draw_dsc.antialias = disp_refr->antialiasing;
-            layer_draw_dsc.bitmap_mask_src = lv_obj_get_style_bitmap_mask_src(obj, 0);
-            layer_draw_dsc.image_area = obj_draw_size;
+            layer_draw_dsc_init(obj, &layer_draw_dsc, opa, &new_layer->buf_area, &obj_draw_size);
             layer_draw_dsc.src = new_layer;
 
             lv_draw_layer(layer, &layer_draw_dsc, &layer_area_act);
@@ -1160,6 +1435,47 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
     }
 }
 
+/**
+ * Initialize the descriptor to blend the layer of an object
+ * @param obj               pointer to an object
+ * @param dsc               the descriptor to initialize
+ * @param opa               the layered opacity of the object
+ * @param buf_area          the area of the layer's buffer
+ * @param obj_draw_size     the coordinates and extended draw area of the object
+ */
+static void layer_draw_dsc_init(lv_obj_t * obj, lv_draw_image_dsc_t * dsc, lv_opa_t opa, const lv_area_t * buf_area,
+                                const lv_area_t * obj_draw_size)
+{
+    lv_point_t pivot = {
+        .x = lv_obj_get_style_transform_pivot_x(obj, 0),
+        .y = lv_obj_get_style_transform_pivot_y(obj, 0)
+    };
+
+    if(LV_COORD_IS_PCT(pivot.x)) {
+        pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
+    }
+    if(LV_COORD_IS_PCT(pivot.y)) {
+        pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
+    }
+
+    lv_draw_image_dsc_init(dsc);
+    dsc->pivot.x = obj->coords.x1 + pivot.x - buf_area->x1;
+    dsc->pivot.y = obj->coords.y1 + pivot.y - buf_area->y1;
+
+    dsc->opa = opa;
+    dsc->rotation = lv_obj_get_style_transform_rotation(obj, 0);
+    while(dsc->rotation > 3600) dsc->rotation -= 3600;
+    while(dsc->rotation < 0) dsc->rotation += 3600;
+    dsc->scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
+    dsc->scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
+    dsc->skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
+    dsc->skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
+    dsc->blend_mode = lv_obj_get_style_blend_mode(obj, 0);
+    dsc->antialias = disp_refr->antialiasing;
+    dsc->bitmap_mask_src = lv_obj_get_style_bitmap_mask_src(obj, 0);
+    dsc->image_area = *obj_draw_size;
+}
+
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 {
     lv_color_format_t cf = disp->color_format;
@@ -1218,7 +1534,7 @@ static void draw_buf_flush(lv_display_t * disp)
      * If we need to wait here it means that the content of one buffer is being sent to display
      * and other buffer already contains the new rendered image. */
     if(lv_display_is_double_buffered(disp)) {
-        wait_for_flushing(disp_refr);
+        wait_for_flushing(disp);
     }
 
     disp->flushing = 1;
@@ -1257,17 +1573,285 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
 
     lv_display_send_event(disp, LV_EVENT_FLUSH_START, &offset_area);
 
-    /*For backward compatibility support LV_COLOR_16_SWAP (from v8)*/
-#if defined(LV_COLOR_16_SWAP) && LV_COLOR_16_SWAP
-    lv_draw_sw_rgb565_swap(px_map, lv_area_get_size(&offset_area));
-#endif
+    lv_color_format_t cf = disp->color_format;
+    uint32_t stride = disp->layer_head->draw_buf->header.stride;
+    if(disp->flush_color_format != LV_COLOR_FORMAT_UNKNOWN && disp->flush_color_format != cf &&
+       convert_for_flush(disp, area, &px_map) == LV_RESULT_OK) {
+        cf = disp->flush_color_format;
+        stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), cf);
+    }
 
-    disp->flush_cb(disp, &offset_area, px_map);
+    /*Delta flushing works on the rendered parts in partial mode and it can't handle the packed formats*/
+    if(disp->flush_delta_block_w && disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL &&
+       lv_color_format_get_bpp(cf) >= 8) {
+        flush_delta(disp, area, px_map, cf, stride);
+    }
+    else {
+        disp->flush_cb(disp, &offset_area, px_map);
+    }
     lv_display_send_event(disp, LV_EVENT_FLUSH_FINISH, &offset_area);
 
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Convert the rendered image to the flush color format of the display
+ * @param disp      pointer to a display
+ * @param area      the area being flushed
+ * @param px_map    pointer to the rendered image. Set to the converted image on success.
+ * @return          LV_RESULT_OK: the image was converted; LV_RESULT_INVALID: `px_map` is left unchanged
+ */
+static lv_result_t convert_for_flush(lv_display_t * disp, const lv_area_t * area, uint8_t ** px_map)
+{
+    LV_PROFILER_REFR_BEGIN;
+    lv_layer_t * layer = disp->layer_head;
+    lv_color_format_t cf = disp->flush_color_format;
+    int32_t buf_w = lv_area_get_width(&layer->buf_area);
+    int32_t buf_h = lv_area_get_height(&layer->buf_area);
+
+    uint8_t * dest;
+    uint32_t dest_stride;
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        /*The draw buffer keeps the image for the next refreshes, so it can't be converted in place*/
+        if(disp->flush_buf == NULL) {
+            disp->flush_buf = lv_draw_buf_create(buf_w, buf_h, cf, LV_STRIDE_AUTO);
+            if(disp->flush_buf == NULL) {
+                LV_LOG_WARN("Couldn't allocate a buffer for the color format conversion");
+                LV_PROFILER_REFR_END;
+                return LV_RESULT_INVALID;
+            }
+        }
+        dest = disp->flush_buf->data;
+        dest_stride = disp->flush_buf->header.stride;
+    }
+    else {
+        /*The strides are the same or smaller in the new color format so it can be converted in place*/
+        dest = *px_map;
+        dest_stride = lv_draw_buf_width_to_stride(buf_w, cf);
+    }
+
+    /*Keep the palette at the beginning, like in the buffers of I1 displays*/
+    uint32_t palette_size = LV_COLOR_INDEXED_PALETTE_SIZE(cf) * sizeof(lv_color32_t);
+    lv_result_t res = lv_draw_buf_convert_color_format(*px_map, layer->draw_buf->header.stride, disp->color_format,
+                                                       dest + palette_size, dest_stride, cf,
+                                                       &layer->buf_area, area, disp->flush_dither);
+    if(res != LV_RESULT_OK) {
+        /*Don't try (and warn) again on every flush*/
+        LV_LOG_WARN("Can't convert color format %d to %d, flushing without conversion", disp->color_format, cf);
+        lv_display_set_flush_color_format(disp, LV_COLOR_FORMAT_UNKNOWN);
+        LV_PROFILER_REFR_END;
+        return LV_RESULT_INVALID;
+    }
+
+    if(palette_size) {
+        lv_color32_t * palette = (lv_color32_t *)dest;
+        palette[0] = lv_color32_make(0x00, 0x00, 0x00, 0xff);
+        palette[1] = lv_color32_make(0xff, 0xff, 0xff, 0xff);
+    }
+
+    *px_map = dest;
+    LV_PROFILER_REFR_END;
+    return LV_RESULT_OK;
+}
+
+/**
+ * Forget the flushed pixels and redraw the whole screen periodically. Different blocks with
+ * the same hash wouldn't be flushed and they could remain wrong on the panel for ever.
+ * @param disp      pointer to a display with delta flushing
+ */
+static void flush_delta_check_period(lv_display_t * disp)
+{
+    disp->flush_delta_refr_cnt++;
+    if(disp->flush_delta_refr_cnt < LV_DISPLAY_FLUSH_DELTA_FULL_PERIOD) return;
+
+    disp->flush_delta_refr_cnt = 0;
+    if(disp->flush_delta_hashes) {
+        lv_memzero(disp->flush_delta_hashes,
+                   (size_t)disp->flush_delta_col_cnt * disp->flush_delta_row_cnt * sizeof(uint32_t));
+    }
+
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_display_get_horizontal_resolution(disp) - 1,
+                lv_display_get_vertical_resolution(disp) - 1);
+    lv_inv_area(disp, &scr_area);
+}
+
+/**
+ * Flush only the parts of the area which are different from the last flushed pixels.
+ * The area is shrunk to the changed rows and columns, and split into bands
+ * if there are many unchanged rows between the changes.
+ * @param disp      pointer to a display
+ * @param area      the area being flushed
+ * @param px_map    the image of the area
+ * @param cf        color format of `px_map`
+ * @param stride    stride of `px_map`
+ */
+static void flush_delta(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map, lv_color_format_t cf,
+                        uint32_t stride)
+{
+    LV_PROFILER_REFR_BEGIN;
+
+    int32_t block_w = disp->flush_delta_block_w;
+    int32_t hor_res = lv_display_get_horizontal_resolution(disp);
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+    int32_t col_cnt = (hor_res + block_w - 1) / block_w;
+
+    /*(Re)allocate the hashes if the resolution has changed. All hashes are unknown (0) at first.*/
+    if(disp->flush_delta_hashes == NULL || disp->flush_delta_col_cnt != col_cnt ||
+       disp->flush_delta_row_cnt != ver_res) {
+        lv_free(disp->flush_delta_hashes);
+        disp->flush_delta_hashes = lv_calloc((size_t)col_cnt * ver_res, sizeof(uint32_t));
+        disp->flush_delta_col_cnt = col_cnt;
+        disp->flush_delta_row_cnt = ver_res;
+    }
+
+    uint32_t px_size = lv_color_format_get_size(cf);
+    uint32_t area_size = lv_area_get_size(area) * px_size;
+    disp->flush_delta_stats.rendered_bytes += area_size;
+
+    if(disp->flush_delta_hashes == NULL) {
+        LV_LOG_WARN("Couldn't allocate the hashes for delta flushing");
+        lv_area_t offset_area = *area;
+        lv_area_move(&offset_area, disp->offset_x, disp->offset_y);
+        disp->flush_cb(disp, &offset_area, px_map);
+        disp->flush_delta_stats.flushed_bytes += area_size;
+        LV_PROFILER_REFR_END;
+        return;
+    }
+
+    bool flushing_last = disp->flushing_last;
+    bool first = true;
+    bool band_valid = false;
+    lv_area_t band = {0};
+    int32_t col_first = area->x1 / block_w;
+    int32_t col_last = area->x2 / block_w;
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        const uint8_t * row = px_map + (y - area->y1) * stride;
+        uint32_t * row_hashes = &disp->flush_delta_hashes[y * col_cnt];
+        int32_t changed_x1 = LV_COORD_MAX;
+        int32_t changed_x2 = LV_COORD_MIN;
+        int32_t col;
+        for(col = col_first; col <= col_last; col++) {
+            int32_t block_x1 = col * block_w;
+            int32_t block_x2 = LV_MIN(block_x1 + block_w - 1, hor_res - 1);
+            int32_t x1 = LV_MAX(block_x1, area->x1);
+            int32_t x2 = LV_MIN(block_x2, area->x2);
+
+            /*The hash of partially flushed blocks is unknown as the rest of the block wasn't seen*/
+            uint32_t hash = 0;
+            if(x1 == block_x1 && x2 == block_x2) {
+                hash = hash_pixels(row + (x1 - area->x1) * px_size, (x2 - x1 + 1) * px_size);
+            }
+
+            if(hash == 0 || hash != row_hashes[col]) {
+                changed_x1 = LV_MIN(changed_x1, x1);
+                changed_x2 = LV_MAX(changed_x2, x2);
+            }
+            row_hashes[col] = hash;
+        }
+
+        if(changed_x2 < changed_x1) continue;
+
+        /*Sending the unchanged rows between two changes might be cheaper than sending a new window*/
+        if(band_valid && y - band.y2 > FLUSH_DELTA_BAND_GAP) {
+            disp->flushing_last = 0;
+            flush_delta_band(disp, area, px_map, cf, stride, &band, first);
+            first = false;
+            band_valid = false;
+        }
+
+        if(band_valid) {
+            band.x1 = LV_MIN(band.x1, changed_x1);
+            band.x2 = LV_MAX(band.x2, changed_x2);
+            band.y2 = y;
+        }
+        else {
+            lv_area_set(&band, changed_x1, y, changed_x2, y);
+            band_valid = true;
+        }
+    }
+
+    /*Drivers might wait for the last area of the refresh so send at least one block of it*/
+    if(!band_valid && first && flushing_last) {
+        lv_area_set(&band, area->x1, area->y1, LV_MIN(area->x1 + block_w - 1, area->x2), area->y1);
+        band_valid = true;
+    }
+
+    if(band_valid) {
+        disp->flushing_last = flushing_last;
+        flush_delta_band(disp, area, px_map, cf, stride, &band, first);
+    }
+    else if(first) {
+        /*Nothing was sent so nobody will call `lv_display_flush_ready()`*/
+        disp->flushing = 0;
+        disp->flushing_last = 0;
+    }
+
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Pack a band of the flushed area to the beginning of its rows and pass it to `flush_cb`
+ * @param disp      pointer to a display
+ * @param area      the area being flushed
+ * @param px_map    the image of the area
+ * @param cf        color format of `px_map`
+ * @param stride    stride of `px_map`
+ * @param band      the part of `area` to flush
+ * @param first     true: this is the first band of the area
+ */
+static void flush_delta_band(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map, lv_color_format_t cf,
+                             uint32_t stride, const lv_area_t * band, bool first)
+{
+    /*Wait until the driver is ready with the previous band*/
+    if(!first) {
+        bool flushing_last = disp->flushing_last;
+        wait_for_flushing(disp);
+        disp->flushing = 1;
+        disp->flushing_last = flushing_last;
+    }
+
+    uint32_t px_size = lv_color_format_get_size(cf);
+    int32_t band_w = lv_area_get_width(band);
+    int32_t band_h = lv_area_get_height(band);
+    uint32_t band_stride = lv_draw_buf_width_to_stride(band_w, cf);
+    uint8_t * dest = px_map + (band->y1 - area->y1) * stride;
+    const uint8_t * src = dest + (band->x1 - area->x1) * px_size;
+
+    /*The rows only move to lower addresses and the other bands are not touched*/
+    if(src != dest || band_stride != stride) {
+        int32_t y;
+        for(y = 0; y < band_h; y++) {
+            lv_memmove(dest + y * band_stride, src + y * stride, band_w * px_size);
+        }
+    }
+
+    lv_area_t offset_area = *band;
+    lv_area_move(&offset_area, disp->offset_x, disp->offset_y);
+    disp->flush_cb(disp, &offset_area, dest);
+
+    disp->flush_delta_stats.flushed_bytes += band_w * band_h * px_size;
+}
+
+/**
+ * Hash a row of pixels with FNV-1a
+ * @param buf       pointer to the pixels
+ * @param len       number of bytes
+ * @return          the hash, never 0 as 0 is used as unknown
+ */
+static uint32_t hash_pixels(const uint8_t * buf, uint32_t len)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < len; i++) {
+        hash ^= buf[i];
+        hash *= 16777619u;
+    }
+
+    return hash ? hash : 1;
+}
+
 static void wait_for_flushing(lv_display_t * disp)
 {
     LV_PROFILER_REFR_BEGIN;
@@ -1291,3 +1875,216 @@ static void wait_for_flushing(lv_display_t * disp)
     LV_LOG_TRACE("end");
     LV_PROFILER_REFR_END;
 }
+
+/**
+ * Delay rendering to finish it just before the next vsync of the display.
+ * If rendering is not delayed, sample the animations at the time when the frame will be visible.
+ * @param disp      pointer to a display
+ * @param tmr       the refresh timer of the display
+ * @return          true: rendering is delayed and the timer will run again when it should start
+ */
+static bool frame_sched_delay(lv_display_t * disp, lv_timer_t * tmr)
+{
+    if(disp->vsync_period_us == 0 || disp->inv_p == 0) return false;
+
+    uint32_t since_vsync_ms = lv_tick_elaps(disp->vsync_last);
+    if(since_vsync_ms > LV_DISPLAY_VSYNC_TIMEOUT) {
+        /*The vsyncs are not reported anymore, render as soon as possible*/
+        return false;
+    }
+
+    /*Find the first vsync which can be reached if rendering is started now*/
+    uint32_t period_us = disp->vsync_period_us;
+    uint32_t cost_us = lv_atomic_load(&disp->render_cost_us) + FRAME_SCHED_MARGIN_US;
+    uint32_t to_vsync_us = period_us - (since_vsync_ms * 1000) % period_us;
+    if(to_vsync_us < cost_us) {
+        to_vsync_us += (cost_us - to_vsync_us + period_us - 1) / period_us * period_us;
+    }
+
+    uint32_t start_in_ms = (to_vsync_us - cost_us) / 1000;
+    if(start_in_ms > 0 && tmr->period > 0) {
+        /*Run the timer again when rendering should start (but not later than its period)*/
+        tmr->last_run = lv_tick_get() - tmr->period + LV_MIN(start_in_ms, tmr->period);
+        return true;
+    }
+
+    /* The frame will be visible at the vsync, so show the animations as they are at that time.
+     * The offset is global, so reset it to not run ahead with the other displays and timers.
+     * The animations won't go back in time but wait until the tick catches up.*/
+    lv_anim_set_time_offset(to_vsync_us / 1000);
+    lv_anim_refr_now();
+    lv_anim_set_time_offset(0);
+
+    return false;
+}
+
+/**
+ * Update the predicted render time when a frame is rendered
+ * @param disp      pointer to a display
+ */
+static void frame_sched_render_ready(lv_display_t * disp)
+{
+    if(disp->vsync_period_us == 0) return;
+
+    /*Follow the increase immediately to not miss the vsync, but decrease slowly*/
+    uint32_t cost_us = lv_tick_elaps(disp->render_start) * 1000;
+    uint32_t predicted_us = lv_atomic_load(&disp->render_cost_us);
+    if(cost_us > predicted_us) predicted_us = cost_us;
+    else predicted_us -= (predicted_us - cost_us) / 8;
+    lv_atomic_store(&disp->render_cost_us, predicted_us);
+}
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+/**
+ * Record the draw tasks of a part on the calling thread, to be rendered by the display's thread
+ * @param rt        the render thread of the display being refreshed
+ * @param area_p    the area of the part
+ */
+static void render_thread_record_part(lv_display_render_thread_t * rt, const lv_area_t * area_p)
+{
+    if(rt->record_failed) return;
+    LV_PROFILER_REFR_BEGIN;
+
+    if(rt->part_cnt == rt->part_capacity) {
+        uint32_t new_capacity = rt->part_capacity ? rt->part_capacity * 2 : 4;
+        lv_display_render_part_t * new_parts = lv_realloc(rt->parts, new_capacity * sizeof(lv_display_render_part_t));
+        LV_ASSERT_MALLOC(new_parts);
+        if(new_parts == NULL) {
+            rt->record_failed = true;
+            LV_PROFILER_REFR_END;
+            return;
+        }
+        rt->parts = new_parts;
+        rt->part_capacity = new_capacity;
+    }
+
+    /*The buffer is not touched here, it's prepared by the render thread*/
+    lv_layer_t * layer = disp_refr->layer_head;
+    layer_set_area(disp_refr, layer, area_p);
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_identity(&layer->matrix);
+#endif
+
+    lv_draw_recorder_t recorder;
+    lv_draw_recorder_begin(&recorder, layer, area_p);
+    refr_layer_objs(&recorder.layer);
+    lv_draw_task_t * task_head = lv_draw_recorder_end(&recorder);
+
+    /*Make the draw tasks independent from the widgets as they might change while rendering*/
+    if(recorder.failed || lv_draw_recorder_detach(task_head) != LV_RESULT_OK) {
+        lv_draw_recorder_free(task_head);
+        rt->record_failed = true;
+        LV_PROFILER_REFR_END;
+        return;
+    }
+
+    lv_display_render_part_t * part = &rt->parts[rt->part_cnt];
+    part->area = *area_p;
+    part->task_head = task_head;
+    part->last_area = disp_refr->last_area;
+    part->last_part = disp_refr->last_part;
+    rt->part_cnt++;
+
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Render and flush a recorded part on the display's thread
+ * @param disp      pointer to the display
+ * @param part      the part to render. Its draw tasks are consumed.
+ */
+static void render_thread_render_part(lv_display_t * disp, lv_display_render_part_t * part)
+{
+    LV_PROFILER_REFR_BEGIN;
+    lv_display_render_thread_t * rt = disp->render_thread;
+    lv_layer_t * layer = disp->layer_head;
+    layer_set_area(disp, layer, &part->area);
+
+    /* In single buffered mode wait here until the buffer is freed.
+     * Else we would draw into the buffer while it's still being transferred to the display*/
+    if(!lv_display_is_double_buffered(disp)) {
+        wait_for_flushing(disp);
+    }
+    /*If the screen is transparent initialize it when the flushing is ready*/
+    if(lv_color_format_has_alpha(disp->color_format)) {
+        lv_draw_buf_clear(layer->draw_buf, &layer->_clip_area);
+    }
+
+    /*Move the recorded draw tasks to the display's layer and dispatch them from this thread*/
+    lv_draw_task_t * t;
+    for(t = part->task_head; t; t = t->next) {
+        lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
+        base_dsc->layer = layer;
+    }
+    layer->draw_task_head = part->task_head;
+    part->task_head = NULL;
+
+    while(layer->draw_task_head) {
+        lv_draw_dispatch_layer(disp, layer);
+        if(layer->draw_task_head) lv_thread_sync_wait(&rt->sync);
+    }
+
+    disp->refreshed_area = part->area;
+    disp->last_area = part->last_area;
+    disp->last_part = part->last_part;
+    draw_buf_flush(disp);
+
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Free the recorded parts which were not rendered
+ * @param rt        pointer to a render thread
+ */
+static void render_thread_free_parts(lv_display_render_thread_t * rt)
+{
+    uint32_t i;
+    for(i = 0; i < rt->part_cnt; i++) {
+        lv_draw_recorder_free(rt->parts[i].task_head);
+    }
+    rt->part_cnt = 0;
+}
+
+/**
+ * Wait until the render thread of a display finishes the current frame
+ * @param disp      pointer to a display
+ */
+static void render_thread_wait(lv_display_t * disp)
+{
+    lv_display_render_thread_t * rt = disp->render_thread;
+    if(rt == NULL) return;
+
+    while(lv_atomic_load(&rt->busy)) {
+        lv_thread_sync_wait(&rt->done_sync);
+    }
+}
+
+static void render_thread_cb(void * ptr)
+{
+    lv_display_t * disp = ptr;
+    lv_display_render_thread_t * rt = disp->render_thread;
+
+    while(1) {
+        /*The sync is signaled on draw requests too, so check the flags*/
+        while(!lv_atomic_load(&rt->busy) && !lv_atomic_load(&rt->exit)) {
+            lv_thread_sync_wait(&rt->sync);
+        }
+
+        if(lv_atomic_load(&rt->exit)) break;
+
+        uint32_t i;
+        for(i = 0; i < rt->part_cnt; i++) {
+            render_thread_render_part(disp, &rt->parts[i]);
+        }
+        rt->part_cnt = 0;
+
+        frame_sched_render_ready(disp);
+        lv_display_send_event(disp, LV_EVENT_RENDER_READY, NULL);
+
+        lv_atomic_store(&rt->busy, 0);
+        lv_thread_sync_signal(&rt->done_sync);
+    }
+
+    LV_LOG_INFO("exit the render thread of the display");
+}
+#endif
@@ -64,6 +64,22 @@ void lv_refr_set_disp_refreshing(lv_display_t * disp);
  */
 void lv_display_refr_timer(lv_timer_t * timer);
 
+#if LV_USE_DISPLAY_RENDER_THREAD
+/**
+ * Create a thread to render the recorded frames of a display
+ * @param disp      pointer to a display
+ * @return          LV_RESULT_OK: the thread was created;
+ *                  LV_RESULT_INVALID: out of memory, thread error or not supported by the draw units
+ */
+lv_result_t lv_refr_render_thread_create(lv_display_t * disp);
+
+/**
+ * Wait until the frame being rendered is ready and delete the render thread of a display
+ * @param disp      pointer to a display
+ */
+void lv_refr_render_thread_delete(lv_display_t * disp);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -77,6 +77,10 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->dpi              = LV_DPI_DEF;
     disp->color_format = LV_COLOR_FORMAT_NATIVE;
 
+    /*For backward compatibility support LV_COLOR_16_SWAP (from v8)*/
+#if defined(LV_COLOR_16_SWAP) && LV_COLOR_16_SWAP
+    disp->flush_color_format = LV_COLOR_FORMAT_RGB565_SWAPPED;
+#endif
 
 #if defined(LV_DRAW_SW_DRAW_UNIT_CNT)
     disp->tile_cnt = LV_DRAW_SW_DRAW_UNIT_CNT;
@@ -169,6 +173,11 @@ void lv_display_delete(lv_display_t * disp)
     if(disp == lv_display_get_default()) was_default = true;
     if(disp == lv_refr_get_disp_refreshing()) was_refr = true;
 
+#if LV_USE_DISPLAY_RENDER_THREAD
+    /*Finish the frame being rendered before deleting anything*/
+    if(disp->render_thread) lv_refr_render_thread_delete(disp);
+#endif
+
     lv_display_send_event(disp, LV_EVENT_DELETE, NULL);
     lv_event_remove_all(&(disp->event_list));
 
@@ -206,11 +215,22 @@ void lv_display_delete(lv_display_t * disp)
 
     lv_ll_clear(&disp->sync_areas);
     lv_ll_remove(disp_ll_p, disp);
+
+    /*Release the reserved draw units*/
+    if(disp->draw_unit_mask) {
+        uint32_t reserved = 0;
+        lv_display_t * d;
+        LV_LL_READ(disp_ll_p, d) reserved |= d->draw_unit_mask;
+        lv_draw_set_reserved_unit_mask(reserved);
+    }
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
     if(disp->layer_deinit) disp->layer_deinit(disp, disp->layer_head);
     lv_free(disp->layer_head);
 
+    if(disp->flush_buf) lv_draw_buf_destroy(disp->flush_buf);
+    lv_free(disp->flush_delta_hashes);
+
     lv_free(disp);
 
     if(was_default) lv_display_set_default(lv_ll_get_head(disp_ll_p));
@@ -538,6 +558,146 @@ uint32_t lv_display_get_tile_cnt(lv_display_t * disp)
     return disp->tile_cnt;
 }
 
+void lv_display_set_draw_unit_mask(lv_display_t * disp, uint32_t mask)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    uint32_t unit_cnt = lv_draw_get_unit_count();
+    uint32_t all_units = unit_cnt >= 32 ? 0xFFFFFFFF : (1UL << unit_cnt) - 1;
+
+    /*The displays without a mask share the draw units not reserved by others*/
+    uint32_t reserved = mask;
+    bool has_shared = false;
+    lv_display_t * d;
+    LV_LL_READ(disp_ll_p, d) {
+        if(d == disp) continue;
+        reserved |= d->draw_unit_mask;
+        if(d->draw_unit_mask == 0) has_shared = true;
+    }
+    if(mask == 0) has_shared = true;
+
+    if(has_shared && (reserved & all_units) == all_units) {
+        LV_LOG_WARN("All draw units would be reserved and some displays couldn't be rendered");
+        return;
+    }
+
+    disp->draw_unit_mask = mask;
+    lv_draw_set_reserved_unit_mask(reserved);
+}
+
+uint32_t lv_display_get_draw_unit_mask(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    return disp->draw_unit_mask;
+}
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+lv_result_t lv_display_set_render_thread(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return LV_RESULT_INVALID;
+
+    if(en == (disp->render_thread != NULL)) return LV_RESULT_OK;
+
+    if(en) return lv_refr_render_thread_create(disp);
+
+    lv_refr_render_thread_delete(disp);
+    return LV_RESULT_OK;
+}
+
+bool lv_display_get_render_thread(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->render_thread != NULL;
+}
+#endif
+
+void lv_display_set_flush_color_format(lv_display_t * disp, lv_color_format_t cf)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    if(cf != LV_COLOR_FORMAT_UNKNOWN && cf != LV_COLOR_FORMAT_RGB565 && cf != LV_COLOR_FORMAT_RGB565_SWAPPED &&
+       cf != LV_COLOR_FORMAT_L8 && cf != LV_COLOR_FORMAT_I1) {
+        LV_LOG_WARN("Not supported flush color format: %d", cf);
+        return;
+    }
+
+    disp->flush_color_format = cf;
+
+    /*The next conversion allocates a buffer with the new color format if needed*/
+    if(disp->flush_buf) {
+        lv_draw_buf_destroy(disp->flush_buf);
+        disp->flush_buf = NULL;
+    }
+}
+
+lv_color_format_t lv_display_get_flush_color_format(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return LV_COLOR_FORMAT_UNKNOWN;
+
+    return disp->flush_color_format;
+}
+
+void lv_display_set_flush_dither(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->flush_dither = en;
+}
+
+bool lv_display_get_flush_dither(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->flush_dither;
+}
+
+void lv_display_set_flush_delta(lv_display_t * disp, uint32_t block_w)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    if(disp->flush_delta_block_w == block_w) return;
+
+    disp->flush_delta_block_w = block_w;
+
+    /*The hashes are allocated for the new block width on the next flush*/
+    lv_free(disp->flush_delta_hashes);
+    disp->flush_delta_hashes = NULL;
+    disp->flush_delta_refr_cnt = 0;
+    lv_memzero(&disp->flush_delta_stats, sizeof(disp->flush_delta_stats));
+}
+
+uint32_t lv_display_get_flush_delta(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    return disp->flush_delta_block_w;
+}
+
+void lv_display_get_flush_delta_stats(lv_display_t * disp, lv_display_flush_delta_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) {
+        lv_memzero(stats, sizeof(lv_display_flush_delta_stats_t));
+        return;
+    }
+
+    *stats = disp->flush_delta_stats;
+}
+
 void lv_display_set_antialiasing(lv_display_t * disp, bool en)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -963,6 +1123,46 @@ void lv_display_delete_refr_timer(lv_display_t * disp)
     disp->refr_timer = NULL;
 }
 
+void lv_display_report_vsync(lv_display_t * disp, uint32_t timestamp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    uint32_t interval_ms = timestamp - disp->vsync_last;
+    bool first = !disp->vsync_reported;
+    disp->vsync_last = timestamp;
+    disp->vsync_reported = true;
+    if(first || interval_ms == 0 || interval_ms > LV_DISPLAY_VSYNC_TIMEOUT) return;
+
+    uint32_t interval_us = interval_ms * 1000;
+    if(disp->vsync_period_us == 0) {
+        disp->vsync_period_us = interval_us;
+        return;
+    }
+
+    /*Some vsyncs might not be reported (e.g. there was nothing to flush), so divide the interval by
+     *the number of periods. The timestamps are in ms so average the periods to get a precise value.*/
+    uint32_t period_cnt = LV_MAX((interval_us + disp->vsync_period_us / 2) / disp->vsync_period_us, 1);
+    int32_t diff = (int32_t)(interval_us / period_cnt) - (int32_t)disp->vsync_period_us;
+    disp->vsync_period_us += diff / 8;
+}
+
+uint32_t lv_display_get_vsync_period(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return disp->vsync_period_us;
+}
+
+uint32_t lv_display_get_render_cost(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return lv_atomic_load(&disp->render_cost_us);
+}
+
 void lv_display_set_user_data(lv_display_t * disp, void * user_data)
 {
     if(!disp) disp = lv_display_get_default();
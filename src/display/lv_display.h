@@ -27,6 +27,10 @@ extern "C" {
 #define LV_ATTRIBUTE_FLUSH_READY
 #endif
 
+#ifndef LV_DISPLAY_VSYNC_TIMEOUT
+#define LV_DISPLAY_VSYNC_TIMEOUT    1000    /**< [ms] Don't predict the vsyncs if the last one was reported earlier*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -78,6 +82,12 @@ typedef enum {
     LV_SCR_LOAD_ANIM_OUT_BOTTOM,
 } lv_screen_load_anim_t;
 
+/** Statistics of delta flushing during the last refresh*/
+typedef struct {
+    uint32_t rendered_bytes;    /**< Size of the rendered areas in the flushed color format*/
+    uint32_t flushed_bytes;     /**< Size of the areas passed to `flush_cb`*/
+} lv_display_flush_delta_stats_t;
+
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
@@ -297,7 +307,7 @@ void lv_display_set_flush_wait_cb(lv_display_t * disp, lv_display_flush_wait_cb_
  *                          - LV_COLOR_FORMAT_XRGB888
  *                          - LV_COLOR_FORMAT_ARGB888
  *@note To change the endianness of the rendered image in case of RGB565 format
- *      (i.e. swap the 2 bytes) call `lv_draw_sw_rgb565_swap` in the flush_cb
+ *      (i.e. swap the 2 bytes) use `lv_display_set_flush_color_format(disp, LV_COLOR_FORMAT_RGB565_SWAPPED)`
  */
 void lv_display_set_color_format(lv_display_t * disp, lv_color_format_t color_format);
 
@@ -308,6 +318,75 @@ void lv_display_set_color_format(lv_display_t * disp, lv_color_format_t color_fo
  */
 lv_color_format_t lv_display_get_color_format(lv_display_t * disp);
 
+/**
+ * Convert the rendered image to an other color format before passing it to the flush callback.
+ * It allows rendering in a higher color depth (e.g. for smoother gradients) than what the panel supports.
+ * In `LV_DISPLAY_RENDER_MODE_PARTIAL` and `LV_DISPLAY_RENDER_MODE_FULL` the image is converted in place,
+ * in `LV_DISPLAY_RENDER_MODE_DIRECT` into a screen sized buffer allocated on the first flush,
+ * so `px_map` has the same layout as the draw buffer (stride set by `lv_draw_buf_width_to_stride()`).
+ * @param disp              pointer to a display
+ * @param cf                the color format passed to the flush callback
+ *                          - LV_COLOR_FORMAT_RGB565: from XRGB8888, ARGB8888 and RGB888
+ *                          - LV_COLOR_FORMAT_RGB565_SWAPPED: from RGB565 too
+ *                          - LV_COLOR_FORMAT_L8: from XRGB8888, ARGB8888 and RGB888
+ *                          - LV_COLOR_FORMAT_I1: from XRGB8888, ARGB8888 and RGB888.
+ *                            `px_map` starts with an 8 byte palette like in case of I1 displays.
+ *                          - LV_COLOR_FORMAT_UNKNOWN: flush the image in the color format of the display
+ */
+void lv_display_set_flush_color_format(lv_display_t * disp, lv_color_format_t cf);
+
+/**
+ * Get the color format passed to the flush callback
+ * @param disp              pointer to a display
+ * @return                  the color format or `LV_COLOR_FORMAT_UNKNOWN` if the image is not converted
+ */
+lv_color_format_t lv_display_get_flush_color_format(lv_display_t * disp);
+
+/**
+ * Enable ordered dithering when the image is converted for flushing.
+ * It hides the banding of gradients when the color depth is reduced.
+ * @param disp              pointer to a display
+ * @param en                true: enable dithering
+ */
+void lv_display_set_flush_dither(lv_display_t * disp, bool en);
+
+/**
+ * Get whether ordered dithering is used when the image is converted for flushing
+ * @param disp              pointer to a display
+ * @return                  true: dithering is enabled
+ */
+bool lv_display_get_flush_dither(lv_display_t * disp);
+
+/**
+ * Enable delta flushing: hash the flushed pixels in `block_w` x 1 sized blocks and pass only
+ * the rows and columns to `flush_cb` which are different from the last flushed image.
+ * Useful for displays with slow (e.g. SPI) interface when e.g. a label is redrawn with the same text.
+ * Works only in `LV_DISPLAY_RENDER_MODE_PARTIAL` and for color formats with at least 8 bits per pixel.
+ * @param disp              pointer to a display
+ * @param block_w           width of the compared blocks in pixels. 0: disable delta flushing
+ * @note                    The invalidated areas are rounded to whole blocks horizontally.
+ *                          Changing `block_w` forgets the last flushed image.
+ * @note                    The whole screen is redrawn and flushed after every
+ *                          `LV_DISPLAY_FLUSH_DELTA_FULL_PERIOD` refreshes in case of hash collisions.
+ * @note                    `flush_cb` might be called multiple times with smaller areas for a rendered area.
+ */
+void lv_display_set_flush_delta(lv_display_t * disp, uint32_t block_w);
+
+/**
+ * Get the width of the blocks compared in delta flushing
+ * @param disp              pointer to a display
+ * @return                  width of the blocks, 0 if delta flushing is disabled
+ */
+uint32_t lv_display_get_flush_delta(lv_display_t * disp);
+
+/**
+ * Get how many bytes were saved by delta flushing during the last refresh.
+ * The saved bytes are `rendered_bytes - flushed_bytes`.
+ * @param disp              pointer to a display
+ * @param stats             store the statistics here
+ */
+void lv_display_get_flush_delta_stats(lv_display_t * disp, lv_display_flush_delta_stats_t * stats);
+
 /**
  * Set the number of tiles for parallel rendering.
  * @param disp              pointer to a display
@@ -322,6 +401,46 @@ void lv_display_set_tile_cnt(lv_display_t * disp, uint32_t tile_cnt);
  */
 uint32_t lv_display_get_tile_cnt(lv_display_t * disp);
 
+/**
+ * Select the draw units which can render a display. The draw units selected here are
+ * reserved for this display and the other displays can't use them.
+ * @param disp              pointer to a display
+ * @param mask              bit N selects the draw unit with index N (the first created unit has index 0).
+ *                          0: use the draw units not reserved by other displays (default)
+ */
+void lv_display_set_draw_unit_mask(lv_display_t * disp, uint32_t mask);
+
+/**
+ * Get the draw units selected to render a display
+ * @param disp              pointer to a display
+ * @return                  the mask of draw units or 0 if no draw units are reserved
+ */
+uint32_t lv_display_get_draw_unit_mask(lv_display_t * disp);
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+/**
+ * Render a display on its own thread. `lv_timer_handler()` only records the draw tasks of the
+ * display and the thread renders and flushes them, while the other displays are refreshed.
+ * If something can't be recorded (e.g. a widget is drawn on a layer) the frame is rendered as usual.
+ * @param disp              pointer to a display
+ * @param en                true: create the thread; false: delete it
+ * @return                  LV_RESULT_OK: success; LV_RESULT_INVALID: the thread couldn't be created
+ *                          or the SDL or OpenGL ES draw units are enabled
+ * @note                    `flush_cb`, `flush_wait_cb` and the display events related to rendering
+ *                          (`LV_EVENT_RENDER_READY`, `LV_EVENT_FLUSH_...`) are called from the display's thread,
+ *                          not from the thread of `lv_timer_handler()`. They must not call LVGL functions
+ *                          other than `lv_display_flush_ready()`.
+ */
+lv_result_t lv_display_set_render_thread(lv_display_t * disp, bool en);
+
+/**
+ * Get if a display is rendered on its own thread
+ * @param disp              pointer to a display
+ * @return                  true: the display has its own render thread
+ */
+bool lv_display_get_render_thread(lv_display_t * disp);
+#endif
+
 /**
  * Enable anti-aliasing for the render engine
  * @param disp      pointer to a display
@@ -556,6 +675,31 @@ lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp);
  */
 void lv_display_delete_refr_timer(lv_display_t * disp);
 
+/**
+ * Report a vertical synchronization (vblank) of the display, e.g. from the page flip event of the driver.
+ * Once the vsync period is known, rendering is started to finish just before the next vsync
+ * and the animations are sampled at the time when the rendered frame will be visible.
+ * @param disp          pointer to a display
+ * @param timestamp     time of the vsync in the same time base as `lv_tick_get()` [ms]
+ * @note                The vsyncs don't need to be reported continuously (e.g. if there is nothing to flush),
+ *                      but an accurate phase is assumed only for `LV_DISPLAY_VSYNC_TIMEOUT` ms after the last one.
+ */
+void lv_display_report_vsync(lv_display_t * disp, uint32_t timestamp);
+
+/**
+ * Get the estimated time between the reported vsyncs
+ * @param disp      pointer to a display
+ * @return          the vsync period in microseconds or 0 if it's unknown
+ */
+uint32_t lv_display_get_vsync_period(lv_display_t * disp);
+
+/**
+ * Get the predicted time of rendering a frame, used to schedule the start of rendering
+ * @param disp      pointer to a display
+ * @return          the render time in microseconds
+ */
+uint32_t lv_display_get_render_cost(lv_display_t * disp);
+
 void lv_display_set_user_data(lv_display_t * disp, void * user_data);
 void lv_display_set_driver_data(lv_display_t * disp, void * driver_data);
 void * lv_display_get_user_data(lv_display_t * disp);
@@ -17,6 +17,7 @@ extern "C" {
 #include "../core/lv_obj.h"
 #include "../draw/lv_draw.h"
 #include "lv_display.h"
+#include "../misc/lv_atomic.h"
 
 #if LV_USE_SYSMON
 #include "../others/sysmon/lv_sysmon_private.h"
@@ -29,10 +30,42 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
 #endif
 
+#ifndef LV_DISPLAY_FLUSH_DELTA_FULL_PERIOD
+/** With delta flushing flush the whole screen after this many refreshes.
+ *  Hash collisions can't leave stale pixels on the panel for longer.*/
+#define LV_DISPLAY_FLUSH_DELTA_FULL_PERIOD 300
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_DISPLAY_RENDER_THREAD
+/** A part of a frame which is rendered and flushed at once by the render thread*/
+typedef struct {
+    lv_area_t area;                 /**< The area to render*/
+    lv_draw_task_t * task_head;     /**< The recorded and detached draw tasks of the area*/
+    uint32_t last_area  : 1;        /**< 1: it's the last area of the frame*/
+    uint32_t last_part  : 1;        /**< 1: it's the last part of the area*/
+} lv_display_render_part_t;
+
+/** Renders the draw tasks recorded by `lv_timer_handler()` on a separate thread*/
+typedef struct {
+    lv_thread_t thread;
+    lv_thread_sync_t sync;          /**< Signaled when a frame is ready to render or a draw task is finished*/
+    lv_thread_sync_t done_sync;     /**< Signaled when a frame is rendered*/
+
+    lv_display_render_part_t * parts;   /**< The parts of the frame to render*/
+    uint32_t part_cnt;
+    uint32_t part_capacity;
+
+    volatile uint32_t busy;         /**< 1: the parts are being rendered, don't touch them. Use `lv_atomic_...`*/
+    volatile uint32_t exit;         /**< 1: exit the thread. Use `lv_atomic_...`*/
+    bool recording;                 /**< true: record the parts instead of rendering them*/
+    bool record_failed;             /**< true: something couldn't be recorded, render the frame as usual*/
+} lv_display_render_thread_t;
+#endif
+
 struct _lv_display_t {
 
     /*---------------------
@@ -99,6 +132,24 @@ struct _lv_display_t {
 
     lv_color_format_t   color_format;
 
+    /** Convert the rendered image to this color format before flushing.
+     * `LV_COLOR_FORMAT_UNKNOWN` to flush in `color_format`*/
+    lv_color_format_t   flush_color_format;
+    uint32_t flush_dither : 1;      /**< 1: use ordered dithering when converting for flushing*/
+
+    /** The converted image if it can't be converted in place. Allocated on demand.*/
+    lv_draw_buf_t * flush_buf;
+
+    /** Width of the blocks compared in delta flushing. 0: delta flushing is disabled*/
+    uint32_t flush_delta_block_w;
+
+    /** Hashes of the last flushed pixels of the blocks, row by row. 0 means unknown. Allocated on demand.*/
+    uint32_t * flush_delta_hashes;
+    int32_t flush_delta_col_cnt;
+    int32_t flush_delta_row_cnt;
+    uint32_t flush_delta_refr_cnt;  /**< Refreshes since the last full flush*/
+    lv_display_flush_delta_stats_t flush_delta_stats;
+
     /** Invalidated (marked to redraw) areas*/
     lv_area_t inv_areas[LV_INV_BUF_SIZE];
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
@@ -117,6 +168,15 @@ struct _lv_display_t {
     void (*layer_init)(lv_display_t * disp, lv_layer_t * layer);
     void (*layer_deinit)(lv_display_t * disp, lv_layer_t * layer);
 
+    /** The draw units which can render this display. Bit N is the draw unit with index N.
+     * 0: the draw units not reserved by other displays*/
+    uint32_t draw_unit_mask;
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+    /** Renders the display on its own thread. NULL if not enabled.*/
+    lv_display_render_thread_t * render_thread;
+#endif
+
     /*---------------------
      * Screens
      *--------------------*/
@@ -156,6 +216,16 @@ struct _lv_display_t {
     /** The area being refreshed*/
     lv_area_t refreshed_area;
 
+    /*---------------------
+     * Frame scheduling
+     *--------------------*/
+    uint32_t vsync_last;            /**< Time of the last reported vsync*/
+    bool vsync_reported;            /**< true: `vsync_last` is valid*/
+    uint32_t vsync_period_us;       /**< Estimated time between the vsyncs. 0: unknown*/
+    uint32_t render_start;          /**< Time when rendering of the last frame was started*/
+    volatile uint32_t render_cost_us;   /**< Predicted time of rendering a frame. Use `lv_atomic_...`
+                                         *   as the render thread of the display updates it*/
+
 #if LV_USE_PERF_MONITOR
     lv_obj_t * perf_label;
     lv_sysmon_backend_data_t perf_sysmon_backend;
@@ -17,6 +17,14 @@
 #include "../core/lv_global.h"
 #include "../core/lv_refr_private.h"
 #include "../stdlib/lv_string.h"
+#include "lv_draw_rect.h"
+#include "lv_draw_label.h"
+#include "lv_draw_image.h"
+#include "lv_draw_line.h"
+#include "lv_draw_arc.h"
+#include "lv_draw_triangle.h"
+#include "lv_draw_mask_private.h"
+#include "lv_draw_vector_private.h"
 
 /*********************
  *      DEFINES
@@ -31,6 +39,15 @@
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
+#if LV_DRAW_OCCLUSION_CULLING
+    static void cull_covered_tasks(lv_layer_t * layer, lv_draw_task_t * t_top);
+    static bool get_opaque_area(const lv_draw_task_t * t, lv_area_t * opaque_area);
+    static bool is_cullable(const lv_draw_task_t * t, const lv_draw_task_t * t_top);
+#endif
+#if LV_DRAW_RECORDER
+    static size_t get_recordable_dsc_size(lv_draw_task_type_t type);
+    static bool is_recorded_layer(const lv_layer_t * layer);
+#endif
 
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
 {
@@ -57,6 +74,10 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+#if LV_USE_DISPLAY_RENDER_THREAD
+    lv_mutex_init(&_draw_info.dispatch_mutex);
+    lv_ll_init(&_draw_info.dispatch_sync_ll, sizeof(lv_thread_sync_t *));
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -74,6 +95,12 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+    /*The draw units might request dispatching until they are deleted*/
+    lv_mutex_delete(&_draw_info.dispatch_mutex);
+    lv_ll_clear(&_draw_info.dispatch_sync_ll);
+#endif
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -81,6 +108,7 @@ void * lv_draw_create_unit(size_t size)
     lv_draw_unit_t * new_unit = lv_malloc_zeroed(size);
 
     new_unit->next = _draw_info.unit_head;
+    new_unit->idx = _draw_info.unit_cnt;
     _draw_info.unit_head = new_unit;
     _draw_info.unit_cnt++;
 
@@ -123,6 +151,28 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
 
     lv_draw_global_info_t * info = &_draw_info;
 
+#if LV_DRAW_RECORDER
+    lv_draw_recorder_t * recorder = info->recorder;
+    if(recorder && layer == &recorder->layer) {
+        /*Only check if the task can be replayed. The draw units will evaluate the replayed copies*/
+        if(get_recordable_dsc_size(t->type) == 0) recorder->failed = true;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        /*The clip area of transformed tasks can't be adjusted when replaying*/
+        if(lv_memcmp(&t->matrix, &recorder->matrix, sizeof(lv_matrix_t)) != 0) recorder->failed = true;
+#endif
+
+        /*The event is sent only once, so the changes made in the event are recorded too*/
+        if(info->task_running == false && base_dsc->obj &&
+           lv_obj_has_flag(base_dsc->obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+            info->task_running = true;
+            lv_obj_send_event(base_dsc->obj, LV_EVENT_DRAW_TASK_ADDED, t);
+            info->task_running = false;
+        }
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
      *and not on the draw tasks added in the event.
      *Sending LV_EVENT_DRAW_TASK_ADDED events might cause recursive event sends and besides
@@ -144,6 +194,11 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             u = u->next;
         }
 
+#if LV_DRAW_OCCLUSION_CULLING
+        /*Only the draw tasks not taken by a draw unit yet are culled,
+         *so the earlier ones can be rendered while the next ones are added*/
+        cull_covered_tasks(layer, t);
+#endif
         lv_draw_dispatch();
     }
     else {
@@ -162,9 +217,10 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
 void lv_draw_wait_for_finish(void)
 {
 #if LV_USE_OS
+    uint32_t unit_mask = lv_draw_get_unit_mask(NULL);
     lv_draw_unit_t * u = _draw_info.unit_head;
     while(u) {
-        if(u->wait_for_finish_cb)
+        if(u->wait_for_finish_cb && (u->idx >= 32 || (unit_mask & (1UL << u->idx))))
             u->wait_for_finish_cb(u);
         u = u->next;
     }
@@ -177,6 +233,13 @@ void lv_draw_dispatch(void)
     bool task_dispatched = false;
     lv_display_t * disp = lv_display_get_next(NULL);
     while(disp) {
+#if LV_USE_DISPLAY_RENDER_THREAD
+        /*The display's own thread dispatches its layers while it's rendering*/
+        if(disp->render_thread && lv_atomic_load(&disp->render_thread->busy)) {
+            disp = lv_display_get_next(disp);
+            continue;
+        }
+#endif
         lv_layer_t * layer = disp->layer_head;
         while(layer) {
             if(lv_draw_dispatch_layer(disp, layer))
@@ -195,6 +258,12 @@ void lv_draw_dispatch(void)
 bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
 {
     LV_PROFILER_DRAW_BEGIN;
+#if LV_USE_DISPLAY_RENDER_THREAD
+    /* Displays rendered on their own thread might dispatch to the same draw units and
+     * free the layers and update the used layer memory at the same time*/
+    lv_mutex_lock(&_draw_info.dispatch_mutex);
+#endif
+
     /*Remove the finished tasks first*/
     lv_draw_task_t * t_prev = NULL;
     lv_draw_task_t * t = layer->draw_task_head;
@@ -250,6 +319,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
     }
 
     bool task_dispatched = false;
+    bool layer_ready = false;
 
     /*This layer is ready, enable blending its buffer*/
     if(layer->parent && layer->all_tasks_added && layer->draw_task_head == NULL) {
@@ -260,7 +330,7 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
                 lv_draw_image_dsc_t * draw_dsc = t_src->draw_dsc;
                 if(draw_dsc->src == layer) {
                     t_src->state = LV_DRAW_TASK_STATE_QUEUED;
-                    lv_draw_dispatch_request();
+                    layer_ready = true;
                     break;
                 }
             }
@@ -271,14 +341,24 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
     else {
         /*Find a draw unit which is not busy and can take at least one task*/
         /*Let all draw units to pick draw tasks*/
+        uint32_t unit_mask = lv_draw_get_unit_mask(disp);
         lv_draw_unit_t * u = _draw_info.unit_head;
         while(u) {
-            int32_t taken_cnt = u->dispatch_cb(u, layer);
-            if(taken_cnt != LV_DRAW_UNIT_IDLE) task_dispatched = true;
+            if(u->idx >= 32 || (unit_mask & (1UL << u->idx))) {
+                int32_t taken_cnt = u->dispatch_cb(u, layer);
+                if(taken_cnt != LV_DRAW_UNIT_IDLE) task_dispatched = true;
+            }
             u = u->next;
         }
     }
 
+#if LV_USE_DISPLAY_RENDER_THREAD
+    lv_mutex_unlock(&_draw_info.dispatch_mutex);
+#endif
+
+    /*Requested after unlocking because it takes the mutex too*/
+    if(layer_ready) lv_draw_dispatch_request();
+
     LV_PROFILER_DRAW_END;
     return task_dispatched;
 }
@@ -297,11 +377,56 @@ void lv_draw_dispatch_request(void)
 {
 #if LV_USE_OS
     lv_thread_sync_signal(&_draw_info.sync);
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+    lv_mutex_lock(&_draw_info.dispatch_mutex);
+    lv_thread_sync_t ** sync;
+    LV_LL_READ(&_draw_info.dispatch_sync_ll, sync) {
+        lv_thread_sync_signal(*sync);
+    }
+    lv_mutex_unlock(&_draw_info.dispatch_mutex);
+#endif
 #else
     _draw_info.dispatch_req = 1;
 #endif
 }
 
+#if LV_USE_DISPLAY_RENDER_THREAD
+void lv_draw_add_dispatch_sync(lv_thread_sync_t * sync)
+{
+    lv_mutex_lock(&_draw_info.dispatch_mutex);
+    lv_thread_sync_t ** new_sync = lv_ll_ins_tail(&_draw_info.dispatch_sync_ll);
+    LV_ASSERT_MALLOC(new_sync);
+    if(new_sync) *new_sync = sync;
+    lv_mutex_unlock(&_draw_info.dispatch_mutex);
+}
+
+void lv_draw_remove_dispatch_sync(lv_thread_sync_t * sync)
+{
+    lv_mutex_lock(&_draw_info.dispatch_mutex);
+    lv_thread_sync_t ** sync_i;
+    LV_LL_READ(&_draw_info.dispatch_sync_ll, sync_i) {
+        if(*sync_i == sync) {
+            lv_ll_remove(&_draw_info.dispatch_sync_ll, sync_i);
+            lv_free(sync_i);
+            break;
+        }
+    }
+    lv_mutex_unlock(&_draw_info.dispatch_mutex);
+}
+#endif
+
+uint32_t lv_draw_get_unit_mask(lv_display_t * disp)
+{
+    if(disp && disp->draw_unit_mask) return disp->draw_unit_mask;
+    return ~_draw_info.reserved_unit_mask;
+}
+
+void lv_draw_set_reserved_unit_mask(uint32_t mask)
+{
+    _draw_info.reserved_unit_mask = mask;
+}
+
 uint32_t lv_draw_get_unit_count(void)
 {
     return _draw_info.unit_cnt;
@@ -345,14 +470,18 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
 
     /*Handle the case of multiply draw units*/
 
-    /*If the first task is screen sized, there cannot be independent areas*/
+    /*If the first task covers the whole layer, there cannot be independent areas.
+     *The tiles share the buffer of the display's layer, so compare with the physical clip area,
+     *which is the tile's area. The clip area can't be used because the widgets narrow it
+     *while adding their draw tasks.*/
     if(layer->draw_task_head) {
-        int32_t hor_res = lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing());
-        int32_t ver_res = lv_display_get_vertical_resolution(lv_refr_get_disp_refreshing());
         lv_draw_task_t * t = layer->draw_task_head;
+        lv_area_t drawn_area;
+        lv_area_t layer_area;
         if(t->state != LV_DRAW_TASK_STATE_QUEUED &&
-           t->area.x1 <= 0 && t->area.x2 >= hor_res - 1 &&
-           t->area.y1 <= 0 && t->area.y2 >= ver_res - 1) {
+           lv_area_intersect(&drawn_area, &t->_real_area, &t->clip_area) &&
+           lv_area_intersect(&layer_area, &layer->buf_area, &layer->phy_clip_area) &&
+           lv_area_is_in(&layer_area, &drawn_area, 0)) {
             LV_PROFILER_DRAW_END;
             return NULL;
         }
@@ -431,6 +560,16 @@ void lv_draw_layer_init(lv_layer_t * layer, lv_layer_t * parent_layer, lv_color_
 
     if(disp->layer_init) disp->layer_init(disp, layer);
 
+#if LV_DRAW_RECORDER
+    /*Layers can't be replayed. Keep the layer out of the display's list
+     *so that it won't be dispatched, and drop the recording.*/
+    if(_draw_info.recorder && is_recorded_layer(parent_layer)) {
+        _draw_info.recorder->failed = true;
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
     if(disp->layer_head) {
         lv_layer_t * tail = disp->layer_head;
         while(tail->next) tail = tail->next;
@@ -463,6 +602,7 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
         return NULL;
     }
 
+    /*The draw units call it from their `dispatch_cb`, so `dispatch_mutex` is already taken if it's used*/
     _draw_info.used_memory_for_layers_kb += get_layer_size_kb(layer_size_byte);
     LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
 
@@ -493,6 +633,191 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
     *area = t->area;
 }
 
+#if LV_DRAW_RECORDER
+
+void lv_draw_recorder_begin(lv_draw_recorder_t * recorder, lv_layer_t * target_layer, const lv_area_t * clip_area)
+{
+    LV_ASSERT_NULL(recorder);
+    LV_ASSERT_NULL(target_layer);
+
+    lv_memzero(recorder, sizeof(lv_draw_recorder_t));
+
+    /*Not added to the display's layer list so its tasks are never dispatched*/
+    lv_layer_t * layer = &recorder->layer;
+    layer->parent = target_layer;
+    layer->draw_buf = target_layer->draw_buf;
+    layer->color_format = target_layer->color_format;
+    layer->buf_area = target_layer->buf_area;
+    layer->phy_clip_area = target_layer->phy_clip_area;
+    layer->_clip_area = *clip_area;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    layer->matrix = target_layer->matrix;
+    recorder->matrix = target_layer->matrix;
+#endif
+
+    recorder->prev = _draw_info.recorder;
+    _draw_info.recorder = recorder;
+}
+
+lv_draw_task_t * lv_draw_recorder_end(lv_draw_recorder_t * recorder)
+{
+    LV_ASSERT_MSG(_draw_info.recorder == recorder, "Recorders need to be ended in reverse order");
+
+    _draw_info.recorder = recorder->prev;
+
+    lv_draw_task_t * task_head = recorder->layer.draw_task_head;
+    recorder->layer.draw_task_head = NULL;
+
+    if(recorder->failed) {
+        lv_draw_recorder_free(task_head);
+        return NULL;
+    }
+
+    return task_head;
+}
+
+void lv_draw_recorder_replay(lv_layer_t * layer, const lv_draw_task_t * task_head)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    const lv_draw_task_t * t_rec;
+    for(t_rec = task_head; t_rec; t_rec = t_rec->next) {
+        lv_area_t clip_area;
+        if(!lv_area_intersect(&clip_area, &t_rec->clip_area, &layer->_clip_area)) continue;
+
+        lv_area_t real_area;
+        if(!lv_area_intersect(&real_area, &t_rec->_real_area, &clip_area)) continue;
+
+        size_t dsc_size = get_recordable_dsc_size(t_rec->type);
+        void * draw_dsc = lv_malloc(dsc_size);
+        LV_ASSERT_MALLOC(draw_dsc);
+        if(draw_dsc == NULL) break;
+        lv_memcpy(draw_dsc, t_rec->draw_dsc, dsc_size);
+
+        /*The recording owns the text, don't let the dispatcher free it*/
+        if(t_rec->type == LV_DRAW_TASK_TYPE_LABEL) {
+            lv_draw_label_dsc_t * label_dsc = draw_dsc;
+            label_dsc->text_local = 0;
+        }
+
+        lv_draw_task_t * t = lv_draw_add_task(layer, &t_rec->area);
+        t->type = t_rec->type;
+        t->_real_area = t_rec->_real_area;
+        t->clip_area = clip_area;
+        t->draw_dsc = draw_dsc;
+
+        /*Don't send LV_EVENT_DRAW_TASK_ADDED again as it was sent while recording*/
+        bool task_running_ori = _draw_info.task_running;
+        _draw_info.task_running = true;
+        lv_draw_finalize_task_creation(layer, t);
+        _draw_info.task_running = task_running_ori;
+
+#if LV_DRAW_OCCLUSION_CULLING
+        /*Finalizing doesn't cull the draw tasks added this way, so do it here*/
+        if(task_running_ori == false) cull_covered_tasks(layer, t);
+#endif
+    }
+
+    if(_draw_info.task_running == false) lv_draw_dispatch();
+    LV_PROFILER_DRAW_END;
+}
+
+lv_result_t lv_draw_recorder_detach(lv_draw_task_t * task_head)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    lv_draw_task_t * t;
+    for(t = task_head; t; t = t->next) {
+        if(t->type == LV_DRAW_TASK_TYPE_LABEL) {
+            lv_draw_label_dsc_t * label_dsc = t->draw_dsc;
+            /*The hint is stored in the label and updated while drawing*/
+            label_dsc->hint = NULL;
+            if(!label_dsc->text_local && label_dsc->text) {
+                label_dsc->text = lv_strdup(label_dsc->text);
+                LV_ASSERT_MALLOC(label_dsc->text);
+                if(label_dsc->text == NULL) {
+                    LV_PROFILER_DRAW_END;
+                    return LV_RESULT_INVALID;
+                }
+                label_dsc->text_local = 1;
+            }
+        }
+        else if(t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+            /*Store the file name after the descriptor so that they are freed together*/
+            lv_draw_image_dsc_t * image_dsc = t->draw_dsc;
+            lv_image_src_t src_type = lv_image_src_get_type(image_dsc->src);
+            if(src_type == LV_IMAGE_SRC_FILE || src_type == LV_IMAGE_SRC_SYMBOL) {
+                size_t len = lv_strlen(image_dsc->src) + 1;
+                image_dsc = lv_realloc(image_dsc, sizeof(lv_draw_image_dsc_t) + len);
+                LV_ASSERT_MALLOC(image_dsc);
+                if(image_dsc == NULL) {
+                    LV_PROFILER_DRAW_END;
+                    return LV_RESULT_INVALID;
+                }
+                lv_memcpy(image_dsc + 1, image_dsc->src, len);
+                image_dsc->src = image_dsc + 1;
+                t->draw_dsc = image_dsc;
+            }
+        }
+
+        /*Let the draw units set their preference score*/
+        t->preference_score = 100;
+        t->preferred_draw_unit_id = 0;
+        lv_draw_unit_t * u = _draw_info.unit_head;
+        while(u) {
+            if(u->evaluate_cb) u->evaluate_cb(u, t);
+            u = u->next;
+        }
+    }
+
+    LV_PROFILER_DRAW_END;
+    return LV_RESULT_OK;
+}
+
+void lv_draw_recorder_free(lv_draw_task_t * task_head)
+{
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    lv_draw_task_t * t = task_head;
+    while(t) {
+        lv_draw_task_t * t_next = t->next;
+
+        if(t->type == LV_DRAW_TASK_TYPE_LAYER) {
+            /*The layer was created while recording, so it wasn't dispatched. Free it here.*/
+            lv_draw_image_dsc_t * draw_image_dsc = t->draw_dsc;
+            lv_layer_t * layer_drawn = (lv_layer_t *)draw_image_dsc->src;
+            lv_draw_recorder_free(layer_drawn->draw_task_head);
+            if(disp && disp->layer_deinit) disp->layer_deinit(disp, layer_drawn);
+            lv_free(layer_drawn);
+        }
+#if LV_USE_VECTOR_GRAPHIC
+        else if(t->type == LV_DRAW_TASK_TYPE_VECTOR) {
+            lv_draw_vector_task_dsc_t * vector_dsc = t->draw_dsc;
+            if(vector_dsc->task_list) lv_vector_for_each_destroy_tasks(vector_dsc->task_list, NULL, NULL);
+        }
+#endif
+        else if(t->type == LV_DRAW_TASK_TYPE_LABEL) {
+            lv_draw_label_dsc_t * draw_label_dsc = t->draw_dsc;
+            if(draw_label_dsc->text_local) lv_free((void *)draw_label_dsc->text);
+        }
+
+        lv_free(t->draw_dsc);
+        lv_free(t);
+        t = t_next;
+    }
+}
+
+#endif /*LV_DRAW_RECORDER*/
+
+#if LV_DRAW_OCCLUSION_CULLING
+void lv_draw_occlusion_monitor(lv_draw_occlusion_monitor_t * mon_p)
+{
+    *mon_p = _draw_info.occlusion_mon;
+}
+
+void lv_draw_occlusion_monitor_reset(void)
+{
+    lv_memzero(&_draw_info.occlusion_mon, sizeof(lv_draw_occlusion_monitor_t));
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -523,3 +848,226 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 
     return true;
 }
+
+#if LV_DRAW_RECORDER
+
+/**
+ * Get the size of the draw descriptor of a draw task type if it can be replayed.
+ * @param type      type of a draw task
+ * @return          size of the draw descriptor or 0 if the draw task can't be replayed
+ */
+static size_t get_recordable_dsc_size(lv_draw_task_type_t type)
+{
+    switch(type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+            return sizeof(lv_draw_fill_dsc_t);
+        case LV_DRAW_TASK_TYPE_BORDER:
+            return sizeof(lv_draw_border_dsc_t);
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+            return sizeof(lv_draw_box_shadow_dsc_t);
+        case LV_DRAW_TASK_TYPE_LABEL:
+            return sizeof(lv_draw_label_dsc_t);
+        case LV_DRAW_TASK_TYPE_IMAGE:
+            return sizeof(lv_draw_image_dsc_t);
+        case LV_DRAW_TASK_TYPE_LINE:
+            return sizeof(lv_draw_line_dsc_t);
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+            /*The points are stored after the descriptor in the recorded task which is kept while replaying*/
+            return sizeof(lv_draw_polyline_dsc_t);
+        case LV_DRAW_TASK_TYPE_ARC:
+            return sizeof(lv_draw_arc_dsc_t);
+        case LV_DRAW_TASK_TYPE_TRIANGLE:
+            return sizeof(lv_draw_triangle_dsc_t);
+        case LV_DRAW_TASK_TYPE_MASK_RECTANGLE:
+            return sizeof(lv_draw_mask_rect_dsc_t);
+        default:
+            /*Layers and vector graphics are consumed while rendering*/
+            return 0;
+    }
+}
+
+/**
+ * Check if a layer is the layer of the active recorder or its descendant
+ * @param layer     pointer to a layer
+ * @return          true: the layer is recorded
+ */
+static bool is_recorded_layer(const lv_layer_t * layer)
+{
+    const lv_layer_t * rec_layer = &_draw_info.recorder->layer;
+    while(layer) {
+        if(layer == rec_layer) return true;
+        layer = layer->parent;
+    }
+
+    return false;
+}
+
+#endif /*LV_DRAW_RECORDER*/
+
+#if LV_DRAW_OCCLUSION_CULLING
+/**
+ * Drop the queued draw tasks of a layer which are fully covered by a new draw task,
+ * and clip the ones which are covered on one side.
+ * @param layer     the layer whose draw tasks should be checked
+ * @param t_top     the new draw task that might cover the earlier ones
+ */
+static void cull_covered_tasks(lv_layer_t * layer, lv_draw_task_t * t_top)
+{
+    lv_area_t opaque_area;
+    if(!get_opaque_area(t_top, &opaque_area)) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+#if LV_USE_DISPLAY_RENDER_THREAD
+    /*A render thread might dispatch at the same time. Hold the lock so that
+     *no draw unit can take a task while it's checked and clipped.*/
+    lv_mutex_lock(&_draw_info.dispatch_mutex);
+#endif
+
+    lv_draw_occlusion_monitor_t * mon = &_draw_info.occlusion_mon;
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t && t != t_top) {
+        lv_area_t drawn_area;
+        /*Only the queued tasks are not taken by a draw unit yet*/
+        if(t->state != LV_DRAW_TASK_STATE_QUEUED || !is_cullable(t, t_top) ||
+           !lv_area_intersect(&drawn_area, &t->_real_area, &t->clip_area)) {
+            t = t->next;
+            continue;
+        }
+
+        if(lv_area_is_in(&drawn_area, &opaque_area, 0)) {
+            /*Nothing of it will be visible. Ready tasks are removed on the next dispatch*/
+            t->state = LV_DRAW_TASK_STATE_READY;
+            mon->culled_task_cnt++;
+            mon->saved_px_cnt += lv_area_get_size(&drawn_area);
+        }
+        else {
+            /*If a whole side is covered the rest is still a rectangle*/
+            lv_area_t clip = t->clip_area;
+            bool covers_w = opaque_area.x1 <= drawn_area.x1 && opaque_area.x2 >= drawn_area.x2;
+            bool covers_h = opaque_area.y1 <= drawn_area.y1 && opaque_area.y2 >= drawn_area.y2;
+            if(covers_w && opaque_area.y1 <= drawn_area.y1 && opaque_area.y2 >= drawn_area.y1) clip.y1 = opaque_area.y2 + 1;
+            else if(covers_w && opaque_area.y1 <= drawn_area.y2 && opaque_area.y2 >= drawn_area.y2) clip.y2 = opaque_area.y1 - 1;
+            else if(covers_h && opaque_area.x1 <= drawn_area.x1 && opaque_area.x2 >= drawn_area.x1) clip.x1 = opaque_area.x2 + 1;
+            else if(covers_h && opaque_area.x1 <= drawn_area.x2 && opaque_area.x2 >= drawn_area.x2) clip.x2 = opaque_area.x1 - 1;
+
+            if(!lv_area_is_equal(&clip, &t->clip_area)) {
+                lv_area_t clipped_area;
+                lv_area_intersect(&clipped_area, &t->_real_area, &clip);
+                mon->clipped_task_cnt++;
+                mon->saved_px_cnt += lv_area_get_size(&drawn_area) - lv_area_get_size(&clipped_area);
+                t->clip_area = clip;
+            }
+        }
+
+        t = t->next;
+    }
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+    lv_mutex_unlock(&_draw_info.dispatch_mutex);
+#endif
+    LV_PROFILER_DRAW_END;
+}
+
+/**
+ * Get the area which is surely covered by a draw task with fully opaque pixels
+ * @param t             the draw task to check
+ * @param opaque_area   store the result here
+ * @return              true: there is such an area, false: the draw task might let the earlier draw tasks through
+ */
+static bool get_opaque_area(const lv_draw_task_t * t, lv_area_t * opaque_area)
+{
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(!lv_matrix_is_identity_or_translation(&t->matrix)) return false;
+#endif
+
+    lv_area_t area = t->area;
+    if(t->type == LV_DRAW_TASK_TYPE_FILL) {
+        const lv_draw_fill_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX) return false;
+        if(dsc->grad.dir != LV_GRAD_DIR_NONE) {
+            uint32_t i;
+            for(i = 0; i < dsc->grad.stops_count; i++) {
+                if(dsc->grad.stops[i].opa < LV_OPA_MAX) return false;
+            }
+        }
+
+        /*Use the larger of the two rectangles not affected by the rounded corners*/
+        int32_t w = lv_area_get_width(&area);
+        int32_t h = lv_area_get_height(&area);
+        int32_t r = LV_MIN(dsc->radius, LV_MIN(w, h) / 2);
+        if(r > 0) {
+            if(w > h) {
+                area.x1 += r;
+                area.x2 -= r;
+            }
+            else {
+                area.y1 += r;
+                area.y2 -= r;
+            }
+        }
+    }
+    else if(t->type == LV_DRAW_TASK_TYPE_IMAGE || t->type == LV_DRAW_TASK_TYPE_LAYER) {
+        const lv_draw_image_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX) return false;
+        if(dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+        if(dsc->rotation != 0 || dsc->skew_x != 0 || dsc->skew_y != 0) return false;
+        if(dsc->scale_x != LV_SCALE_NONE || dsc->scale_y != LV_SCALE_NONE) return false;
+        if(dsc->clip_radius > 0 || dsc->bitmap_mask_src) return false;
+
+        lv_color_format_t cf;
+        if(t->type == LV_DRAW_TASK_TYPE_LAYER) {
+            const lv_layer_t * layer_to_draw = dsc->src;
+            cf = layer_to_draw->color_format;
+        }
+        else {
+            cf = dsc->header.cf;
+        }
+        if(lv_color_format_has_alpha(cf) || LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf)) return false;
+
+        /*Not tiled images are drawn only on their own area*/
+        if(t->type == LV_DRAW_TASK_TYPE_IMAGE && !dsc->tile && dsc->image_area.x2 != LV_COORD_MIN) {
+            if(!lv_area_intersect(&area, &area, &dsc->image_area)) return false;
+        }
+    }
+    else {
+        return false;
+    }
+
+    /*Only the clip area is drawn*/
+    return lv_area_intersect(opaque_area, &area, &t->clip_area);
+}
+
+/**
+ * Tell if a draw task can be skipped when it's covered.
+ * Masks modify the earlier content and the vector tasks can use any area so they are always drawn.
+ * @param t         the draw task to check
+ * @param t_top     the draw task covering `t`
+ * @return          true: the draw task can be dropped or clipped
+ */
+static bool is_cullable(const lv_draw_task_t * t, const lv_draw_task_t * t_top)
+{
+    switch(t->type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+        case LV_DRAW_TASK_TYPE_BORDER:
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+        case LV_DRAW_TASK_TYPE_LABEL:
+        case LV_DRAW_TASK_TYPE_IMAGE:
+        case LV_DRAW_TASK_TYPE_LINE:
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+        case LV_DRAW_TASK_TYPE_ARC:
+        case LV_DRAW_TASK_TYPE_TRIANGLE:
+            break;
+        default:
+            return false;
+    }
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    /*The areas can be compared only in the same coordinate system*/
+    if(lv_memcmp(&t->matrix, &t_top->matrix, sizeof(lv_matrix_t)) != 0) return false;
+#else
+    LV_UNUSED(t_top);
+#endif
+
+    return true;
+}
+#endif /*LV_DRAW_OCCLUSION_CULLING*/
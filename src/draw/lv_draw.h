@@ -58,6 +58,7 @@ typedef enum {
     LV_DRAW_TASK_TYPE_MASK_RECTANGLE,
     LV_DRAW_TASK_TYPE_MASK_BITMAP,
     LV_DRAW_TASK_TYPE_VECTOR,
+    LV_DRAW_TASK_TYPE_POLYLINE,
 } lv_draw_task_type_t;
 
 typedef enum {
@@ -117,6 +118,14 @@ typedef struct {
     void * user_data;
 } lv_draw_dsc_base_t;
 
+#if LV_DRAW_OCCLUSION_CULLING
+typedef struct {
+    uint32_t culled_task_cnt;   /**< Number of draw tasks dropped because they were fully covered*/
+    uint32_t clipped_task_cnt;  /**< Number of draw tasks whose clip area was reduced*/
+    uint32_t saved_px_cnt;      /**< Number of pixels that were not drawn thanks to the above*/
+} lv_draw_occlusion_monitor_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -268,6 +277,19 @@ void * lv_draw_task_get_draw_dsc(const lv_draw_task_t * t);
 */
 void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area);
 
+#if LV_DRAW_OCCLUSION_CULLING
+/**
+ * Get how many draw tasks and pixels were skipped because a later opaque draw task covered them
+ * @param mon_p  pointer to a `lv_draw_occlusion_monitor_t` variable, the result will be stored here
+ */
+void lv_draw_occlusion_monitor(lv_draw_occlusion_monitor_t * mon_p);
+
+/**
+ * Reset the counters of `lv_draw_occlusion_monitor()`
+ */
+void lv_draw_occlusion_monitor_reset(void);
+#endif
+
 /**********************
  *  GLOBAL VARIABLES
  **********************/
@@ -12,6 +12,7 @@
 #include "../core/lv_global.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_area_private.h"
+#include "sw/lv_draw_sw.h"
 
 /*********************
  *      DEFINES
@@ -36,10 +37,25 @@ static void draw_buf_free(const lv_draw_buf_handlers_t * handler, void * buf);
 static uint32_t width_to_stride(uint32_t w, lv_color_format_t color_format);
 static uint32_t _calculate_draw_buf_size(uint32_t w, uint32_t h, lv_color_format_t cf, uint32_t stride);
 static void draw_buf_get_full_area(const lv_draw_buf_t * draw_buf, lv_area_t * full_area);
+static void convert_row_to_rgb565(const uint8_t * src, uint32_t src_px_size, uint16_t * dest, int32_t w,
+                                  const uint8_t * dither_row, int32_t x_ofs, bool swap);
+static void convert_row_to_l8(const uint8_t * src, uint32_t src_px_size, uint8_t * dest, int32_t w);
+static void convert_row_to_i1(const uint8_t * src, uint32_t src_px_size, uint8_t * dest, int32_t dest_bit, int32_t w,
+                              const uint8_t * dither_row, int32_t x_ofs);
+#if LV_USE_DRAW_SW == 0
+    static void swap_row_rgb565(uint16_t * buf, int32_t w);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+/*4x4 Bayer matrix for ordered dithering*/
+static const uint8_t dither_matrix[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+};
 
 /**********************
  *      MACROS
@@ -532,6 +548,63 @@ lv_result_t lv_draw_buf_premultiply(lv_draw_buf_t * draw_buf)
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_draw_buf_convert_color_format(const void * src, int32_t src_stride, lv_color_format_t src_cf,
+                                             void * dest, int32_t dest_stride, lv_color_format_t dest_cf,
+                                             const lv_area_t * buf_area, const lv_area_t * area, bool dither)
+{
+    bool src_rgb565 = src_cf == LV_COLOR_FORMAT_RGB565;
+    if(src_rgb565) {
+        if(dest_cf != LV_COLOR_FORMAT_RGB565_SWAPPED) return LV_RESULT_INVALID;
+    }
+    else if(src_cf != LV_COLOR_FORMAT_XRGB8888 && src_cf != LV_COLOR_FORMAT_ARGB8888 &&
+            src_cf != LV_COLOR_FORMAT_RGB888) {
+        return LV_RESULT_INVALID;
+    }
+
+    if(dest_cf != LV_COLOR_FORMAT_RGB565 && dest_cf != LV_COLOR_FORMAT_RGB565_SWAPPED &&
+       dest_cf != LV_COLOR_FORMAT_L8 && dest_cf != LV_COLOR_FORMAT_I1) {
+        return LV_RESULT_INVALID;
+    }
+
+    LV_PROFILER_DRAW_BEGIN;
+    uint32_t src_px_size = lv_color_format_get_size(src_cf);
+    int32_t x_ofs = area->x1 - buf_area->x1;
+    int32_t y_ofs = area->y1 - buf_area->y1;
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+
+    /*Go from top to bottom and left to right so that each pixel is read before it's overwritten in place*/
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * src_row = (const uint8_t *)src + (y + y_ofs) * src_stride + x_ofs * src_px_size;
+        uint8_t * dest_row = (uint8_t *)dest + (y + y_ofs) * dest_stride;
+        const uint8_t * dither_row = dither ? dither_matrix[(area->y1 + y) & 0x3] : NULL;
+
+        if(src_rgb565) {
+            dest_row += x_ofs * 2;
+            if(dest_row != src_row) lv_memmove(dest_row, src_row, w * 2);
+#if LV_USE_DRAW_SW
+            lv_draw_sw_rgb565_swap(dest_row, w);    /*It can be optimized for the platform*/
+#else
+            swap_row_rgb565((uint16_t *)dest_row, w);
+#endif
+        }
+        else if(dest_cf == LV_COLOR_FORMAT_I1) {
+            convert_row_to_i1(src_row, src_px_size, dest_row, x_ofs, w, dither_row, area->x1);
+        }
+        else if(dest_cf == LV_COLOR_FORMAT_L8) {
+            convert_row_to_l8(src_row, src_px_size, dest_row + x_ofs, w);
+        }
+        else {
+            convert_row_to_rgb565(src_row, src_px_size, (uint16_t *)dest_row + x_ofs, w, dither_row, area->x1,
+                                  dest_cf == LV_COLOR_FORMAT_RGB565_SWAPPED);
+        }
+    }
+
+    LV_PROFILER_DRAW_END;
+    return LV_RESULT_OK;
+}
+
 void lv_draw_buf_set_palette(lv_draw_buf_t * draw_buf, uint8_t index, lv_color32_t color)
 {
     LV_ASSERT_NULL(draw_buf);
@@ -667,3 +740,100 @@ static void draw_buf_get_full_area(const lv_draw_buf_t * draw_buf, lv_area_t * f
     const lv_image_header_t * header = &draw_buf->header;
     lv_area_set(full_area, 0, 0, header->w - 1, header->h - 1);
 }
+
+/**
+ * Convert a row of XRGB8888, ARGB8888 or RGB888 pixels to RGB565
+ * @param src           pointer to the first source pixel
+ * @param src_px_size   size of a source pixel in bytes
+ * @param dest          pointer to the first destination pixel
+ * @param w             number of pixels to convert
+ * @param dither_row    the row of the dither matrix to use or NULL to truncate the colors
+ * @param x_ofs         the x coordinate of the first pixel on the screen
+ * @param swap          true: swap the 2 bytes of the result
+ */
+static void convert_row_to_rgb565(const uint8_t * src, uint32_t src_px_size, uint16_t * dest, int32_t w,
+                                  const uint8_t * dither_row, int32_t x_ofs, bool swap)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint32_t blue = src[0];
+        uint32_t green = src[1];
+        uint32_t red = src[2];
+        if(dither_row) {
+            /*Red and blue lose 3 bits (step 8), green 2 bits (step 4). Scale the 0..15 threshold to them.*/
+            uint32_t d = dither_row[(x + x_ofs) & 0x3];
+            red = LV_MIN(red + (d >> 1), 255);
+            green = LV_MIN(green + (d >> 2), 255);
+            blue = LV_MIN(blue + (d >> 1), 255);
+        }
+
+        uint16_t c = (uint16_t)(((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3));
+        if(swap) c = (uint16_t)((c >> 8) | (c << 8));
+        dest[x] = c;
+        src += src_px_size;
+    }
+}
+
+/**
+ * Convert a row of XRGB8888, ARGB8888 or RGB888 pixels to L8
+ * @param src           pointer to the first source pixel
+ * @param src_px_size   size of a source pixel in bytes
+ * @param dest          pointer to the first destination pixel
+ * @param w             number of pixels to convert
+ */
+static void convert_row_to_l8(const uint8_t * src, uint32_t src_px_size, uint8_t * dest, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        dest[x] = (uint8_t)((77u * src[2] + 151u * src[1] + 28u * src[0]) >> 8);
+        src += src_px_size;
+    }
+}
+
+/**
+ * Convert a row of XRGB8888, ARGB8888 or RGB888 pixels to I1. Bright pixels are set to 1.
+ * @param src           pointer to the first source pixel
+ * @param src_px_size   size of a source pixel in bytes
+ * @param dest          pointer to the first byte of the destination row
+ * @param dest_bit      index of the first pixel's bit in the destination row
+ * @param w             number of pixels to convert
+ * @param dither_row    the row of the dither matrix to use or NULL to use a fixed threshold
+ * @param x_ofs         the x coordinate of the first pixel on the screen
+ */
+static void convert_row_to_i1(const uint8_t * src, uint32_t src_px_size, uint8_t * dest, int32_t dest_bit, int32_t w,
+                              const uint8_t * dither_row, int32_t x_ofs)
+{
+    dest += dest_bit >> 3;
+    uint32_t bit = dest_bit & 0x7;
+
+    /*Collect the pixels of a byte before writing it, so that no unread source pixel is overwritten in place*/
+    uint8_t byte = bit ? *dest & (uint8_t)(0xFF << (8 - bit)) : 0;
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        uint32_t threshold = dither_row ? dither_row[(x + x_ofs) & 0x3] * 16 + 8 : 128;
+        uint32_t lum = (77u * src[2] + 151u * src[1] + 28u * src[0]) >> 8;
+        if(lum >= threshold) byte |= 0x80 >> bit;
+        src += src_px_size;
+
+        bit++;
+        if(bit == 8) {
+            *dest = byte;
+            dest++;
+            byte = 0;
+            bit = 0;
+        }
+    }
+
+    /*Keep the pixels after the converted ones*/
+    if(bit) *dest = byte | (*dest & (0xFF >> bit));
+}
+
+#if LV_USE_DRAW_SW == 0
+static void swap_row_rgb565(uint16_t * buf, int32_t w)
+{
+    int32_t x;
+    for(x = 0; x < w; x++) {
+        buf[x] = (uint16_t)((buf[x] >> 8) | (buf[x] << 8));
+    }
+}
+#endif
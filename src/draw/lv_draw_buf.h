@@ -307,6 +307,24 @@ lv_result_t lv_draw_buf_adjust_stride(lv_draw_buf_t * src, uint32_t stride);
  */
 lv_result_t lv_draw_buf_premultiply(lv_draw_buf_t * draw_buf);
 
+/**
+ * Convert an area of a buffer to an other color format, e.g. to the color format of the display before flushing.
+ * The conversion can be done in place if `area` is the whole buffer and `dest_stride <= src_stride`.
+ * @param src           pointer to the first pixel of the source buffer
+ * @param src_stride    source stride in bytes (number of bytes in a row)
+ * @param src_cf        LV_COLOR_FORMAT_XRGB8888/ARGB8888/RGB888, or RGB565 if `dest_cf` is RGB565_SWAPPED
+ * @param dest          pointer to the first pixel of the destination buffer (after the palette for I1)
+ * @param dest_stride   destination stride in bytes (number of bytes in a row)
+ * @param dest_cf       LV_COLOR_FORMAT_RGB565/RGB565_SWAPPED/L8/I1
+ * @param buf_area      the area of the buffers on the screen
+ * @param area          the area to convert, relative to the screen. The dithering pattern is aligned to the screen.
+ * @param dither        true: use a 4x4 ordered dithering to hide the banding caused by the fewer colors
+ * @return              LV_RESULT_OK: converted; LV_RESULT_INVALID: the conversion is not supported
+ */
+lv_result_t lv_draw_buf_convert_color_format(const void * src, int32_t src_stride, lv_color_format_t src_cf,
+                                             void * dest, int32_t dest_stride, lv_color_format_t dest_cf,
+                                             const lv_area_t * buf_area, const lv_area_t * area, bool dither);
+
 bool lv_draw_buf_has_flag(const lv_draw_buf_t * draw_buf, lv_image_flags_t flag);
 
 void lv_draw_buf_set_flag(lv_draw_buf_t * draw_buf, lv_image_flags_t flag);
@@ -34,6 +34,10 @@ static void img_decode_and_draw(lv_draw_unit_t * draw_unit, const lv_draw_image_
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
                                 lv_draw_image_core_cb draw_core_cb);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+static void draw_async_placeholder(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * coords);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -106,6 +110,16 @@ void lv_draw_image(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
 
     LV_PROFILER_DRAW_BEGIN;
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*The image is being decoded in the background. Draw the placeholder now and
+     *the object will be invalidated when the decoded image is in the cache.*/
+    if(!lv_image_decoder_async_is_ready(dsc->src, dsc->base.obj)) {
+        draw_async_placeholder(layer, dsc, coords);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
     lv_draw_image_dsc_t * new_image_dsc = lv_malloc(sizeof(*dsc));
     lv_memcpy(new_image_dsc, dsc, sizeof(*dsc));
     lv_result_t res = lv_image_decoder_get_info(new_image_dsc->src, &new_image_dsc->header);
@@ -317,3 +331,32 @@ static void img_decode_and_draw(lv_draw_unit_t * draw_unit, const lv_draw_image_
         }
     }
 }
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+static void draw_async_placeholder(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * coords)
+{
+    const void * placeholder = lv_image_decoder_get_async_placeholder();
+    if(placeholder == NULL || placeholder == dsc->src) return;
+
+    lv_image_header_t header;
+    if(lv_image_decoder_get_info(placeholder, &header) != LV_RESULT_OK) return;
+
+    /*Draw the placeholder in its original size on the center of the image*/
+    lv_area_t area;
+    lv_area_set(&area, 0, 0, header.w - 1, header.h - 1);
+    lv_area_align(coords, &area, LV_ALIGN_CENTER, 0, 0);
+
+    lv_draw_image_dsc_t placeholder_dsc = *dsc;
+    placeholder_dsc.src = placeholder;
+    placeholder_dsc.rotation = 0;
+    placeholder_dsc.scale_x = LV_SCALE_NONE;
+    placeholder_dsc.scale_y = LV_SCALE_NONE;
+    placeholder_dsc.skew_x = 0;
+    placeholder_dsc.skew_y = 0;
+    placeholder_dsc.tile = 0;
+    placeholder_dsc.image_area = area;
+    placeholder_dsc.pivot.x = header.w / 2;
+    placeholder_dsc.pivot.y = header.h / 2;
+    lv_draw_image(layer, &placeholder_dsc, &area);
+}
+#endif
@@ -73,6 +73,111 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_line(lv_layer_t * layer, const lv_draw_line_d
     LV_PROFILER_DRAW_END;
 }
 
+void lv_draw_polyline_dsc_init(lv_draw_polyline_dsc_t * dsc)
+{
+    lv_memzero(dsc, sizeof(lv_draw_polyline_dsc_t));
+    dsc->width = 1;
+    dsc->opa = LV_OPA_COVER;
+    dsc->color = lv_color_black();
+    dsc->base.dsc_size = sizeof(lv_draw_polyline_dsc_t);
+}
+
+lv_draw_polyline_dsc_t * lv_draw_task_get_polyline_dsc(lv_draw_task_t * task)
+{
+    return task->type == LV_DRAW_TASK_TYPE_POLYLINE ? (lv_draw_polyline_dsc_t *)task->draw_dsc : NULL;
+}
+
+lv_draw_polyline_dsc_t * lv_draw_polyline_dsc_clone(const lv_draw_polyline_dsc_t * dsc)
+{
+    /*Store the points after the descriptor so that they are freed together*/
+    size_t points_size = dsc->point_cnt * sizeof(lv_point_precise_t);
+    lv_draw_polyline_dsc_t * new_dsc = lv_malloc(sizeof(lv_draw_polyline_dsc_t) + points_size);
+    LV_ASSERT_MALLOC(new_dsc);
+    if(new_dsc == NULL) return NULL;
+
+    lv_memcpy(new_dsc, dsc, sizeof(lv_draw_polyline_dsc_t));
+    lv_memcpy(new_dsc + 1, dsc->points, points_size);
+    new_dsc->points = (lv_point_precise_t *)(new_dsc + 1);
+
+    return new_dsc;
+}
+
+int32_t lv_draw_polyline_dsc_compare(const lv_draw_polyline_dsc_t * dsc1, const lv_draw_polyline_dsc_t * dsc2)
+{
+    if(dsc1->point_cnt != dsc2->point_cnt) return dsc1->point_cnt > dsc2->point_cnt ? 1 : -1;
+
+    /*Compare everything except the base and the address of the points*/
+    lv_draw_polyline_dsc_t tmp1 = *dsc1;
+    lv_draw_polyline_dsc_t tmp2 = *dsc2;
+    tmp1.points = NULL;
+    tmp2.points = NULL;
+    int res = lv_memcmp((uint8_t *)&tmp1 + sizeof(lv_draw_dsc_base_t), (uint8_t *)&tmp2 + sizeof(lv_draw_dsc_base_t),
+                        sizeof(lv_draw_polyline_dsc_t) - sizeof(lv_draw_dsc_base_t));
+    if(res == 0) res = lv_memcmp(dsc1->points, dsc2->points, dsc1->point_cnt * sizeof(lv_point_precise_t));
+
+    if(res == 0) return 0;
+    return res > 0 ? 1 : -1;
+}
+
+void lv_draw_polyline(lv_layer_t * layer, const lv_draw_polyline_dsc_t * dsc)
+{
+    if(dsc->width == 0) return;
+    if(dsc->opa <= LV_OPA_MIN) return;
+    if(dsc->point_cnt < 2 || dsc->points == NULL) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+#if LV_USE_DRAW_SW
+    lv_area_t a;
+    a.x1 = (int32_t)dsc->points[0].x;
+    a.x2 = a.x1;
+    a.y1 = (int32_t)dsc->points[0].y;
+    a.y2 = a.y1;
+    uint32_t i;
+    for(i = 1; i < dsc->point_cnt; i++) {
+        a.x1 = LV_MIN(a.x1, (int32_t)dsc->points[i].x);
+        a.x2 = LV_MAX(a.x2, (int32_t)dsc->points[i].x);
+        a.y1 = LV_MIN(a.y1, (int32_t)dsc->points[i].y);
+        a.y2 = LV_MAX(a.y2, (int32_t)dsc->points[i].y);
+    }
+    lv_area_increase(&a, dsc->width, dsc->width);
+
+    lv_draw_polyline_dsc_t * new_dsc = lv_draw_polyline_dsc_clone(dsc);
+    if(new_dsc == NULL) {
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    lv_draw_task_t * t = lv_draw_add_task(layer, &a);
+    t->draw_dsc = new_dsc;
+    t->type = LV_DRAW_TASK_TYPE_POLYLINE;
+
+    lv_draw_finalize_task_creation(layer, t);
+#else
+    /*Only the software renderer can draw polylines, so draw the lines one by one*/
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.base = dsc->base;
+    line_dsc.base.dsc_size = sizeof(lv_draw_line_dsc_t);
+    line_dsc.color = dsc->color;
+    line_dsc.width = dsc->width;
+    line_dsc.opa = dsc->opa;
+    line_dsc.blend_mode = dsc->blend_mode;
+    line_dsc.round_start = dsc->round_start;
+    line_dsc.round_end = 1;
+    uint32_t i;
+    for(i = 0; i < dsc->point_cnt - 1; i++) {
+        line_dsc.p1 = dsc->points[i];
+        line_dsc.p2 = dsc->points[i + 1];
+        if(i == dsc->point_cnt - 2) line_dsc.round_end = dsc->round_end;
+        lv_draw_line(layer, &line_dsc);
+        line_dsc.round_start = 1;
+    }
+#endif
+
+    LV_PROFILER_DRAW_END;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -41,6 +41,20 @@ typedef struct {
     uint8_t raw_end     : 1;    /**< Do not bother with perpendicular line ending if it's not visible for any reason */
 } lv_draw_line_dsc_t;
 
+typedef struct {
+    lv_draw_dsc_base_t base;
+
+    /** The points of the polyline. `lv_draw_polyline()` copies them so they can be freed after the call.*/
+    const lv_point_precise_t * points;
+    uint32_t point_cnt;
+    lv_color_t color;
+    int32_t width;
+    lv_opa_t opa;
+    lv_blend_mode_t blend_mode  : 2;
+    uint8_t round_start : 1;
+    uint8_t round_end   : 1;
+} lv_draw_polyline_dsc_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -65,6 +79,45 @@ lv_draw_line_dsc_t * lv_draw_task_get_line_dsc(lv_draw_task_t * task);
  */
 void lv_draw_line(lv_layer_t * layer, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Initialize a polyline draw descriptor
+ * @param dsc       pointer to a draw descriptor
+ */
+void lv_draw_polyline_dsc_init(lv_draw_polyline_dsc_t * dsc);
+
+/**
+ * Try to get a polyline draw descriptor from a draw task.
+ * @param task      draw task
+ * @return          the task's draw descriptor or NULL if the task is not of type LV_DRAW_TASK_TYPE_POLYLINE
+ */
+lv_draw_polyline_dsc_t * lv_draw_task_get_polyline_dsc(lv_draw_task_t * task);
+
+/**
+ * Allocate a copy of a polyline descriptor with an own copy of the points.
+ * The points are stored in the same allocation so the copy can be freed by `lv_free()`.
+ * @param dsc       pointer to a polyline descriptor
+ * @return          the copy or NULL if the allocation failed
+ */
+lv_draw_polyline_dsc_t * lv_draw_polyline_dsc_clone(const lv_draw_polyline_dsc_t * dsc);
+
+/**
+ * Compare how two polylines look, i.e. the values of their points but not the address of the points.
+ * Useful as the key of cached renderings because the address of freed points can be reused.
+ * @param dsc1      pointer to a polyline descriptor
+ * @param dsc2      pointer to an other polyline descriptor
+ * @return          0: they look the same, otherwise -1 or 1 to order them
+ */
+int32_t lv_draw_polyline_dsc_compare(const lv_draw_polyline_dsc_t * dsc1, const lv_draw_polyline_dsc_t * dsc2);
+
+/**
+ * Create a draw task to draw connected lines through the points in one pass.
+ * The joints are rounded and overlapping parts are drawn only once,
+ * so it looks better and is much faster than drawing the lines one by one.
+ * @param layer     pointer to a layer
+ * @param dsc       pointer to an initialized `lv_draw_polyline_dsc_t` variable
+ */
+void lv_draw_polyline(lv_layer_t * layer, const lv_draw_polyline_dsc_t * dsc);
+
 /**********************
  *      MACROS
  **********************/
@@ -24,6 +24,10 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** The draw task recorder is used by the draw list cache of the widgets, by the tiled rendering
+ * and by the displays rendered on their own thread*/
+#define LV_DRAW_RECORDER    (LV_OBJ_DRAW_LIST_CACHE || LV_DRAW_TILE_SIZE > 0 || LV_USE_DISPLAY_RENDER_THREAD)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -81,6 +85,28 @@ struct _lv_draw_mask_t {
     void * user_data;
 };
 
+#if LV_DRAW_RECORDER
+/**
+ * Collects the draw tasks added to its layer instead of dispatching them,
+ * so that they can be replayed later by `lv_draw_recorder_replay()`.
+ */
+struct _lv_draw_recorder_t {
+    /** The draw tasks are added to this layer while recording */
+    lv_layer_t layer;
+
+    /** The recorder which was active when this one was started (recorders can be nested) */
+    lv_draw_recorder_t * prev;
+
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    /** The matrix of the target layer when the recording was started */
+    lv_matrix_t matrix;
+#endif
+
+    /** Set if a draw task was added which can't be replayed (e.g. a layer or vector draw task) */
+    bool failed;
+};
+#endif
+
 struct _lv_draw_unit_t {
     lv_draw_unit_t * next;
 
@@ -166,6 +192,9 @@ struct _lv_draw_unit_t {
      * @return
      */
     int32_t (*delete_cb)(lv_draw_unit_t * draw_unit);
+
+    /** Index of the draw unit in the order of creation. Used in the draw unit masks of the displays.*/
+    uint32_t idx;
 };
 
 typedef struct {
@@ -174,17 +203,106 @@ typedef struct {
     uint32_t used_memory_for_layers_kb;
 #if LV_USE_OS
     lv_thread_sync_t sync;
+#if LV_USE_DISPLAY_RENDER_THREAD
+    lv_mutex_t dispatch_mutex;      /**< Protects the draw units while draw tasks are assigned to them*/
+    lv_ll_t dispatch_sync_ll;       /**< Further syncs to signal on dispatch requests (stores lv_thread_sync_t *)*/
+#endif
 #else
     volatile int dispatch_req;
 #endif
+    uint32_t reserved_unit_mask;    /**< The draw units assigned to a display by `lv_display_set_draw_unit_mask()`*/
     lv_mutex_t circle_cache_mutex;
+
+    /*Only used while creating draw tasks, i.e. on the thread of `lv_timer_handler()`*/
     bool task_running;
+#if LV_DRAW_RECORDER
+    lv_draw_recorder_t * recorder;
+#endif
+#if LV_DRAW_OCCLUSION_CULLING
+    lv_draw_occlusion_monitor_t occlusion_mon;
+#endif
 } lv_draw_global_info_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_DRAW_RECORDER
+
+/**
+ * Start recording draw tasks. Until `lv_draw_recorder_end()` is called the draw tasks added
+ * to `recorder->layer` are not dispatched but kept in the recorder.
+ * @param recorder      pointer to a recorder to initialize
+ * @param target_layer  the layer on which the recording will be replayed.
+ *                      Its parameters (color format, matrix, etc) are used while recording.
+ * @param clip_area     the clip area to use while recording
+ */
+void lv_draw_recorder_begin(lv_draw_recorder_t * recorder, lv_layer_t * target_layer, const lv_area_t * clip_area);
+
+/**
+ * Stop recording draw tasks.
+ * @param recorder      pointer to a recorder started by `lv_draw_recorder_begin()`
+ * @return              the list of the recorded draw tasks, or NULL if there are no draw tasks
+ *                      or `recorder->failed` is set. The list can be replayed by
+ *                      `lv_draw_recorder_replay()` and needs to be freed by `lv_draw_recorder_free()`.
+ */
+lv_draw_task_t * lv_draw_recorder_end(lv_draw_recorder_t * recorder);
+
+/**
+ * Add a copy of the recorded draw tasks to a layer.
+ * The draw tasks are clipped to the current clip area of the layer.
+ * @param layer         pointer to a layer
+ * @param task_head     the list of draw tasks returned by `lv_draw_recorder_end()`
+ */
+void lv_draw_recorder_replay(lv_layer_t * layer, const lv_draw_task_t * task_head);
+
+/**
+ * Make the recorded draw tasks independent of the widgets so that they can be rendered
+ * even if the widgets are changed or deleted in the meantime. The texts and image file names
+ * are copied and the draw units evaluate the draw tasks.
+ * After this the draw tasks can be moved to a layer directly instead of replaying them.
+ * @param task_head     the list of draw tasks returned by `lv_draw_recorder_end()`
+ * @return              LV_RESULT_OK: success; LV_RESULT_INVALID: out of memory
+ */
+lv_result_t lv_draw_recorder_detach(lv_draw_task_t * task_head);
+
+/**
+ * Free a list of recorded draw tasks
+ * @param task_head     the list of draw tasks returned by `lv_draw_recorder_end()`
+ */
+void lv_draw_recorder_free(lv_draw_task_t * task_head);
+
+#endif /*LV_DRAW_RECORDER*/
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+/**
+ * Signal a sync object too on each `lv_draw_dispatch_request()`.
+ * Used by threads which wait for the draw units besides the thread of `lv_timer_handler()`.
+ * @param sync      pointer to an initialized sync object
+ */
+void lv_draw_add_dispatch_sync(lv_thread_sync_t * sync);
+
+/**
+ * Stop signaling a sync object added by `lv_draw_add_dispatch_sync()`
+ * @param sync      pointer to a sync object
+ */
+void lv_draw_remove_dispatch_sync(lv_thread_sync_t * sync);
+#endif
+
+/**
+ * Get which draw units can render the layers of a display
+ * @param disp      pointer to a display or NULL for layers not belonging to any display (e.g. a canvas)
+ * @return          bit `i` is set if the draw unit with index `i` can be used
+ */
+uint32_t lv_draw_get_unit_mask(lv_display_t * disp);
+
+/**
+ * Update the draw units assigned to displays by `lv_display_set_draw_unit_mask()`.
+ * These units are not used for other displays.
+ * @param mask      bit `i` is set if the draw unit with index `i` is assigned to a display
+ */
+void lv_draw_set_reserved_unit_mask(uint32_t mask);
+
 /**********************
  *      MACROS
  **********************/
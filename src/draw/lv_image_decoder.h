@@ -76,6 +76,14 @@ typedef lv_result_t (*lv_image_decoder_get_area_cb_t)(lv_image_decoder_t * decod
  */
 typedef void (*lv_image_decoder_close_f_t)(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 
+/**
+ * Free the resources of an image cache entry added by the decoder when the entry is evicted.
+ * The decoded draw buffer itself is destroyed by the cache if it's allocated.
+ * @param decoder pointer to the decoder which added the entry
+ * @param cached_data the cache entry's data. Its `user_data` was passed to `lv_image_decoder_add_to_cache()`
+ */
+typedef void (*lv_image_decoder_cache_free_f_t)(lv_image_decoder_t * decoder, lv_image_cache_data_t * cached_data);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -170,6 +178,13 @@ void lv_image_decoder_set_get_area_cb(lv_image_decoder_t * decoder, lv_image_dec
  */
 void lv_image_decoder_set_close_cb(lv_image_decoder_t * decoder, lv_image_decoder_close_f_t close_cb);
 
+/**
+ * Set a callback to free the resources of the decoder's image cache entries when they are evicted
+ * @param decoder pointer to an image decoder
+ * @param cache_free_cb a function to free the `user_data` of the cache entries
+ */
+void lv_image_decoder_set_cache_free_cb(lv_image_decoder_t * decoder, lv_image_decoder_cache_free_f_t cache_free_cb);
+
 lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data);
@@ -183,6 +198,32 @@ lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
  */
 lv_draw_buf_t * lv_image_decoder_post_process(lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * decoded);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+/**
+ * Enable or disable decoding the image files on a background thread.
+ * If enabled and an image file is not in the image cache yet, its decoding is queued,
+ * the placeholder is drawn instead, and the widget is redrawn when the image is decoded.
+ * Has effect only if the image cache is enabled.
+ * @param en        true: decode the image files in the background; false: decode them while drawing
+ */
+void lv_image_decoder_set_async(bool en);
+
+/**
+ * Set an image to draw while an image file is being decoded in the background.
+ * It's drawn in the center of the image's area.
+ * @param src       pointer to an `lv_image_dsc_t` variable or NULL to draw nothing
+ */
+void lv_image_decoder_set_async_placeholder(const void * src);
+
+/**
+ * Get the image drawn while an image file is being decoded in the background.
+ * @return          the placeholder image or NULL if not set
+ */
+const void * lv_image_decoder_get_async_placeholder(void);
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,364 @@
+/**
+ * @file lv_image_decoder_async.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_image_decoder_private.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include "lv_draw_image.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_array.h"
+#include "../misc/lv_timer.h"
+#include "../misc/cache/lv_image_cache.h"
+#include "../stdlib/lv_string.h"
+#include "../core/lv_global.h"
+#include "../core/lv_obj.h"
+#include "../display/lv_display.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define async_p (&(LV_GLOBAL_DEFAULT()->img_decoder_async))
+#define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
+
+/*Number of decoded jobs to keep until they are requested. The oldest ones are dropped first.*/
+#define DONE_JOB_MAX    16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    JOB_STATE_QUEUED,
+    JOB_STATE_DECODING,
+    JOB_STATE_DONE,
+} job_state_t;
+
+typedef enum {
+    REQUEST_RES_CACHED,     /**< The image is in the cache*/
+    REQUEST_RES_QUEUED,     /**< The image is being decoded*/
+    REQUEST_RES_DIRECT,     /**< The image can't be decoded in advance*/
+} request_res_t;
+
+typedef struct {
+    char * src;             /**< Copy of the file name*/
+    lv_array_t objs;        /**< Objects to redraw when the image is decoded*/
+    job_state_t state;
+    bool cached;            /**< The decoder put the image into the cache*/
+} job_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_result_t async_init(void);
+static request_res_t request(const void * src, lv_obj_t * obj);
+static void decode_thread_cb(void * user_data);
+static void decoded_timer_cb(lv_timer_t * timer);
+static job_t * job_find(const char * src);
+static bool is_cached(const void * src);
+static void job_add_obj(job_t * job, lv_obj_t * obj);
+static void job_delete(job_t * job);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_image_decoder_set_async(bool en)
+{
+    if(en && async_init() != LV_RESULT_OK) return;
+
+    async_p->enabled = en;
+}
+
+void lv_image_decoder_set_async_placeholder(const void * src)
+{
+    async_p->placeholder = src;
+}
+
+const void * lv_image_decoder_get_async_placeholder(void)
+{
+    return async_p->placeholder;
+}
+
+lv_result_t lv_image_decoder_async_request(const void * src, lv_obj_t * obj)
+{
+    if(!async_p->enabled) return LV_RESULT_INVALID;
+
+    return request(src, obj) == REQUEST_RES_DIRECT ? LV_RESULT_INVALID : LV_RESULT_OK;
+}
+
+bool lv_image_decoder_async_is_idle(void)
+{
+    if(!async_p->inited) return true;
+
+    bool idle = true;
+    lv_mutex_lock(&async_p->lock);
+    job_t * job;
+    LV_LL_READ(&async_p->job_ll, job) {
+        if(job->state != JOB_STATE_DONE) {
+            idle = false;
+            break;
+        }
+    }
+    lv_mutex_unlock(&async_p->lock);
+
+    return idle;
+}
+
+bool lv_image_decoder_async_is_ready(const void * src, lv_obj_t * obj)
+{
+    if(!async_p->enabled) return true;
+
+    /*Redraw the whole screen if the image is not drawn by an object*/
+    if(obj == NULL) obj = lv_screen_active();
+
+    return request(src, obj) != REQUEST_RES_QUEUED;
+}
+
+void lv_image_decoder_async_deinit(void)
+{
+    if(!async_p->inited) return;
+
+    lv_mutex_lock(&async_p->lock);
+    async_p->exit_status = true;
+    lv_mutex_unlock(&async_p->lock);
+
+    lv_thread_sync_signal(&async_p->sync);
+    lv_thread_delete(&async_p->thread);
+
+    lv_timer_delete(async_p->timer);
+
+    job_t * job;
+    while((job = lv_ll_get_head(&async_p->job_ll)) != NULL) {
+        job_delete(job);
+    }
+
+    lv_thread_sync_delete(&async_p->sync);
+    lv_mutex_delete(&async_p->lock);
+
+    lv_memzero(async_p, sizeof(lv_image_decoder_async_t));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_result_t async_init(void)
+{
+    if(async_p->inited) return LV_RESULT_OK;
+
+    lv_ll_init(&async_p->job_ll, sizeof(job_t));
+    lv_mutex_init(&async_p->lock);
+    lv_thread_sync_init(&async_p->sync);
+
+    async_p->timer = lv_timer_create(decoded_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    lv_timer_pause(async_p->timer);
+
+    if(lv_thread_init(&async_p->thread, LV_THREAD_PRIO_LOW, decode_thread_cb, LV_DRAW_THREAD_STACK_SIZE,
+                      NULL) != LV_RESULT_OK) {
+        LV_LOG_WARN("Couldn't create the image decoder thread");
+        lv_timer_delete(async_p->timer);
+        lv_thread_sync_delete(&async_p->sync);
+        lv_mutex_delete(&async_p->lock);
+        return LV_RESULT_INVALID;
+    }
+
+    async_p->inited = true;
+    return LV_RESULT_OK;
+}
+
+static request_res_t request(const void * src, lv_obj_t * obj)
+{
+    if(lv_image_src_get_type(src) != LV_IMAGE_SRC_FILE) return REQUEST_RES_DIRECT;
+    if(!lv_image_cache_is_enabled()) return REQUEST_RES_DIRECT;
+    if(async_init() != LV_RESULT_OK) return REQUEST_RES_DIRECT;
+
+    request_res_t res;
+    lv_mutex_lock(&async_p->lock);
+    job_t * job = job_find(src);
+    if(job && job->state == JOB_STATE_DONE && !job->cached) {
+        /*If the decoder doesn't cache this image there is no point to decode it in advance*/
+        res = REQUEST_RES_DIRECT;
+    }
+    else if(job && job->state == JOB_STATE_DONE) {
+        /*Decoding it again would be evicted again before drawing, so draw it directly this time*/
+        if(is_cached(src)) {
+            res = REQUEST_RES_CACHED;
+        }
+        else {
+            LV_LOG_WARN("%s was dropped from the cache before drawing it. Is the image cache too small?", job->src);
+            res = REQUEST_RES_DIRECT;
+        }
+
+        /*Not needed anymore as the decoded image is used now*/
+        job_delete(job);
+    }
+    else if(job) {
+        job_add_obj(job, obj);
+        res = REQUEST_RES_QUEUED;
+    }
+    else if(is_cached(src)) {
+        res = REQUEST_RES_CACHED;
+    }
+    else {
+        job = lv_ll_ins_tail(&async_p->job_ll);
+        LV_ASSERT_MALLOC(job);
+        if(job) {
+            lv_memzero(job, sizeof(job_t));
+            job->src = lv_strdup(src);
+            lv_array_init(&job->objs, 1, sizeof(lv_obj_t *));
+            job->state = JOB_STATE_QUEUED;
+            job_add_obj(job, obj);
+            LV_LOG_INFO("queued %s", job->src);
+            res = REQUEST_RES_QUEUED;
+        }
+        else {
+            res = REQUEST_RES_DIRECT;
+        }
+    }
+    lv_mutex_unlock(&async_p->lock);
+
+    if(res == REQUEST_RES_QUEUED) {
+        lv_thread_sync_signal(&async_p->sync);
+        lv_timer_resume(async_p->timer);
+    }
+
+    return res;
+}
+
+static void decode_thread_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    while(1) {
+        lv_mutex_lock(&async_p->lock);
+        if(async_p->exit_status) {
+            lv_mutex_unlock(&async_p->lock);
+            break;
+        }
+
+        job_t * job;
+        LV_LL_READ(&async_p->job_ll, job) {
+            if(job->state == JOB_STATE_QUEUED) break;
+        }
+
+        if(job == NULL) {
+            lv_mutex_unlock(&async_p->lock);
+            lv_thread_sync_wait(&async_p->sync);
+            continue;
+        }
+
+        /*Only the main thread deletes the jobs, and only when they are done*/
+        job->state = JOB_STATE_DECODING;
+        lv_mutex_unlock(&async_p->lock);
+
+        /*The decoder adds the decoded image to the cache and it stays there after closing*/
+        lv_image_decoder_dsc_t dsc;
+        bool cached = false;
+        if(lv_image_decoder_open(&dsc, job->src, NULL) == LV_RESULT_OK) {
+            cached = dsc.cache_entry != NULL;
+            lv_image_decoder_close(&dsc);
+        }
+
+        lv_mutex_lock(&async_p->lock);
+        job->cached = cached;
+        job->state = JOB_STATE_DONE;
+        lv_mutex_unlock(&async_p->lock);
+    }
+}
+
+static void decoded_timer_cb(lv_timer_t * timer)
+{
+    bool pending = false;
+    uint32_t done_cnt = 0;
+
+    lv_mutex_lock(&async_p->lock);
+
+    /*Go from the newest job to keep the recently decoded ones*/
+    job_t * job = lv_ll_get_tail(&async_p->job_ll);
+    while(job) {
+        job_t * job_prev = lv_ll_get_prev(&async_p->job_ll, job);
+        if(job->state != JOB_STATE_DONE) {
+            pending = true;
+        }
+        else {
+            uint32_t i;
+            uint32_t obj_cnt = lv_array_size(&job->objs);
+            for(i = 0; i < obj_cnt; i++) {
+                lv_obj_t * obj = *(lv_obj_t **)lv_array_at(&job->objs, i);
+                if(lv_obj_is_valid(obj)) lv_obj_invalidate(obj);
+            }
+            lv_array_clear(&job->objs);
+
+            /*Keep the job until the first request to know if the image was evicted before drawing it.
+             *If it's not cached keep it to remember that this image can't be decoded in advance.
+             *Drop the oldest ones if many prefetched images are not requested.*/
+            done_cnt++;
+            if(done_cnt > DONE_JOB_MAX) job_delete(job);
+        }
+        job = job_prev;
+    }
+    lv_mutex_unlock(&async_p->lock);
+
+    if(!pending) lv_timer_pause(timer);
+}
+
+static job_t * job_find(const char * src)
+{
+    job_t * job;
+    LV_LL_READ(&async_p->job_ll, job) {
+        if(lv_strcmp(job->src, src) == 0) return job;
+    }
+
+    return NULL;
+}
+
+static bool is_cached(const void * src)
+{
+    lv_image_cache_data_t search_key;
+    search_key.src_type = lv_image_src_get_type(src);
+    search_key.src = src;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(img_cache_p, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(img_cache_p, entry, NULL);
+    return true;
+}
+
+static void job_add_obj(job_t * job, lv_obj_t * obj)
+{
+    /*Nothing to redraw for prefetched images*/
+    if(obj == NULL) return;
+
+    uint32_t i;
+    uint32_t obj_cnt = lv_array_size(&job->objs);
+    for(i = 0; i < obj_cnt; i++) {
+        if(*(lv_obj_t **)lv_array_at(&job->objs, i) == obj) return;
+    }
+
+    lv_array_push_back(&job->objs, &obj);
+}
+
+static void job_delete(job_t * job)
+{
+    lv_array_deinit(&job->objs);
+    lv_free(job->src);
+    lv_ll_remove(&async_p->job_ll, job);
+    lv_free(job);
+}
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
@@ -15,6 +15,8 @@ extern "C" {
  *********************/
 
 #include "lv_image_decoder.h"
+#include "../misc/lv_ll.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -46,6 +48,7 @@ struct _lv_image_decoder_t {
     lv_image_decoder_open_f_t open_cb;
     lv_image_decoder_get_area_cb_t get_area_cb;
     lv_image_decoder_close_f_t close_cb;
+    lv_image_decoder_cache_free_f_t cache_free_cb;
 
     const char * name;
 
@@ -71,6 +74,21 @@ struct _lv_image_header_cache_data_t {
     lv_image_decoder_t * decoder;
 };
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+/** State of decoding the image files on a background thread*/
+typedef struct {
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    lv_mutex_t lock;            /**< Protects the jobs shared with the thread*/
+    lv_ll_t job_ll;             /**< The image files to decode*/
+    lv_timer_t * timer;         /**< Redraws the widgets when their images are decoded*/
+    const void * placeholder;   /**< Drawn while the image is being decoded*/
+    bool enabled;
+    bool inited;
+    bool exit_status;
+} lv_image_decoder_async_t;
+#endif
+
 /**Describe an image decoding session. Stores data about the decoding*/
 struct _lv_image_decoder_dsc_t {
     /**The decoder which was able to open the image source*/
@@ -131,6 +149,38 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
  */
 void lv_image_decoder_deinit(void);
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+/**
+ * Queue an image file to be decoded on the background thread into the image cache.
+ * @param src       the image source
+ * @param obj       redraw this object when the image is decoded. Can be NULL.
+ * @return          LV_RESULT_OK: the image is queued or already in the cache;
+ *                  LV_RESULT_INVALID: it can't be decoded in the background, decode it directly
+ */
+lv_result_t lv_image_decoder_async_request(const void * src, lv_obj_t * obj);
+
+/**
+ * Check whether an image can be drawn now or it needs to be decoded on the background thread first.
+ * @param src       the image source
+ * @param obj       the object drawing the image, redraw it when the image is decoded. Can be NULL.
+ * @return          true: draw the image; false: its decoding is queued, draw the placeholder instead
+ */
+bool lv_image_decoder_async_is_ready(const void * src, lv_obj_t * obj);
+
+/**
+ * Check whether the background thread has finished decoding all the queued images.
+ * @return          true: no image is waiting for decoding or being decoded
+ */
+bool lv_image_decoder_async_is_idle(void);
+
+/**
+ * Stop the background thread and drop the queued images
+ */
+void lv_image_decoder_async_deinit(void);
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
 /**********************
  *      MACROS
  **********************/
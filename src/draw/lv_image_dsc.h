@@ -35,6 +35,12 @@ typedef enum _lvimage_flags_t {
      * For indexed image, this bit indicated palette data is pre-multiplied with alpha.
      */
     LV_IMAGE_FLAGS_PREMULTIPLIED    = 0x0001,
+    /**
+     * The image data is stored as fixed size tiles instead of lines. Used only in binary image files
+     * to read any part of a large image with a few reads.
+     * The tile size follows the header, see `lv_bin_decoder.h`.
+     */
+    LV_IMAGE_FLAGS_TILED            = 0x0004,
     /**
      * The image data is compressed, so decoder needs to decode image firstly.
      * If this flag is set, the whole image will be decompressed upon decode, and
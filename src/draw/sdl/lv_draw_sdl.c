@@ -27,6 +27,7 @@
  **********************/
 typedef struct {
     lv_draw_dsc_base_t * draw_dsc;
+    lv_draw_task_type_t type;
     int32_t w;
     int32_t h;
     SDL_Texture * texture;
@@ -92,6 +93,16 @@ static lv_cache_compare_res_t sdl_texture_cache_compare_cb(const cache_data_t *
         return lhs_dsc_size > rhs_dsc_size ? 1 : -1;
     }
 
+    if(lhs->type != rhs->type) {
+        return lhs->type > rhs->type ? 1 : -1;
+    }
+
+    /*The address of the points can be reused by other points so compare their values*/
+    if(lhs->type == LV_DRAW_TASK_TYPE_POLYLINE) {
+        return lv_draw_polyline_dsc_compare((const lv_draw_polyline_dsc_t *)lhs->draw_dsc,
+                                            (const lv_draw_polyline_dsc_t *)rhs->draw_dsc);
+    }
+
     const uint8_t * left_draw_dsc = (const uint8_t *)lhs->draw_dsc;
     const uint8_t * right_draw_dsc = (const uint8_t *)rhs->draw_dsc;
     left_draw_dsc += sizeof(lv_draw_dsc_base_t);
@@ -273,6 +284,13 @@ static bool draw_to_texture(lv_draw_sdl_unit_t * u, cache_data_t * cache_data)
                 lv_draw_line(&dest_layer, &line_dsc);
             }
             break;
+        case LV_DRAW_TASK_TYPE_POLYLINE: {
+                lv_draw_polyline_dsc_t polyline_dsc;
+                lv_memcpy(&polyline_dsc, task->draw_dsc, sizeof(polyline_dsc));
+                polyline_dsc.base.user_data = lv_sdl_window_get_renderer(disp);
+                lv_draw_polyline(&dest_layer, &polyline_dsc);
+            }
+            break;
         case LV_DRAW_TASK_TYPE_TRIANGLE: {
                 lv_draw_triangle_dsc_t triangle_dsc;
                 lv_memcpy(&triangle_dsc, task->draw_dsc, sizeof(triangle_dsc));
@@ -305,8 +323,15 @@ static bool draw_to_texture(lv_draw_sdl_unit_t * u, cache_data_t * cache_data)
 
     lv_draw_dsc_base_t * base_dsc = task->draw_dsc;
 
-    cache_data->draw_dsc = lv_malloc(base_dsc->dsc_size);
-    lv_memcpy((void *)cache_data->draw_dsc, base_dsc, base_dsc->dsc_size);
+    if(task->type == LV_DRAW_TASK_TYPE_POLYLINE) {
+        /*The points of the task are freed with the task so keep a copy of them*/
+        cache_data->draw_dsc = (lv_draw_dsc_base_t *)lv_draw_polyline_dsc_clone(task->draw_dsc);
+    }
+    else {
+        cache_data->draw_dsc = lv_malloc(base_dsc->dsc_size);
+        lv_memcpy((void *)cache_data->draw_dsc, base_dsc, base_dsc->dsc_size);
+    }
+    cache_data->type = task->type;
     cache_data->w = texture_w;
     cache_data->h = texture_h;
     cache_data->texture = texture;
@@ -363,6 +388,7 @@ static void draw_from_cached_texture(lv_draw_sdl_unit_t * u)
 
     cache_data_t data_to_find;
     data_to_find.draw_dsc = (lv_draw_dsc_base_t *)t->draw_dsc;
+    data_to_find.type = t->type;
 
     data_to_find.w = lv_area_get_width(&t->_real_area);
     data_to_find.h = lv_area_get_height(&t->_real_area);
@@ -38,6 +38,11 @@
  *********************/
 #define DRAW_UNIT_ID_SW     1
 
+/*The 90 and 270 degree rotations copy blocks of this many pixels in both directions.
+ *The source and destination lines of a block are touched repeatedly, so they stay in the cache
+ *instead of reading a new cache line for each pixel of a column.*/
+#define ROTATE_BLOCK_SIZE   16
+
 #ifndef LV_DRAW_SW_RGB565_SWAP
     #define LV_DRAW_SW_RGB565_SWAP(...) LV_RESULT_INVALID
 #endif
@@ -107,6 +112,10 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit);
 
+static inline void rotate_blocks(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                 int32_t src_stride, int32_t dst_stride, uint32_t px_size, bool first_col_last);
+static inline void copy_px(uint8_t * dst, const uint8_t * src, uint32_t px_size);
+
 #if LV_DRAW_SW_SUPPORT_ARGB8888
 static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
                               int32_t src_stride,
@@ -523,6 +532,9 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
         case LV_DRAW_TASK_TYPE_LINE:
             lv_draw_sw_line((lv_draw_unit_t *)u, t->draw_dsc);
             break;
+        case LV_DRAW_TASK_TYPE_POLYLINE:
+            lv_draw_sw_polyline((lv_draw_unit_t *)u, t->draw_dsc, &t->area);
+            break;
         case LV_DRAW_TASK_TYPE_TRIANGLE:
             lv_draw_sw_triangle((lv_draw_unit_t *)u, t->draw_dsc);
             break;
@@ -591,6 +603,70 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
     LV_PROFILER_DRAW_END;
 }
 
+/**
+ * Rotate the pixels by 90 or 270 degrees in ROTATE_BLOCK_SIZE x ROTATE_BLOCK_SIZE blocks
+ * so that the written destination lines stay in the cache.
+ * @param src               the source pixels
+ * @param dst               buffer for the rotated pixels
+ * @param src_width         width of the source in pixels
+ * @param src_height        height of the source in pixels
+ * @param src_stride        stride of the source in bytes
+ * @param dst_stride        stride of the destination in bytes
+ * @param px_size           size of a pixel in bytes, 1, 2, 3 or 4
+ * @param first_col_last    true: the first column of the source becomes the last line of the destination,
+ *                          false: it becomes the first line of the destination in reversed order
+ */
+static inline void rotate_blocks(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                 int32_t src_stride, int32_t dst_stride, uint32_t px_size, bool first_col_last)
+{
+    int32_t dst_step = first_col_last ? (int32_t)px_size : -(int32_t)px_size;
+
+    for(int32_t by = 0; by < src_height; by += ROTATE_BLOCK_SIZE) {
+        int32_t by_end = LV_MIN(by + ROTATE_BLOCK_SIZE, src_height);
+        for(int32_t bx = 0; bx < src_width; bx += ROTATE_BLOCK_SIZE) {
+            int32_t bx_end = LV_MIN(bx + ROTATE_BLOCK_SIZE, src_width);
+            for(int32_t x = bx; x < bx_end; ++x) {
+                const uint8_t * src_px = src + by * src_stride + x * px_size;
+                uint8_t * dst_px;
+                if(first_col_last) dst_px = dst + (src_width - x - 1) * dst_stride + by * px_size;
+                else dst_px = dst + x * dst_stride + (src_height - by - 1) * px_size;
+
+                for(int32_t y = by; y < by_end; ++y) {
+                    copy_px(dst_px, src_px, px_size);
+                    dst_px += dst_step;
+                    src_px += src_stride;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Copy a pixel. Called with a constant `px_size` so the `switch` is resolved when inlined.
+ * @param dst       pointer to the destination pixel
+ * @param src       pointer to the source pixel
+ * @param px_size   size of a pixel in bytes, 1, 2, 3 or 4
+ */
+static inline void copy_px(uint8_t * dst, const uint8_t * src, uint32_t px_size)
+{
+    switch(px_size) {
+        case 4:
+            *(uint32_t *)dst = *(const uint32_t *)src;
+            break;
+        case 3:
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            break;
+        case 2:
+            *(uint16_t *)dst = *(const uint16_t *)src;
+            break;
+        default:
+            *dst = *src;
+            break;
+    }
+}
+
 #if LV_DRAW_SW_SUPPORT_ARGB8888
 
 static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
@@ -601,17 +677,8 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
         return ;
     }
 
-    src_stride /= sizeof(uint32_t);
-    dst_stride /= sizeof(uint32_t);
-
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
-        }
-    }
+    rotate_blocks((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride,
+                  sizeof(uint32_t), false);
 }
 
 static void rotate180_argb8888(const uint32_t * src, uint32_t * dst, int32_t width, int32_t height, int32_t src_stride,
@@ -641,17 +708,8 @@ static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_
         return ;
     }
 
-    src_stride /= sizeof(uint32_t);
-    dst_stride /= sizeof(uint32_t);
-
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
-        }
-    }
+    rotate_blocks((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride,
+                  sizeof(uint32_t), true);
 }
 
 #endif
@@ -666,15 +724,7 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_widt
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        for(int32_t y = 0; y < src_height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = (src_width - x - 1) * dst_stride + y * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
-        }
-    }
+    rotate_blocks(src, dst, src_width, src_height, src_stride, dst_stride, 3, true);
 }
 
 static void rotate180_rgb888(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
@@ -702,15 +752,7 @@ static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width,
         return ;
     }
 
-    for(int32_t x = 0; x < width; ++x) {
-        for(int32_t y = 0; y < height; ++y) {
-            int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = x * dst_stride + (height - y - 1) * 3;
-            dst[dstIndex] = src[srcIndex];       /*Red*/
-            dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
-            dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
-        }
-    }
+    rotate_blocks(src, dst, width, height, src_stride, dst_stride, 3, false);
 }
 
 #endif
@@ -725,17 +767,8 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_w
         return ;
     }
 
-    src_stride /= sizeof(uint16_t);
-    dst_stride /= sizeof(uint16_t);
-
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
-        }
-    }
+    rotate_blocks((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride,
+                  sizeof(uint16_t), false);
 }
 
 static void rotate180_rgb565(const uint16_t * src, uint16_t * dst, int32_t width, int32_t height, int32_t src_stride,
@@ -765,17 +798,8 @@ static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_wi
         return ;
     }
 
-    src_stride /= sizeof(uint16_t);
-    dst_stride /= sizeof(uint16_t);
-
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
-        }
-    }
+    rotate_blocks((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride,
+                  sizeof(uint16_t), true);
 }
 
 #endif
@@ -791,14 +815,7 @@ static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, i
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = (src_width - x - 1);
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex * dst_stride + y] = src[srcIndex];
-            srcIndex += src_stride;
-        }
-    }
+    rotate_blocks(src, dst, src_width, src_height, src_stride, dst_stride, 1, true);
 }
 
 static void rotate180_l8(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
@@ -825,14 +842,7 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
-        int32_t dstIndex = x * dst_stride;
-        int32_t srcIndex = x;
-        for(int32_t y = 0; y < src_height; ++y) {
-            dst[dstIndex + (src_height - y - 1)] = src[srcIndex];
-            srcIndex += src_stride;
-        }
-    }
+    rotate_blocks(src, dst, src_width, src_height, src_stride, dst_stride, 1, false);
 }
 
 #endif
@@ -103,6 +103,14 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
  */
 void lv_draw_sw_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
 
+/**
+ * Draw a polyline with SW render.
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the draw descriptor
+ * @param coords        the coordinates of the polyline (bounding box of the points increased by the width)
+ */
+void lv_draw_sw_polyline(lv_draw_unit_t * draw_unit, const lv_draw_polyline_dsc_t * dsc, const lv_area_t * coords);
+
 /**
  * Blend a layer with SW render
  * @param draw_unit     pointer to a draw unit
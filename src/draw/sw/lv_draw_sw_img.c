@@ -33,7 +33,8 @@
 /*********************
  *      DEFINES
  *********************/
-#define MAX_BUF_SIZE (uint32_t) (4 * lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing()) * lv_color_format_get_size(lv_display_get_color_format(lv_refr_get_disp_refreshing())))
+/*Use the target layer instead of the display being refreshed as displays can be rendered on other threads too*/
+#define MAX_BUF_SIZE(layer) (uint32_t) (4 * lv_area_get_width(&(layer)->buf_area) * lv_color_format_get_size((layer)->color_format))
 
 #ifndef LV_DRAW_SW_IMAGE
     #define LV_DRAW_SW_IMAGE(...)   LV_RESULT_INVALID
@@ -309,13 +310,13 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
         int32_t buf_h;
         if(cf_final == LV_COLOR_FORMAT_RGB565A8) {
             uint32_t buf_stride = blend_w * 3;
-            buf_h = MAX_BUF_SIZE / buf_stride;
+            buf_h = MAX_BUF_SIZE(draw_unit->target_layer) / buf_stride;
             if(buf_h > blend_h) buf_h = blend_h;
             tmp_buf = lv_malloc(buf_stride * buf_h);
         }
         else {
             uint32_t buf_stride = blend_w * lv_color_format_get_size(cf_final);
-            buf_h = MAX_BUF_SIZE / buf_stride;
+            buf_h = MAX_BUF_SIZE(draw_unit->target_layer) / buf_stride;
             if(buf_h > blend_h) buf_h = blend_h;
             tmp_buf = lv_malloc(buf_stride * buf_h);
         }
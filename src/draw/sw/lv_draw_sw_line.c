@@ -23,14 +23,37 @@
  *      DEFINES
  *********************/
 
+/*The points of polylines are used with 1/16 pixel precision and the distances with 1/256 pixel precision*/
+#define POLYLINE_SUBPX_SHIFT    4
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    int32_t ax;         /**< Start point (1/16 px)*/
+    int32_t ay;
+    int32_t bx;         /**< End point (1/16 px)*/
+    int32_t by;
+    int32_t ux;         /**< Unit vector from the start to the end point (1/4096)*/
+    int32_t uy;
+    int32_t len;        /**< Length (1/256 px)*/
+    int32_t y_last;     /**< The last row affected by the segment*/
+    int32_t next;       /**< Index of the next segment starting on the same row or -1*/
+    uint8_t butt_start : 1;
+    uint8_t butt_end : 1;
+} polyline_seg_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+static bool polyline_clip_segment(int32_t * ax, int32_t * ay, int32_t * bx, int32_t * by, const lv_area_t * clip,
+                                  bool * a_clipped, bool * b_clipped);
+static void polyline_get_row_span(const polyline_seg_t * seg, int32_t y, int32_t reach, int32_t * x1, int32_t * x2);
+static int32_t polyline_get_coverage(const polyline_seg_t * seg, int32_t x, int32_t y, int32_t half_w);
+static bool points_equal(const lv_point_precise_t * p1, const lv_point_precise_t * p2);
+
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_skew(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_hor(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
 static void /* LV_ATTRIBUTE_FAST_MEM */ draw_line_ver(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc);
@@ -99,9 +122,318 @@ void lv_draw_sw_line(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc)
     LV_PROFILER_DRAW_END;
 }
 
+void lv_draw_sw_polyline(lv_draw_unit_t * draw_unit, const lv_draw_polyline_dsc_t * dsc, const lv_area_t * coords)
+{
+    if(dsc->width == 0) return;
+    if(dsc->opa <= LV_OPA_MIN) return;
+    if(dsc->point_cnt < 2) return;
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, coords, draw_unit->clip_area)) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    int32_t half_w = dsc->width << 7;   /*1/256 px*/
+    /*Pixels farther than this from a segment (1/16 px) are not affected by the segment*/
+    int32_t reach = ((half_w + 256) >> (8 - POLYLINE_SUBPX_SHIFT)) + 1;
+
+    /*Clip the segments to the draw area so that the fixed point math can't overflow*/
+    lv_area_t seg_clip;
+    seg_clip.x1 = (draw_area.x1 << POLYLINE_SUBPX_SHIFT) - reach;
+    seg_clip.y1 = (draw_area.y1 << POLYLINE_SUBPX_SHIFT) - reach;
+    seg_clip.x2 = (draw_area.x2 << POLYLINE_SUBPX_SHIFT) + reach;
+    seg_clip.y2 = (draw_area.y2 << POLYLINE_SUBPX_SHIFT) + reach;
+
+    int32_t row_cnt = lv_area_get_height(&draw_area);
+    int32_t area_w = lv_area_get_width(&draw_area);
+    polyline_seg_t * segs = lv_malloc(sizeof(polyline_seg_t) * (dsc->point_cnt - 1));
+    int32_t * row_heads = lv_malloc(sizeof(int32_t) * row_cnt);
+    int32_t * active = lv_malloc(sizeof(int32_t) * (dsc->point_cnt - 1));
+    lv_opa_t * mask_buf = lv_malloc(area_w);
+    if(segs == NULL || row_heads == NULL || active == NULL || mask_buf == NULL) {
+        LV_LOG_WARN("Couldn't allocate the buffers for the polyline");
+        lv_free(segs);
+        lv_free(row_heads);
+        lv_free(active);
+        lv_free(mask_buf);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
+    /*Sort the segments into buckets by the first row they affect (like an edge table)*/
+    int32_t i;
+    for(i = 0; i < row_cnt; i++) row_heads[i] = -1;
+
+    /*Zero length segments are skipped so find the real first and last segments for the end caps*/
+    uint32_t p_first = 0;
+    uint32_t p_last = dsc->point_cnt - 2;
+    while(p_first < p_last && points_equal(&dsc->points[p_first], &dsc->points[p_first + 1])) p_first++;
+    while(p_last > p_first && points_equal(&dsc->points[p_last], &dsc->points[p_last + 1])) p_last--;
+
+    uint32_t seg_cnt = 0;
+    uint32_t p;
+    for(p = 0; p < dsc->point_cnt - 1; p++) {
+        int32_t ax = (int32_t)(dsc->points[p].x * (1 << POLYLINE_SUBPX_SHIFT));
+        int32_t ay = (int32_t)(dsc->points[p].y * (1 << POLYLINE_SUBPX_SHIFT));
+        int32_t bx = (int32_t)(dsc->points[p + 1].x * (1 << POLYLINE_SUBPX_SHIFT));
+        int32_t by = (int32_t)(dsc->points[p + 1].y * (1 << POLYLINE_SUBPX_SHIFT));
+        if(ax == bx && ay == by) continue;
+
+        bool a_clipped;
+        bool b_clipped;
+        if(!polyline_clip_segment(&ax, &ay, &bx, &by, &seg_clip, &a_clipped, &b_clipped)) continue;
+
+        int32_t dx = bx - ax;
+        int32_t dy = by - ay;
+        if(dx == 0 && dy == 0) continue;
+
+        polyline_seg_t * seg = &segs[seg_cnt];
+        seg->ax = ax;
+        seg->ay = ay;
+        seg->bx = bx;
+        seg->by = by;
+        /*Scale down the coordinates if needed to avoid overflow*/
+        int32_t shift = 0;
+        while((LV_MAX(LV_ABS(dx), LV_ABS(dy)) >> shift) > 32767) shift++;
+        int32_t dx_s = dx >> shift;
+        int32_t dy_s = dy >> shift;
+        int32_t len = lv_sqrt32((uint32_t)(dx_s * dx_s + dy_s * dy_s)) << shift;
+        if(len == 0) len = 1;
+        seg->ux = (dx << 12) / len;
+        seg->uy = (dy << 12) / len;
+        seg->len = len << (8 - POLYLINE_SUBPX_SHIFT);
+
+        /*Only the real ends of the polyline can have a butt cap, the joints are always round*/
+        seg->butt_start = p == p_first && !dsc->round_start && !a_clipped;
+        seg->butt_end = p == p_last && !dsc->round_end && !b_clipped;
+
+        int32_t y_first = (LV_MIN(ay, by) - reach) >> POLYLINE_SUBPX_SHIFT;
+        seg->y_last = (LV_MAX(ay, by) + reach) >> POLYLINE_SUBPX_SHIFT;
+        if(seg->y_last < draw_area.y1 || y_first > draw_area.y2) continue;
+        y_first = LV_MAX(y_first, draw_area.y1) - draw_area.y1;
+
+        seg->next = row_heads[y_first];
+        row_heads[y_first] = seg_cnt;
+        seg_cnt++;
+    }
+
+    lv_memzero(mask_buf, area_w);
+
+    lv_area_t blend_area;
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_area = &blend_area;
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+
+    /*Go through the rows once and combine the coverage of all segments on them*/
+    uint32_t active_cnt = 0;
+    int32_t y;
+    for(y = draw_area.y1; y <= draw_area.y2; y++) {
+        int32_t s;
+        for(s = row_heads[y - draw_area.y1]; s >= 0; s = segs[s].next) {
+            active[active_cnt++] = s;
+        }
+
+        int32_t row_x1 = draw_area.x2 + 1;
+        int32_t row_x2 = draw_area.x1 - 1;
+        uint32_t kept_cnt = 0;
+        uint32_t a;
+        for(a = 0; a < active_cnt; a++) {
+            const polyline_seg_t * seg = &segs[active[a]];
+            if(seg->y_last < y) continue;
+            active[kept_cnt++] = active[a];
+
+            int32_t x1;
+            int32_t x2;
+            polyline_get_row_span(seg, y, reach, &x1, &x2);
+            x1 = LV_MAX(x1, draw_area.x1);
+            x2 = LV_MIN(x2, draw_area.x2);
+            if(x1 > x2) continue;
+
+            row_x1 = LV_MIN(row_x1, x1);
+            row_x2 = LV_MAX(row_x2, x2);
+
+            /*The overlapping parts are covered only once*/
+            lv_opa_t * mask = &mask_buf[x1 - draw_area.x1];
+            int32_t x;
+            for(x = x1; x <= x2; x++, mask++) {
+                int32_t cov = polyline_get_coverage(seg, x, y, half_w);
+                if(cov > *mask) *mask = cov > LV_OPA_COVER ? LV_OPA_COVER : cov;
+            }
+        }
+        active_cnt = kept_cnt;
+
+        if(row_x1 > row_x2) continue;
+
+        blend_area.x1 = row_x1;
+        blend_area.x2 = row_x2;
+        blend_area.y1 = y;
+        blend_area.y2 = y;
+        blend_dsc.mask_buf = &mask_buf[row_x1 - draw_area.x1];
+        blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(draw_unit, &blend_dsc);
+
+        lv_memzero(&mask_buf[row_x1 - draw_area.x1], row_x2 - row_x1 + 1);
+    }
+
+    lv_free(segs);
+    lv_free(row_heads);
+    lv_free(active);
+    lv_free(mask_buf);
+
+    LV_PROFILER_DRAW_END;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Clip a segment to an area with the Liang-Barsky algorithm
+ * @param ax            x coordinate of the start point, updated if clipped
+ * @param ay            y coordinate of the start point, updated if clipped
+ * @param bx            x coordinate of the end point, updated if clipped
+ * @param by            y coordinate of the end point, updated if clipped
+ * @param clip          the clip area in the same unit as the points
+ * @param a_clipped     set to true if the start point was moved
+ * @param b_clipped     set to true if the end point was moved
+ * @return              false: the segment is out of the clip area
+ */
+static bool polyline_clip_segment(int32_t * ax, int32_t * ay, int32_t * bx, int32_t * by, const lv_area_t * clip,
+                                  bool * a_clipped, bool * b_clipped)
+{
+    int64_t dx = (int64_t) * bx - *ax;
+    int64_t dy = (int64_t) * by - *ay;
+    int64_t p[4] = {-dx, dx, -dy, dy};
+    int64_t q[4] = {(int64_t) * ax - clip->x1, (int64_t)clip->x2 - *ax, (int64_t) * ay - clip->y1, (int64_t)clip->y2 - *ay};
+
+    /*The parameters of the clipped start and end points in 1/65536 units*/
+    int64_t t0 = 0;
+    int64_t t1 = 65536;
+    int32_t i;
+    for(i = 0; i < 4; i++) {
+        if(p[i] == 0) {
+            if(q[i] < 0) return false;
+            continue;
+        }
+
+        int64_t t = (q[i] * 65536) / p[i];
+        if(p[i] < 0) {
+            if(t > t1) return false;
+            if(t > t0) t0 = t;
+        }
+        else {
+            if(t < t0) return false;
+            if(t < t1) t1 = t;
+        }
+    }
+
+    *a_clipped = t0 > 0;
+    *b_clipped = t1 < 65536;
+
+    int32_t ax_ori = *ax;
+    int32_t ay_ori = *ay;
+    if(*a_clipped) {
+        *ax = ax_ori + (int32_t)((dx * t0) / 65536);
+        *ay = ay_ori + (int32_t)((dy * t0) / 65536);
+    }
+    if(*b_clipped) {
+        *bx = ax_ori + (int32_t)((dx * t1) / 65536);
+        *by = ay_ori + (int32_t)((dy * t1) / 65536);
+    }
+
+    return true;
+}
+
+/**
+ * Get the pixels of a row which might be affected by a segment
+ * @param seg       pointer to a segment
+ * @param y         the row
+ * @param reach     the max distance of the affected pixels from the segment (1/16 px)
+ * @param x1        store the first affected pixel here
+ * @param x2        store the last affected pixel here
+ */
+static void polyline_get_row_span(const polyline_seg_t * seg, int32_t y, int32_t reach, int32_t * x1, int32_t * x2)
+{
+    /*Find the part of the segment which is closer to the row than `reach` vertically*/
+    int32_t row_y = y << POLYLINE_SUBPX_SHIFT;
+    int32_t seg_y1 = LV_MIN(seg->ay, seg->by);
+    int32_t seg_y2 = LV_MAX(seg->ay, seg->by);
+    int32_t y1 = LV_CLAMP(seg_y1, row_y - reach, seg_y2);
+    int32_t y2 = LV_CLAMP(seg_y1, row_y + reach, seg_y2);
+
+    int32_t xa;
+    int32_t xb;
+    if(seg->ay == seg->by) {
+        xa = seg->ax;
+        xb = seg->bx;
+    }
+    else {
+        int64_t dx = seg->bx - seg->ax;
+        int64_t dy = seg->by - seg->ay;
+        xa = seg->ax + (int32_t)(((y1 - seg->ay) * dx) / dy);
+        xb = seg->ax + (int32_t)(((y2 - seg->ay) * dx) / dy);
+    }
+
+    *x1 = (LV_MIN(xa, xb) - reach) >> POLYLINE_SUBPX_SHIFT;
+    *x2 = (LV_MAX(xa, xb) + reach + (1 << POLYLINE_SUBPX_SHIFT) - 1) >> POLYLINE_SUBPX_SHIFT;
+}
+
+/**
+ * Get how much a pixel is covered by a segment with round or butt ends
+ * @param seg       pointer to a segment
+ * @param x         x coordinate of the pixel
+ * @param y         y coordinate of the pixel
+ * @param half_w    half of the line width (1/256 px)
+ * @return          the coverage in 0..256 range
+ */
+static int32_t polyline_get_coverage(const polyline_seg_t * seg, int32_t x, int32_t y, int32_t half_w)
+{
+    int32_t dx = (x << POLYLINE_SUBPX_SHIFT) - seg->ax;
+    int32_t dy = (y << POLYLINE_SUBPX_SHIFT) - seg->ay;
+
+    /*Distance along and perpendicular to the segment (1/256 px)*/
+    int32_t along = (dx * seg->ux + dy * seg->uy) >> (12 + POLYLINE_SUBPX_SHIFT - 8);
+    int32_t perp = LV_ABS((dy * seg->ux - dx * seg->uy) >> (12 + POLYLINE_SUBPX_SHIFT - 8));
+    if(perp >= half_w + 128) return 0;
+
+    int32_t over;   /*Distance beyond the ends*/
+    bool butt;
+    if(along < 0) {
+        over = -along;
+        butt = seg->butt_start;
+    }
+    else if(along > seg->len) {
+        over = along - seg->len;
+        butt = seg->butt_end;
+    }
+    else {
+        return LV_MIN(half_w + 128 - perp, 256);
+    }
+
+    if(over >= half_w + 128) return 0;
+
+    int32_t cov;
+    if(butt) {
+        /*The line ends half pixel after the end point*/
+        cov = LV_MIN(half_w + 128 - perp, 256 - over);
+    }
+    else {
+        int32_t dist = lv_sqrt32((uint32_t)(over * over + perp * perp));
+        cov = half_w + 128 - dist;
+    }
+
+    return LV_CLAMP(0, cov, 256);
+}
+
+static bool points_equal(const lv_point_precise_t * p1, const lv_point_precise_t * p2)
+{
+    return p1->x == p2->x && p1->y == p2->y;
+}
+
 static void LV_ATTRIBUTE_FAST_MEM draw_line_hor(lv_draw_unit_t * draw_unit, const lv_draw_line_dsc_t * dsc)
 {
     int32_t w = dsc->width - 1;
@@ -343,7 +675,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_line_skew(lv_draw_unit_t * draw_unit, con
 
     /*Draw the background line by line*/
     int32_t h;
-    uint32_t hor_res = (uint32_t)lv_display_get_horizontal_resolution(lv_refr_get_disp_refreshing());
+    uint32_t hor_res = (uint32_t)lv_area_get_width(&draw_unit->target_layer->buf_area);
     size_t mask_buf_size = LV_MIN(lv_area_get_size(&blend_area), hor_res);
     lv_opa_t * mask_buf = lv_malloc(mask_buf_size);
 
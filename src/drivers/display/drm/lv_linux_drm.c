@@ -9,6 +9,8 @@
 #include "lv_linux_drm.h"
 #if LV_USE_LINUX_DRM
 
+#include "../../../misc/lv_area_private.h"
+
 #include <errno.h>
 #include <fcntl.h>
 #include <poll.h>
@@ -33,6 +35,12 @@
     #error LV_COLOR_DEPTH not supported
 #endif
 
+/*One buffer is scanned out, one is waiting for the page flip and LVGL renders into the third*/
+#define DRM_BUF_CNT         3
+
+/*Max. number of damaged areas of a frame. With more the whole screen is considered damaged.*/
+#define DRM_DAMAGE_MAX      LV_INV_BUF_SIZE
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -43,8 +51,15 @@ typedef struct {
     unsigned long int size;
     uint8_t * map;
     uint32_t fb_handle;
+    uint32_t frame;     /*The last frame rendered into the buffer, 0: nothing was rendered yet*/
 } drm_buffer_t;
 
+typedef struct {
+    lv_area_t areas[DRM_DAMAGE_MAX];
+    uint32_t cnt;
+    bool full;
+} drm_damage_t;
+
 typedef struct {
     int fd;
     uint32_t conn_id, enc_id, crtc_id, plane_id, crtc_idx;
@@ -65,7 +80,15 @@ typedef struct {
     drmModePropertyPtr plane_props[128];
     drmModePropertyPtr crtc_props[128];
     drmModePropertyPtr conn_props[128];
-    drm_buffer_t drm_bufs[2]; /*DUMB buffers*/
+    drm_buffer_t drm_bufs[DRM_BUF_CNT]; /*DUMB buffers*/
+    int32_t front_idx;      /*The buffer being scanned out or -1*/
+    int32_t pending_idx;    /*The buffer committed and waiting for the page flip or -1*/
+    int32_t queued_idx;     /*The buffer to commit after the pending page flip or -1*/
+    int32_t render_idx;     /*The buffer LVGL renders into or -1 if none of them is free*/
+    lv_draw_buf_t draw_buf; /*The only draw buffer of the display, it points to the render buffer*/
+    uint32_t frame_cnt;     /*The number of frames committed so far*/
+    drm_damage_t damage[DRM_BUF_CNT]; /*The damage of the last frames, indexed by frame number*/
+    lv_display_t * disp;
 } drm_dev_t;
 
 /**********************
@@ -82,7 +105,12 @@ static int drm_get_conn_props(drm_dev_t * drm_dev);
 static int drm_add_plane_property(drm_dev_t * drm_dev, const char * name, uint64_t value);
 static int drm_add_crtc_property(drm_dev_t * drm_dev, const char * name, uint64_t value);
 static int drm_add_conn_property(drm_dev_t * drm_dev, const char * name, uint64_t value);
-static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf);
+static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf, const drm_damage_t * damage);
+static void drm_commit(drm_dev_t * drm_dev, int32_t idx);
+static bool drm_select_render_buffer(drm_dev_t * drm_dev);
+static void drm_set_draw_buf(drm_dev_t * drm_dev, drm_buffer_t * buf);
+static void drm_copy_area(drm_dev_t * drm_dev, drm_buffer_t * dest, const drm_buffer_t * src, const lv_area_t * area);
+static int drm_handle_events(drm_dev_t * drm_dev, int timeout);
 static int find_plane(drm_dev_t * drm_dev, unsigned int fourcc, uint32_t * plane_id, uint32_t crtc_id,
                       uint32_t crtc_idx);
 static int drm_find_connector(drm_dev_t * drm_dev, int64_t connector_id);
@@ -124,6 +152,11 @@ lv_display_t * lv_linux_drm_create(void)
         return NULL;
     }
     drm_dev->fd = -1;
+    drm_dev->front_idx = -1;
+    drm_dev->pending_idx = -1;
+    drm_dev->queued_idx = -1;
+    drm_dev->render_idx = 0;
+    drm_dev->disp = disp;
     lv_display_set_driver_data(disp, drm_dev);
     lv_display_set_flush_wait_cb(disp, drm_flush_wait);
     lv_display_set_flush_cb(disp, drm_flush);
@@ -157,13 +190,15 @@ void lv_linux_drm_set_file(lv_display_t * disp, const char * file, int64_t conne
     int32_t ver_res = drm_dev->height;
     int32_t width = drm_dev->mmWidth;
 
-    size_t buf_size = LV_MIN(drm_dev->drm_bufs[1].size, drm_dev->drm_bufs[0].size);
     /* Resolution must be set first because if the screen is smaller than the size passed
      * to lv_display_create then the buffers aren't big enough for LV_DISPLAY_RENDER_MODE_DIRECT.
+     * LVGL sees only one buffer: the driver points it to a free DUMB buffer after each frame
+     * and brings that buffer up to date itself, so LVGL doesn't need to sync the areas.
      */
     lv_display_set_resolution(disp, hor_res, ver_res);
-    lv_display_set_buffers(disp, drm_dev->drm_bufs[1].map, drm_dev->drm_bufs[0].map, buf_size,
-                           LV_DISPLAY_RENDER_MODE_DIRECT);
+    drm_set_draw_buf(drm_dev, &drm_dev->drm_bufs[drm_dev->render_idx]);
+    lv_display_set_draw_buffers(disp, &drm_dev->draw_buf, NULL);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
 
     if(width) {
         lv_display_set_dpi(disp, DIV_ROUND_UP(hor_res * 25400, width * 1000));
@@ -227,14 +262,30 @@ static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec
 {
     LV_UNUSED(fd);
     LV_UNUSED(sequence);
-    LV_UNUSED(tv_sec);
-    LV_UNUSED(tv_usec);
     LV_LOG_TRACE("flip");
     drm_dev_t * drm_dev = user_data;
+
+    /* The flip happens at the vblank. The timestamp is CLOCK_MONOTONIC but the tick of LVGL can
+     * have any other time base, so report the vsync as the time elapsed since the flip before now.*/
+    uint32_t flip_ms = (uint32_t)((uint64_t)tv_sec * 1000 + tv_usec / 1000);
+    uint32_t elapsed_ms = tick_get_cb() - flip_ms;
+    lv_display_report_vsync(drm_dev->disp, lv_tick_get() - elapsed_ms);
+
     if(drm_dev->req) {
         drmModeAtomicFree(drm_dev->req);
         drm_dev->req = NULL;
     }
+
+    /*The previous front buffer is free from now*/
+    drm_dev->front_idx = drm_dev->pending_idx;
+    drm_dev->pending_idx = -1;
+
+    /*A frame was finished while waiting for the flip, show it at the next vblank*/
+    if(drm_dev->queued_idx >= 0) {
+        int32_t idx = drm_dev->queued_idx;
+        drm_dev->queued_idx = -1;
+        drm_commit(drm_dev, idx);
+    }
 }
 
 static int drm_get_plane_props(drm_dev_t * drm_dev)
@@ -357,9 +408,10 @@ static int drm_add_conn_property(drm_dev_t * drm_dev, const char * name, uint64_
     return 0;
 }
 
-static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
+static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf, const drm_damage_t * damage)
 {
     int ret;
+    uint32_t damage_blob_id = 0;
     static int first = 1;
     uint32_t flags = DRM_MODE_PAGE_FLIP_EVENT | DRM_MODE_ATOMIC_NONBLOCK;
 
@@ -388,16 +440,147 @@ static int drm_dmabuf_set_plane(drm_dev_t * drm_dev, drm_buffer_t * buf)
     drm_add_plane_property(drm_dev, "CRTC_W", drm_dev->width);
     drm_add_plane_property(drm_dev, "CRTC_H", drm_dev->height);
 
+    /* Tell the driver which parts have changed since the previous frame.
+     * Without damage clips (or if the property is not supported) the whole plane is updated.*/
+    if(damage && !damage->full && damage->cnt && get_plane_property_id(drm_dev, "FB_DAMAGE_CLIPS")) {
+        struct drm_mode_rect rects[DRM_DAMAGE_MAX];
+        uint32_t i;
+        for(i = 0; i < damage->cnt; i++) {
+            rects[i].x1 = damage->areas[i].x1;
+            rects[i].y1 = damage->areas[i].y1;
+            rects[i].x2 = damage->areas[i].x2 + 1;
+            rects[i].y2 = damage->areas[i].y2 + 1;
+        }
+
+        if(drmModeCreatePropertyBlob(drm_dev->fd, rects, sizeof(rects[0]) * damage->cnt, &damage_blob_id) == 0) {
+            drm_add_plane_property(drm_dev, "FB_DAMAGE_CLIPS", damage_blob_id);
+        }
+        else {
+            LV_LOG_WARN("drmModeCreatePropertyBlob failed: %s (%d)", strerror(errno), errno);
+            damage_blob_id = 0;
+        }
+    }
+
     ret = drmModeAtomicCommit(drm_dev->fd, drm_dev->req, flags, drm_dev);
+
+    /*The commit holds its own reference to the blob*/
+    if(damage_blob_id) drmModeDestroyPropertyBlob(drm_dev->fd, damage_blob_id);
+
     if(ret) {
         LV_LOG_ERROR("drmModeAtomicCommit failed: %s (%d)", strerror(errno), errno);
         drmModeAtomicFree(drm_dev->req);
+        drm_dev->req = NULL;
         return ret;
     }
 
     return 0;
 }
 
+/**
+ * Commit a rendered buffer to be shown at the next vblank without waiting for it
+ * @param drm_dev   pointer to the DRM device
+ * @param idx       index of the buffer to show
+ */
+static void drm_commit(drm_dev_t * drm_dev, int32_t idx)
+{
+    drm_buffer_t * buf = &drm_dev->drm_bufs[idx];
+    const drm_damage_t * damage = &drm_dev->damage[buf->frame % DRM_BUF_CNT];
+
+    if(drm_dmabuf_set_plane(drm_dev, buf, damage)) {
+        LV_LOG_ERROR("Flush fail");
+        return;
+    }
+
+    drm_dev->pending_idx = idx;
+    LV_LOG_TRACE("Flush done");
+}
+
+/**
+ * Find a buffer which is neither scanned out nor waiting to be shown,
+ * bring it up to date with the last frame and let LVGL render into it.
+ * Nothing is selected while a frame is queued, as the next frame would replace it
+ * and the damage of the replaced frame would never be committed.
+ * @param drm_dev   pointer to the DRM device
+ * @return          true: a buffer was found
+ */
+static bool drm_select_render_buffer(drm_dev_t * drm_dev)
+{
+    if(drm_dev->queued_idx >= 0) return false;
+
+    int32_t idx;
+    for(idx = 0; idx < DRM_BUF_CNT; idx++) {
+        if(idx != drm_dev->front_idx && idx != drm_dev->pending_idx && idx != drm_dev->queued_idx) break;
+    }
+    if(idx == DRM_BUF_CNT) return false;
+
+    LV_PROFILER_BEGIN;
+
+    drm_buffer_t * buf = &drm_dev->drm_bufs[idx];
+    const drm_buffer_t * newest = NULL;
+    int32_t i;
+    for(i = 0; i < DRM_BUF_CNT; i++) {
+        if(drm_dev->frame_cnt && drm_dev->drm_bufs[i].frame == drm_dev->frame_cnt) newest = &drm_dev->drm_bufs[i];
+    }
+
+    /* LVGL renders only the areas invalidated in the next frame, so copy
+     * everything that has changed since the buffer was rendered the last time.
+     * The age of the buffer tells how many frames of damage it has missed.*/
+    if(newest && newest != buf) {
+        uint32_t age = buf->frame ? drm_dev->frame_cnt - buf->frame : UINT32_MAX;
+        bool full = age >= DRM_BUF_CNT;
+        uint32_t f;
+        for(f = drm_dev->frame_cnt - age + 1; !full && f <= drm_dev->frame_cnt; f++) {
+            if(drm_dev->damage[f % DRM_BUF_CNT].full) full = true;
+        }
+
+        if(full) {
+            lv_memcpy(buf->map, newest->map, LV_MIN(buf->size, newest->size));
+        }
+        else {
+            for(f = drm_dev->frame_cnt - age + 1; f <= drm_dev->frame_cnt; f++) {
+                const drm_damage_t * damage = &drm_dev->damage[f % DRM_BUF_CNT];
+                uint32_t a;
+                for(a = 0; a < damage->cnt; a++) {
+                    drm_copy_area(drm_dev, buf, newest, &damage->areas[a]);
+                }
+            }
+        }
+    }
+
+    drm_dev->render_idx = idx;
+    drm_set_draw_buf(drm_dev, buf);
+
+    LV_PROFILER_END;
+    return true;
+}
+
+/**
+ * Point the display's draw buffer to a DUMB buffer
+ * @param drm_dev   pointer to the DRM device
+ * @param buf       the DUMB buffer LVGL should render into
+ */
+static void drm_set_draw_buf(drm_dev_t * drm_dev, drm_buffer_t * buf)
+{
+    lv_draw_buf_init(&drm_dev->draw_buf, drm_dev->width, drm_dev->height, lv_display_get_color_format(drm_dev->disp),
+                     buf->pitch, buf->map, buf->size);
+}
+
+static void drm_copy_area(drm_dev_t * drm_dev, drm_buffer_t * dest, const drm_buffer_t * src, const lv_area_t * area)
+{
+    lv_area_t clipped;
+    lv_area_t scr_area = {0, 0, drm_dev->width - 1, drm_dev->height - 1};
+    if(!lv_area_intersect(&clipped, area, &scr_area)) return;
+
+    uint32_t px_size = LV_COLOR_DEPTH / 8;
+    uint32_t line_size = lv_area_get_width(&clipped) * px_size;
+    uint32_t offset = clipped.y1 * src->pitch + clipped.x1 * px_size;
+    int32_t y;
+    for(y = clipped.y1; y <= clipped.y2; y++) {
+        lv_memcpy(dest->map + offset, src->map + offset, line_size);
+        offset += src->pitch;
+    }
+}
+
 static int find_plane(drm_dev_t * drm_dev, unsigned int fourcc, uint32_t * plane_id, uint32_t crtc_id,
                       uint32_t crtc_idx)
 {
@@ -786,59 +969,90 @@ static int drm_setup_buffers(drm_dev_t * drm_dev)
     int ret;
 
     /*Allocate DUMB buffers*/
-    ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[0]);
-    if(ret)
-        return ret;
-
-    ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[1]);
-    if(ret)
-        return ret;
+    for(int idx = 0; idx < DRM_BUF_CNT; idx++) {
+        ret = drm_allocate_dumb(drm_dev, &drm_dev->drm_bufs[idx]);
+        if(ret)
+            return ret;
+    }
 
     return 0;
 }
 
-static void drm_flush_wait(lv_display_t * disp)
+/**
+ * Handle the page flip events of the device
+ * @param drm_dev   pointer to the DRM device
+ * @param timeout   max. time to wait for an event in ms, -1: wait until an event arrives
+ * @return          0 on success, -1 on error
+ */
+static int drm_handle_events(drm_dev_t * drm_dev, int timeout)
 {
-    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
-
     struct pollfd pfd;
     pfd.fd = drm_dev->fd;
     pfd.events = POLLIN;
 
-    while(drm_dev->req) {
-        int ret;
-        do {
-            ret = poll(&pfd, 1, -1);
-        } while(ret == -1 && errno == EINTR);
+    int ret;
+    do {
+        ret = poll(&pfd, 1, timeout);
+    } while(ret == -1 && errno == EINTR);
 
-        if(ret > 0)
-            drmHandleEvent(drm_dev->fd, &drm_dev->drm_event_ctx);
-        else {
-            LV_LOG_ERROR("poll failed: %s", strerror(errno));
-            return;
-        }
+    if(ret > 0) {
+        drmHandleEvent(drm_dev->fd, &drm_dev->drm_event_ctx);
     }
+    else if(ret < 0) {
+        LV_LOG_ERROR("poll failed: %s", strerror(errno));
+        return -1;
+    }
+
+    return 0;
 }
 
-static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+static void drm_flush_wait(lv_display_t * disp)
 {
-    if(!lv_display_flush_is_last(disp)) return;
+    drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
+
+    /* Process the finished page flips but don't wait for the scanout while there is a free buffer.
+     * Wait if a frame is both pending and queued, i.e. LVGL is 2 frames ahead of the display.
+     * It's also the case before the first flip completes, when a third buffer would be free.
+     * Don't return without a free buffer, else LVGL would render into a visible one.*/
+    drm_handle_events(drm_dev, 0);
+
+    while(drm_dev->render_idx < 0 && !drm_select_render_buffer(drm_dev)) {
+        /*Don't spin if poll keeps failing*/
+        if(drm_handle_events(drm_dev, -1)) lv_delay_ms(1);
+    }
+}
 
-    LV_UNUSED(area);
+static void drm_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
     LV_UNUSED(px_map);
     drm_dev_t * drm_dev = lv_display_get_driver_data(disp);
 
-    for(int idx = 0; idx < 2; idx++) {
-        if(drm_dev->drm_bufs[idx].map == px_map) {
-            /*Request buffer swap*/
-            if(drm_dmabuf_set_plane(drm_dev, &drm_dev->drm_bufs[idx])) {
-                LV_LOG_ERROR("Flush fail");
-                return;
-            }
-            else
-                LV_LOG_TRACE("Flush done");
-        }
-    }
+    /*Collect the damage of the frame*/
+    drm_damage_t * damage = &drm_dev->damage[(drm_dev->frame_cnt + 1) % DRM_BUF_CNT];
+    if(damage->cnt < DRM_DAMAGE_MAX) damage->areas[damage->cnt++] = *area;
+    else damage->full = true;
+
+    if(!lv_display_flush_is_last(disp)) return;
+
+    /*drm_flush_wait() returns only when LVGL has a free buffer to render into*/
+    LV_ASSERT_MSG(drm_dev->render_idx >= 0, "Rendered without a free buffer");
+
+    drm_dev->frame_cnt++;
+    drm_dev->drm_bufs[drm_dev->render_idx].frame = drm_dev->frame_cnt;
+
+    /*Request buffer swap or queue it if a page flip is still pending.
+     *No buffer is selected while a frame is queued, so a queued frame is never replaced.*/
+    LV_ASSERT_MSG(drm_dev->queued_idx < 0, "A queued frame would be replaced");
+    if(drm_dev->pending_idx < 0) drm_commit(drm_dev, drm_dev->render_idx);
+    else drm_dev->queued_idx = drm_dev->render_idx;
+
+    /*Prepare for the next frame*/
+    damage = &drm_dev->damage[(drm_dev->frame_cnt + 1) % DRM_BUF_CNT];
+    damage->cnt = 0;
+    damage->full = false;
+
+    drm_dev->render_idx = -1;
+    drm_select_render_buffer(drm_dev);
 }
 
 static uint32_t tick_get_cb(void)
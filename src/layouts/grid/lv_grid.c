@@ -544,6 +544,8 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
         lv_area_set_width(&item->coords, item_w);
         lv_area_set_height(&item->coords, item_h);
         lv_obj_invalidate(item);
+        /*The layout update readjusts the scroll position right after applying the layout*/
+        item->readjust_scroll_after_layout = 1;
         lv_obj_send_event(item, LV_EVENT_SIZE_CHANGED, &old_coords);
         lv_obj_send_event(lv_obj_get_parent(item), LV_EVENT_CHILD_CHANGED, item);
 
@@ -9,6 +9,7 @@
 #include "lv_layout_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj.h"
+#include "../core/lv_obj_scroll_private.h"
 
 /*********************
  *      DEFINES
@@ -71,6 +72,9 @@ void lv_layout_apply(lv_obj_t * obj)
     if(layout_id > 0 && layout_id <= layout_cnt) {
         void  * user_data = layout_list_def[layout_id].user_data;
         layout_list_def[layout_id].cb(obj, user_data);
+
+        /*The layouts move the children directly*/
+        lv_obj_scroll_invalidate_child_ext(obj);
     }
 }
 
@@ -10,6 +10,7 @@
 #include "lv_bin_decoder.h"
 #include "../../draw/lv_draw_image.h"
 #include "../../draw/lv_draw_buf.h"
+#include "../../misc/lv_area_private.h"
 #include "../../stdlib/lv_string.h"
 #include "../../stdlib/lv_sprintf.h"
 #include "../../libs/rle/lv_rle.h"
@@ -56,8 +57,22 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    lv_image_tile_header_t tile_header; /*Tile size of tiled images*/
+    lv_draw_buf_t tile;                 /*The part of a tile returned by get_area_cb*/
+    lv_cache_entry_t * tile_entry;      /*The tile cache entry `tile` points to*/
 } decoder_data_t;
 
+typedef struct {
+    lv_draw_buf_t decoded;              /*Points into the mapped file*/
+    lv_fs_file_t * f;                   /*Kept open to keep the file mapped while the image is cached*/
+} mapped_image_t;
+
+typedef struct {
+    char * src;                         /*File name of the image*/
+    uint32_t index;                     /*Index of the tile in the image*/
+    lv_draw_buf_t * tile;
+} tile_cache_data_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -65,6 +80,9 @@ static decoder_data_t * get_decoder_data(lv_image_decoder_dsc_t * dsc);
 static void free_decoder_data(lv_image_decoder_dsc_t * dsc);
 static lv_result_t decode_indexed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static lv_result_t load_indexed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t map_rgb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t cache_mapped(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static void mapped_cache_free_cb(lv_image_decoder_t * decoder, lv_image_cache_data_t * cached_data);
 #if LV_BIN_DECODER_RAM_LOAD
     static lv_result_t decode_rgb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 #endif
@@ -74,9 +92,30 @@ static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
+static lv_fs_res_t fs_read_lines_at(lv_fs_file_t * f, uint32_t pos, uint32_t stride, uint8_t * buf, uint32_t buf_stride,
+                                    uint32_t line_len, int32_t line_cnt);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
 
+static lv_result_t read_tile_header(lv_image_decoder_dsc_t * dsc);
+static uint32_t get_tile_size(const lv_image_decoder_dsc_t * dsc);
+static lv_result_t read_tiles(lv_image_decoder_dsc_t * dsc, uint32_t index, uint32_t cnt, uint8_t * buf);
+#if LV_BIN_DECODER_RAM_LOAD
+    static lv_result_t decode_tiled(lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * decoded);
+#endif
+static lv_result_t get_area_tiled(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                  const lv_area_t * full_area, lv_area_t * decoded_area);
+static const lv_draw_buf_t * get_tile(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, uint32_t index);
+static lv_draw_buf_t * create_tile_buf(lv_image_decoder_dsc_t * dsc);
+static lv_result_t read_tile(lv_image_decoder_dsc_t * dsc, uint32_t index, lv_draw_buf_t * buf);
+static void release_tile(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+
+#if LV_BIN_DECODER_TILE_CACHE_CNT > 0
+    static bool tile_cache_create_cb(tile_cache_data_t * item, void * user_data);
+    static void tile_cache_free_cb(tile_cache_data_t * item, void * user_data);
+    static lv_cache_compare_res_t tile_cache_compare_cb(const tile_cache_data_t * lhs, const tile_cache_data_t * rhs);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -107,8 +146,34 @@ void lv_bin_decoder_init(void)
     lv_image_decoder_set_open_cb(decoder, lv_bin_decoder_open);
     lv_image_decoder_set_get_area_cb(decoder, lv_bin_decoder_get_area);
     lv_image_decoder_set_close_cb(decoder, lv_bin_decoder_close);
+    lv_image_decoder_set_cache_free_cb(decoder, mapped_cache_free_cb);
 
     decoder->name = DECODER_NAME;
+
+#if LV_BIN_DECODER_TILE_CACHE_CNT > 0
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)tile_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)tile_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)tile_cache_free_cb,
+    };
+
+    lv_cache_t * tile_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(tile_cache_data_t),
+                                              LV_BIN_DECODER_TILE_CACHE_CNT, ops);
+    if(tile_cache) lv_cache_set_name(tile_cache, "BIN_TILE");
+    decoder->user_data = tile_cache;
+#endif
+}
+
+void lv_bin_decoder_deinit(void)
+{
+    lv_image_decoder_t * decoder = NULL;
+    while((decoder = lv_image_decoder_get_next(decoder)) != NULL) {
+        if(decoder->info_cb == lv_bin_decoder_info && decoder->user_data) {
+            /*The decoders themselves are deleted by lv_image_decoder_deinit*/
+            lv_cache_destroy(decoder->user_data, NULL);
+            decoder->user_data = NULL;
+        }
+    }
 }
 
 lv_result_t lv_bin_decoder_info(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, lv_image_header_t * header)
@@ -184,6 +249,7 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     lv_result_t res = LV_RESULT_INVALID;
     lv_fs_res_t fs_res = LV_FS_RES_UNKNOWN;
     bool use_directly = false; /*If the image is already decoded and can be used directly*/
+    bool mapped = false; /*If the pixels are used from the file in the memory*/
 
     /*Open the file if it's a file*/
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
@@ -213,6 +279,14 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
         decoder_data->f = f;    /*Now free_decoder_data will take care of the file*/
 
+        if(dsc->header.flags & LV_IMAGE_FLAGS_TILED) {
+            res = read_tile_header(dsc);
+            if(res != LV_RESULT_OK) {
+                free_decoder_data(dsc);
+                return res;
+            }
+        }
+
         lv_color_format_t cf = dsc->header.cf;
 
         if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
@@ -230,6 +304,12 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         else if(LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf)) {
             res = decode_alpha_only(decoder, dsc);
         }
+        else if(map_rgb(decoder, dsc) == LV_RESULT_OK) {
+            /*The file is in the memory already (e.g. memory-mapped) so use its content directly*/
+            res = LV_RESULT_OK;
+            use_directly = true;
+            mapped = true;
+        }
 #if LV_BIN_DECODER_RAM_LOAD
         else if(cf == LV_COLOR_FORMAT_ARGB8888      \
                 || cf == LV_COLOR_FORMAT_XRGB8888   \
@@ -254,6 +334,11 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
             return LV_RESULT_INVALID;
         }
 
+        if(image->header.flags & LV_IMAGE_FLAGS_TILED) {
+            LV_LOG_WARN("Tiled images are supported only in files");
+            return LV_RESULT_INVALID;
+        }
+
         lv_color_format_t cf = image->header.cf;
         if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
             res = decode_compressed(decoder, dsc);
@@ -333,24 +418,28 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
     /*The adjusted draw buffer is newly allocated.*/
     if(adjusted != decoded) {
         use_directly = false; /*Cannot use original image directly*/
+        mapped = false;
         free_decoder_data(dsc);
         decoder_data_t * decoder_data = get_decoder_data(dsc);
         decoder_data->decoded = adjusted; /*Now this new buffer need to be free'd on decoder close*/
     }
     dsc->decoded = adjusted;
 
-    if(use_directly || dsc->args.no_cache) return LV_RESULT_OK; /*Do not put image to cache if it can be used directly.*/
+    /*Do not put image to cache if it can be used directly, except the mapped files to keep them mapped.*/
+    if((use_directly && !mapped) || dsc->args.no_cache) return LV_RESULT_OK;
 
     /*If the image cache is disabled, just return the decoded image*/
     if(!lv_image_cache_is_enabled()) return LV_RESULT_OK;
 
+    if(mapped) return cache_mapped(decoder, dsc);
+
     /*Add it to cache*/
     lv_image_cache_data_t search_key;
     search_key.src_type = dsc->src_type;
     search_key.src = dsc->src;
     search_key.slot.size = dsc->decoded->data_size;
 
-    lv_cache_entry_t * cache_entry = lv_image_decoder_add_to_cache(decoder, &search_key, dsc->decoded, dsc->user_data);
+    lv_cache_entry_t * cache_entry = lv_image_decoder_add_to_cache(decoder, &search_key, dsc->decoded, NULL);
     if(cache_entry == NULL) {
         free_decoder_data(dsc);
         return LV_RESULT_INVALID;
@@ -364,9 +453,11 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
 void lv_bin_decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
-    LV_UNUSED(decoder); /*Unused*/
-
     decoder_data_t * decoder_data = dsc->user_data;
+    if(decoder_data && decoder_data->tile_entry) {
+        release_tile(decoder, dsc);
+    }
+
     if(decoder_data && decoder_data->decoded_partial) {
         lv_draw_buf_destroy(decoder_data->decoded_partial);
         decoder_data->decoded_partial = NULL;
@@ -378,8 +469,6 @@ void lv_bin_decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
 lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
                                     const lv_area_t * full_area, lv_area_t * decoded_area)
 {
-    LV_UNUSED(decoder); /*Unused*/
-
     lv_color_format_t cf = dsc->header.cf;
     /*Check if cf is supported*/
 
@@ -402,50 +491,63 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
         return LV_RESULT_INVALID;
     }
 
+    if(dsc->header.flags & LV_IMAGE_FLAGS_TILED) {
+        return get_area_tiled(decoder, dsc, full_area, decoded_area);
+    }
+
     lv_fs_file_t * f = decoder_data->f;
     uint32_t bpp = lv_color_format_get_bpp(cf);
+    uint32_t stride = dsc->header.stride;
     int32_t w_px = lv_area_get_width(full_area);
-    uint8_t * img_data = NULL;
-    lv_draw_buf_t * decoded = NULL;
     uint32_t offset = dsc->src_type == LV_IMAGE_SRC_FILE ? sizeof(lv_image_header_t) : 0;   /*Skip the image header*/
 
-    /*We only support read line by line for now*/
-    if(decoded_area->y1 == LV_COORD_MIN) {
-        /*Indexed image is converted to ARGB888*/
-        lv_color_format_t cf_decoded = LV_COLOR_FORMAT_IS_INDEXED(cf) ? LV_COLOR_FORMAT_ARGB8888 : cf;
+    /*Indexed image is converted to ARGB888*/
+    lv_color_format_t cf_decoded = LV_COLOR_FORMAT_IS_INDEXED(cf) ? LV_COLOR_FORMAT_ARGB8888 : cf;
+    uint32_t stride_decoded = lv_draw_buf_width_to_stride(w_px, cf_decoded);
 
-        decoded = lv_draw_buf_reshape(decoder_data->decoded_partial, cf_decoded, w_px, 1, LV_STRIDE_AUTO);
-        if(decoded == NULL) {
-            if(decoder_data->decoded_partial != NULL) {
-                lv_draw_buf_destroy(decoder_data->decoded_partial);
-                decoder_data->decoded_partial = NULL;
-            }
-            decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, w_px, 1, cf_decoded, LV_STRIDE_AUTO);
-            if(decoded == NULL) return LV_RESULT_INVALID;
-            decoder_data->decoded_partial = decoded; /*Free on decoder close*/
-        }
+    /*Decode a band of lines at once to avoid many small reads*/
+    uint32_t line_size = stride_decoded;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) line_size += stride_decoded / 2;
+    int32_t band_h = LV_BIN_DECODER_BAND_SIZE / line_size;
+    if(band_h < 1) band_h = 1;
+
+    if(decoded_area->y1 == LV_COORD_MIN) {
         *decoded_area = *full_area;
-        decoded_area->y2 = decoded_area->y1;
-    }
-    else {
-        decoded_area->y1++;
-        decoded_area->y2++;
-        decoded = decoder_data->decoded_partial; /*Already allocated*/
+        decoded_area->y2 = decoded_area->y1 - 1;
     }
 
-    img_data = decoded->data; /*Get the buffer to operate on*/
-
+    decoded_area->y1 = decoded_area->y2 + 1;
     if(decoded_area->y1 > full_area->y2) {
         return LV_RESULT_INVALID;
     }
 
+    decoded_area->y2 = LV_MIN(decoded_area->y1 + band_h - 1, full_area->y2);
+    int32_t h_px = lv_area_get_height(decoded_area);
+
+    lv_draw_buf_t * decoded = lv_draw_buf_reshape(decoder_data->decoded_partial, cf_decoded, w_px, h_px,
+                                                  stride_decoded);
+    if(decoded == NULL) {
+        if(decoder_data->decoded_partial != NULL) {
+            lv_draw_buf_destroy(decoder_data->decoded_partial);
+            decoder_data->decoded_partial = NULL;
+        }
+        /*Allocate for the highest band to avoid reallocation*/
+        int32_t h_alloc = LV_MIN(band_h, lv_area_get_height(full_area));
+        decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, w_px, h_alloc, cf_decoded, stride_decoded);
+        if(decoded == NULL) return LV_RESULT_INVALID;
+        decoder_data->decoded_partial = decoded; /*Free on decoder close*/
+        lv_draw_buf_reshape(decoded, cf_decoded, w_px, h_px, stride_decoded);
+    }
+
+    uint8_t * img_data = decoded->data; /*Get the buffer to operate on*/
+
     if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
         int32_t x_fraction = decoded_area->x1 % (8 / bpp);
-        uint32_t len = (w_px * bpp + 7) / 8 + 1; /*10px for 1bpp may across 3bytes*/
+        uint32_t len = (h_px - 1) * stride + (w_px * bpp + 7) / 8 + 1; /*10px for 1bpp may across 3bytes*/
         uint8_t * buf = NULL;
 
         offset += dsc->palette_size * 4; /*Skip palette*/
-        offset += decoded_area->y1 * dsc->header.stride;
+        offset += decoded_area->y1 * stride;
         offset += decoded_area->x1 * bpp / 8; /*Move to x1*/
         if(dsc->src_type == LV_IMAGE_SRC_FILE) {
             buf = lv_malloc(len);
@@ -464,7 +566,11 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
             buf = (void *)(image->data + offset);
         }
 
-        decode_indexed_line(cf, dsc->palette, x_fraction, w_px, buf, (lv_color32_t *)img_data);
+        int32_t y;
+        for(y = 0; y < h_px; y++) {
+            decode_indexed_line(cf, dsc->palette, x_fraction, w_px, buf + y * stride,
+                                (lv_color32_t *)(img_data + y * stride_decoded));
+        }
 
         if(dsc->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)buf);
 
@@ -474,10 +580,9 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
 
     if(cf == LV_COLOR_FORMAT_ARGB8888 || cf == LV_COLOR_FORMAT_XRGB8888 || cf == LV_COLOR_FORMAT_RGB888
        || cf == LV_COLOR_FORMAT_RGB565 || cf == LV_COLOR_FORMAT_ARGB8565) {
-        uint32_t len = (w_px * bpp) / 8;
-        offset += decoded_area->y1 * dsc->header.stride;
+        offset += decoded_area->y1 * stride;
         offset += decoded_area->x1 * bpp / 8; /*Move to x1*/
-        res = fs_read_file_at(f, offset, img_data, len, NULL);
+        res = fs_read_lines_at(f, offset, stride, img_data, stride_decoded, (w_px * bpp) / 8, h_px);
         if(res != LV_FS_RES_OK) {
             return LV_RESULT_INVALID;
         }
@@ -488,20 +593,19 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
 
     if(cf == LV_COLOR_FORMAT_RGB565A8) {
         bpp = 16; /* RGB565 + A8 mask*/
-        uint32_t len = decoded->header.stride;
-        offset += decoded_area->y1 * dsc->header.stride; /*Move to y1*/
+        offset += decoded_area->y1 * stride; /*Move to y1*/
         offset += decoded_area->x1 * bpp / 8; /*Move to x1*/
-        res = fs_read_file_at(f, offset, img_data, len, NULL);
+        res = fs_read_lines_at(f, offset, stride, img_data, stride_decoded, (w_px * bpp) / 8, h_px);
         if(res != LV_FS_RES_OK) {
             return LV_RESULT_INVALID;
         }
 
         /*Now the A8 mask*/
         offset = sizeof(lv_image_header_t);
-        offset += dsc->header.h * dsc->header.stride; /*Move to A8 map*/
-        offset += decoded_area->y1 * (dsc->header.stride / 2); /*Move to y1*/
+        offset += dsc->header.h * stride; /*Move to A8 map*/
+        offset += decoded_area->y1 * (stride / 2); /*Move to y1*/
         offset += decoded_area->x1 * 1; /*Move to x1*/
-        res = fs_read_file_at(f, offset, img_data + len, w_px * 1, NULL);
+        res = fs_read_lines_at(f, offset, stride / 2, img_data + h_px * stride_decoded, stride_decoded / 2, w_px, h_px);
         if(res != LV_FS_RES_OK) {
             return LV_RESULT_INVALID;
         }
@@ -766,6 +870,102 @@ static lv_result_t load_indexed(lv_image_decoder_t * decoder, lv_image_decoder_d
 #endif
 }
 
+/**
+ * Point to the pixels of a file that's directly addressable (see `lv_fs_get_buffer()`)
+ * instead of copying them. Works only if the pixels can be drawn as they are stored.
+ * Like C array images, the data is used as it is even if it's not aligned to `LV_DRAW_BUF_ALIGN`.
+ */
+static lv_result_t map_rgb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_color_format_t cf = dsc->header.cf;
+
+    if(dsc->header.flags & LV_IMAGE_FLAGS_TILED) return LV_RESULT_INVALID;
+    if(cf != LV_COLOR_FORMAT_ARGB8888
+       && cf != LV_COLOR_FORMAT_XRGB8888
+       && cf != LV_COLOR_FORMAT_RGB888
+       && cf != LV_COLOR_FORMAT_RGB565
+       && cf != LV_COLOR_FORMAT_RGB565A8
+       && cf != LV_COLOR_FORMAT_ARGB8565) {
+        return LV_RESULT_INVALID;
+    }
+
+    const uint8_t * buf;
+    uint32_t buf_size;
+    if(lv_fs_get_buffer(decoder_data->f, (const void **)&buf, &buf_size) != LV_FS_RES_OK) return LV_RESULT_INVALID;
+
+    uint32_t len = dsc->header.stride * dsc->header.h;
+    if(cf == LV_COLOR_FORMAT_RGB565A8) {
+        len += (dsc->header.stride / 2) * dsc->header.h; /*A8 mask*/
+    }
+
+    const uint8_t * data = buf + sizeof(lv_image_header_t);
+    if(buf_size < sizeof(lv_image_header_t) + len) {
+        LV_LOG_WARN("File is too short");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_draw_buf_t * decoded = &decoder_data->c_array;
+    lv_draw_buf_init(decoded, dsc->header.w, dsc->header.h, cf, dsc->header.stride, (void *)data, len);
+
+    /*The mapped file is read-only. If it needs to be premultiplied or realigned it will be copied.*/
+    decoded->header.flags = dsc->header.flags & ~(LV_IMAGE_FLAGS_MODIFIABLE | LV_IMAGE_FLAGS_ALLOCATED);
+
+    dsc->decoded = decoded;
+    return LV_RESULT_OK;
+}
+
+/**
+ * Add an image drawn from a mapped file to the image cache. The file is kept open, so it's
+ * mapped only once instead of on each draw, and it's closed when the image is evicted.
+ * @param decoder   pointer to the decoder
+ * @param dsc       pointer to the decoder descriptor with the image mapped by `map_rgb()`
+ * @return          LV_RESULT_OK: the image can be drawn, even if it couldn't be cached
+ */
+static lv_result_t cache_mapped(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+
+    mapped_image_t * mapped = lv_malloc(sizeof(mapped_image_t));
+    LV_ASSERT_MALLOC(mapped);
+    if(mapped == NULL) return LV_RESULT_OK;  /*It can be still used directly*/
+
+    mapped->decoded = decoder_data->c_array;
+    mapped->f = decoder_data->f;
+
+    /*Count the mapped pixels to limit how many files are kept mapped*/
+    lv_image_cache_data_t search_key;
+    search_key.src_type = dsc->src_type;
+    search_key.src = dsc->src;
+    search_key.slot.size = mapped->decoded.data_size;
+
+    lv_cache_entry_t * cache_entry = lv_image_decoder_add_to_cache(decoder, &search_key, &mapped->decoded, mapped);
+    if(cache_entry == NULL) {
+        lv_free(mapped);
+        return LV_RESULT_OK;
+    }
+
+    dsc->cache_entry = cache_entry;
+    dsc->decoded = &mapped->decoded;
+    decoder_data->f = NULL; /*Cache will close the file*/
+
+    return LV_RESULT_OK;
+}
+
+static void mapped_cache_free_cb(lv_image_decoder_t * decoder, lv_image_cache_data_t * cached_data)
+{
+    LV_UNUSED(decoder);
+
+    /*Only the mapped images have user data*/
+    mapped_image_t * mapped = cached_data->user_data;
+    if(mapped == NULL) return;
+
+    lv_fs_close(mapped->f);
+    lv_free(mapped->f);
+    lv_free(mapped);
+}
+
 #if LV_BIN_DECODER_RAM_LOAD
 static lv_result_t decode_rgb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
@@ -789,12 +989,20 @@ static lv_result_t decode_rgb(lv_image_decoder_t * decoder, lv_image_decoder_dsc
 
     uint8_t * img_data = decoded->data;
 
-    uint32_t rn;
-    res = fs_read_file_at(f, sizeof(lv_image_header_t), img_data, len, &rn);
-    if(res != LV_FS_RES_OK || rn != len) {
-        LV_LOG_WARN("Read rgb file failed: %d", res);
-        lv_draw_buf_destroy(decoded);
-        return LV_RESULT_INVALID;
+    if(dsc->header.flags & LV_IMAGE_FLAGS_TILED) {
+        if(decode_tiled(dsc, decoded) != LV_RESULT_OK) {
+            lv_draw_buf_destroy(decoded);
+            return LV_RESULT_INVALID;
+        }
+    }
+    else {
+        uint32_t rn;
+        res = fs_read_file_at(f, sizeof(lv_image_header_t), img_data, len, &rn);
+        if(res != LV_FS_RES_OK || rn != len) {
+            LV_LOG_WARN("Read rgb file failed: %d", res);
+            lv_draw_buf_destroy(decoded);
+            return LV_RESULT_INVALID;
+        }
     }
 
     dsc->decoded = decoded;
@@ -1075,6 +1283,34 @@ static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff,
     return LV_FS_RES_OK;
 }
 
+/**
+ * Read lines from a file to a buffer having a different stride
+ * @param f             pointer to an opened file
+ * @param pos           position of the first line in the file
+ * @param stride        stride of the lines in the file
+ * @param buf           buffer to read to
+ * @param buf_stride    stride of the lines in the buffer
+ * @param line_len      number of bytes to read from each line
+ * @param line_cnt      number of lines to read
+ * @return              LV_FS_RES_OK or an error code
+ */
+static lv_fs_res_t fs_read_lines_at(lv_fs_file_t * f, uint32_t pos, uint32_t stride, uint8_t * buf, uint32_t buf_stride,
+                                    uint32_t line_len, int32_t line_cnt)
+{
+    /*With the same stride all the lines can be read at once*/
+    if(stride == buf_stride) {
+        return fs_read_file_at(f, pos, buf, (line_cnt - 1) * stride + line_len, NULL);
+    }
+
+    int32_t y;
+    for(y = 0; y < line_cnt; y++) {
+        lv_fs_res_t res = fs_read_file_at(f, pos + y * stride, buf + y * buf_stride, line_len, NULL);
+        if(res != LV_FS_RES_OK) return res;
+    }
+
+    return LV_FS_RES_OK;
+}
+
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed)
 {
     /*Need to store decompressed data to decoder to free on close*/
@@ -1155,3 +1391,296 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
     decoder_data->decompressed = decompressed; /*Free on decoder close*/
     return LV_RESULT_OK;
 }
+
+static lv_result_t read_tile_header(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_color_format_t cf = dsc->header.cf;
+
+    /*Only the formats which can be drawn directly from the tiles are supported*/
+    bool supported = cf == LV_COLOR_FORMAT_ARGB8888  \
+                     || cf == LV_COLOR_FORMAT_XRGB8888  \
+                     || cf == LV_COLOR_FORMAT_RGB888    \
+                     || cf == LV_COLOR_FORMAT_RGB565    \
+                     || cf == LV_COLOR_FORMAT_ARGB8565;
+    if(!supported || (dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED)) {
+        LV_LOG_WARN("Tiled image with CF: %d, flags: 0x%x is not supported", cf, dsc->header.flags);
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t rn;
+    lv_image_tile_header_t * tile_header = &decoder_data->tile_header;
+    lv_fs_res_t res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t), tile_header,
+                                      sizeof(lv_image_tile_header_t), &rn);
+    if(res != LV_FS_RES_OK || rn != sizeof(lv_image_tile_header_t)) {
+        LV_LOG_WARN("Read tile header failed: %d", res);
+        return LV_RESULT_INVALID;
+    }
+
+    if(tile_header->tile_w == 0 || tile_header->tile_h == 0) {
+        LV_LOG_WARN("Invalid tile size: %dx%d", tile_header->tile_w, tile_header->tile_h);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+static uint32_t get_tile_size(const lv_image_decoder_dsc_t * dsc)
+{
+    const decoder_data_t * decoder_data = dsc->user_data;
+    uint32_t tile_stride = decoder_data->tile_header.tile_w * lv_color_format_get_bpp(dsc->header.cf) / 8;
+    return tile_stride * decoder_data->tile_header.tile_h;
+}
+
+static lv_result_t read_tiles(lv_image_decoder_dsc_t * dsc, uint32_t index, uint32_t cnt, uint8_t * buf)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    uint32_t tile_size = get_tile_size(dsc);
+    uint32_t offset = sizeof(lv_image_header_t) + sizeof(lv_image_tile_header_t) + index * tile_size;
+    uint32_t len = cnt * tile_size;
+    uint32_t rn;
+
+    lv_fs_res_t res = fs_read_file_at(decoder_data->f, offset, buf, len, &rn);
+    if(res != LV_FS_RES_OK || rn != len) {
+        LV_LOG_WARN("Read tile %" LV_PRIu32 " failed: %d", index, res);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+#if LV_BIN_DECODER_RAM_LOAD
+static lv_result_t decode_tiled(lv_image_decoder_dsc_t * dsc, lv_draw_buf_t * decoded)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    uint32_t px_size = lv_color_format_get_bpp(dsc->header.cf) / 8;
+    uint32_t tile_w = decoder_data->tile_header.tile_w;
+    uint32_t tile_h = decoder_data->tile_header.tile_h;
+    uint32_t tile_cols = (dsc->header.w + tile_w - 1) / tile_w;
+    uint32_t tile_size = get_tile_size(dsc);
+
+    /*Read a whole row of tiles at once*/
+    uint8_t * buf = lv_malloc(tile_cols * tile_size);
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return LV_RESULT_INVALID;
+
+    uint32_t tile_y;
+    for(tile_y = 0; tile_y < dsc->header.h; tile_y += tile_h) {
+        if(read_tiles(dsc, tile_y / tile_h * tile_cols, tile_cols, buf) != LV_RESULT_OK) {
+            lv_free(buf);
+            return LV_RESULT_INVALID;
+        }
+
+        uint32_t h = LV_MIN(tile_h, dsc->header.h - tile_y);
+        uint32_t tile_x;
+        for(tile_x = 0; tile_x < dsc->header.w; tile_x += tile_w) {
+            uint32_t w = LV_MIN(tile_w, dsc->header.w - tile_x);
+            const uint8_t * src = buf + tile_x / tile_w * tile_size;
+            uint8_t * dest = decoded->data + tile_y * decoded->header.stride + tile_x * px_size;
+            uint32_t y;
+            for(y = 0; y < h; y++) {
+                lv_memcpy(dest, src, w * px_size);
+                src += tile_w * px_size;
+                dest += decoded->header.stride;
+            }
+        }
+    }
+
+    lv_free(buf);
+    return LV_RESULT_OK;
+}
+#endif
+
+static lv_result_t get_area_tiled(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                  const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    int32_t tile_w = decoder_data->tile_header.tile_w;
+    int32_t tile_h = decoder_data->tile_header.tile_h;
+    int32_t tile_cols = (dsc->header.w + tile_w - 1) / tile_w;
+    int32_t x_start = full_area->x1 - full_area->x1 % tile_w;
+    int32_t x;
+    int32_t y;
+
+    /*Return the tiles overlapping with the area from left to right, top to bottom*/
+    if(decoded_area->y1 == LV_COORD_MIN) {
+        x = x_start;
+        y = full_area->y1 - full_area->y1 % tile_h;
+    }
+    else {
+        x = decoded_area->x1 - decoded_area->x1 % tile_w + tile_w;
+        y = decoded_area->y1 - decoded_area->y1 % tile_h;
+        if(x > full_area->x2) {
+            x = x_start;
+            y += tile_h;
+        }
+    }
+
+    if(y > full_area->y2) return LV_RESULT_INVALID;
+
+    lv_area_t tile_area;
+    lv_area_set(&tile_area, x, y, x + tile_w - 1, y + tile_h - 1);
+    if(!lv_area_intersect(decoded_area, &tile_area, full_area)) return LV_RESULT_INVALID;
+
+    const lv_draw_buf_t * tile = get_tile(decoder, dsc, (y / tile_h) * tile_cols + x / tile_w);
+    if(tile == NULL) return LV_RESULT_INVALID;
+
+    /*Draw the needed part of the tile directly*/
+    uint32_t px_size = lv_color_format_get_bpp(dsc->header.cf) / 8;
+    uint32_t tile_stride = tile->header.stride;
+    lv_draw_buf_t * decoded = &decoder_data->tile;
+    lv_memzero(decoded, sizeof(lv_draw_buf_t));
+    decoded->header.magic = LV_IMAGE_HEADER_MAGIC;
+    decoded->header.cf = dsc->header.cf;
+    decoded->header.flags = dsc->header.flags & LV_IMAGE_FLAGS_PREMULTIPLIED;
+    decoded->header.w = lv_area_get_width(decoded_area);
+    decoded->header.h = lv_area_get_height(decoded_area);
+    decoded->header.stride = tile_stride;
+    decoded->data = tile->data + (decoded_area->y1 - y) * tile_stride + (decoded_area->x1 - x) * px_size;
+    decoded->unaligned_data = decoded->data;
+    decoded->data_size = decoded->header.h * tile_stride;
+    decoded->handlers = image_cache_draw_buf_handlers;
+
+    dsc->decoded = decoded;
+    return LV_RESULT_OK;
+}
+
+static const lv_draw_buf_t * get_tile(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc, uint32_t index)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+
+    /*The previous tile is not drawn anymore*/
+    release_tile(decoder, dsc);
+
+#if LV_BIN_DECODER_TILE_CACHE_CNT > 0
+    lv_cache_t * tile_cache = decoder->user_data;
+    if(tile_cache) {
+        tile_cache_data_t search_key;
+        search_key.src = (char *)dsc->src;
+        search_key.index = index;
+        search_key.tile = NULL;
+
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(tile_cache, &search_key, dsc);
+        if(entry) {
+            decoder_data->tile_entry = entry;
+            tile_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+            return cached_data->tile;
+        }
+
+        /*All the cached tiles are in use, read this tile without caching it*/
+    }
+#endif
+
+    uint32_t tile_w = decoder_data->tile_header.tile_w;
+    uint32_t tile_h = decoder_data->tile_header.tile_h;
+    lv_color_format_t cf = dsc->header.cf;
+    uint32_t tile_stride = lv_draw_buf_width_to_stride(tile_w, cf);
+    lv_draw_buf_t * buf = lv_draw_buf_reshape(decoder_data->decoded_partial, cf, tile_w, tile_h, tile_stride);
+    if(buf == NULL) {
+        if(decoder_data->decoded_partial != NULL) {
+            lv_draw_buf_destroy(decoder_data->decoded_partial);
+            decoder_data->decoded_partial = NULL;
+        }
+        buf = create_tile_buf(dsc);
+        if(buf == NULL) return NULL;
+        decoder_data->decoded_partial = buf; /*Free on decoder close*/
+    }
+
+    if(read_tile(dsc, index, buf) != LV_RESULT_OK) return NULL;
+
+    return buf;
+}
+
+static lv_draw_buf_t * create_tile_buf(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    uint32_t tile_w = decoder_data->tile_header.tile_w;
+    uint32_t tile_h = decoder_data->tile_header.tile_h;
+    lv_color_format_t cf = dsc->header.cf;
+
+    return lv_draw_buf_create_ex(image_cache_draw_buf_handlers, tile_w, tile_h, cf,
+                                 lv_draw_buf_width_to_stride(tile_w, cf));
+}
+
+/**
+ * Read a tile to a draw buffer. The lines of the tiles are packed in the file, so
+ * they are moved to the stride of the draw buffer after reading.
+ * @param dsc       pointer to the decoder descriptor
+ * @param index     index of the tile in the image
+ * @param buf       a draw buffer created by `create_tile_buf()`
+ * @return          LV_RESULT_OK: the tile is read; LV_RESULT_INVALID: failed to read the file
+ */
+static lv_result_t read_tile(lv_image_decoder_dsc_t * dsc, uint32_t index, lv_draw_buf_t * buf)
+{
+    if(read_tiles(dsc, index, 1, buf->data) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    decoder_data_t * decoder_data = dsc->user_data;
+    int32_t tile_h = decoder_data->tile_header.tile_h;
+    uint32_t packed_stride = decoder_data->tile_header.tile_w * lv_color_format_get_bpp(dsc->header.cf) / 8;
+    uint32_t stride = buf->header.stride;
+    if(stride == packed_stride) return LV_RESULT_OK;
+
+    /*Go from the last line as the lines are moved forward and can overlap with the next ones*/
+    int32_t y;
+    for(y = tile_h - 1; y > 0; y--) {
+        lv_memmove(buf->data + y * stride, buf->data + y * packed_stride, packed_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+static void release_tile(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    if(decoder_data->tile_entry == NULL) return;
+
+    lv_cache_release(decoder->user_data, decoder_data->tile_entry, NULL);
+    decoder_data->tile_entry = NULL;
+}
+
+#if LV_BIN_DECODER_TILE_CACHE_CNT > 0
+static bool tile_cache_create_cb(tile_cache_data_t * item, void * user_data)
+{
+    lv_image_decoder_dsc_t * dsc = user_data;
+
+    lv_draw_buf_t * tile = create_tile_buf(dsc);
+    if(tile == NULL) return false;
+
+    if(read_tile(dsc, item->index, tile) != LV_RESULT_OK) {
+        lv_draw_buf_destroy(tile);
+        return false;
+    }
+
+    /*The key contained the caller's pointer, store a copy*/
+    item->src = lv_strdup(item->src);
+    if(item->src == NULL) {
+        lv_draw_buf_destroy(tile);
+        return false;
+    }
+
+    item->tile = tile;
+    return true;
+}
+
+static void tile_cache_free_cb(tile_cache_data_t * item, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(item->src);
+    lv_draw_buf_destroy(item->tile);
+}
+
+static lv_cache_compare_res_t tile_cache_compare_cb(const tile_cache_data_t * lhs, const tile_cache_data_t * rhs)
+{
+    if(lhs->index != rhs->index) {
+        return lhs->index > rhs->index ? 1 : -1;
+    }
+
+    int32_t cmp_res = lv_strcmp(lhs->src, rhs->src);
+    if(cmp_res != 0) {
+        return cmp_res > 0 ? 1 : -1;
+    }
+
+    return 0;
+}
+#endif
@@ -23,6 +23,16 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Stored after the header of binary image files with `LV_IMAGE_FLAGS_TILED`.
+ * The tiles follow it row by row. Each tile has `tile_w * tile_h` pixels with `tile_w * bpp / 8` stride,
+ * also the tiles on the right and bottom edges of the image.
+ */
+typedef struct {
+    uint16_t tile_w;
+    uint16_t tile_h;
+} lv_image_tile_header_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -32,6 +42,11 @@ extern "C" {
  */
 void lv_bin_decoder_init(void);
 
+/**
+ * Deinitialize the binary image decoder module
+ */
+void lv_bin_decoder_deinit(void);
+
 /**
  * Get info about a lvgl binary image
  * @param decoder the decoder where this function belongs
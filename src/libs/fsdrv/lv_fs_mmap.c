@@ -0,0 +1,282 @@
+/**
+ * @file lv_fs_mmap.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+
+#if LV_USE_FS_MMAP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <errno.h>
+#include "../../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#if LV_FS_MMAP_LETTER == '\0'
+    #error "LV_FS_MMAP_LETTER must be set to a valid value"
+#else
+    #if (LV_FS_MMAP_LETTER < 'A') || (LV_FS_MMAP_LETTER > 'Z')
+        #error "LV_FS_MMAP_LETTER must be an upper case ASCII letter"
+    #endif
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint8_t * map;      /**< Start of the mapped file. NULL for empty files*/
+    uint32_t size;      /**< Size of the file in bytes*/
+    uint32_t pos;       /**< Read position*/
+} mmap_file_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void * fs_open(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode);
+static lv_fs_res_t fs_close(lv_fs_drv_t * drv, void * file_p);
+static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br);
+static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
+static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
+static lv_fs_res_t fs_get_buffer(lv_fs_drv_t * drv, void * file_p, const void ** buf, uint32_t * size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+/**
+ * Register a driver for the File system interface
+ */
+void lv_fs_mmap_init(void)
+{
+    /*---------------------------------------------------
+     * Register the file system interface in LVGL
+     *--------------------------------------------------*/
+
+    lv_fs_drv_t * fs_drv_p = &(LV_GLOBAL_DEFAULT()->mmap_fs_drv);
+    lv_fs_drv_init(fs_drv_p);
+
+    /*Set up fields...*/
+    fs_drv_p->letter = LV_FS_MMAP_LETTER;
+
+    /*The whole file is in memory so there is nothing to cache*/
+    fs_drv_p->cache_size = 0;
+
+    fs_drv_p->open_cb = fs_open;
+    fs_drv_p->close_cb = fs_close;
+    fs_drv_p->read_cb = fs_read;
+    fs_drv_p->seek_cb = fs_seek;
+    fs_drv_p->tell_cb = fs_tell;
+    fs_drv_p->get_buffer_cb = fs_get_buffer;
+
+    lv_fs_drv_register(fs_drv_p);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Open a file and map it into the memory
+ * @param drv   pointer to a driver where this function belongs
+ * @param path  path to the file beginning with the driver letter (e.g. S:/folder/file.txt)
+ * @param mode  only FS_MODE_RD is supported
+ * @return a file handle or NULL in case of fail
+ */
+static void * fs_open(lv_fs_drv_t * drv, const char * path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(drv);
+
+    if(mode != LV_FS_MODE_RD) {
+        LV_LOG_WARN("Files can be opened only for reading: %s", path);
+        return NULL;
+    }
+
+    /*Make the path relative to the current directory (the projects root folder)*/
+    char buf[256];
+    lv_snprintf(buf, sizeof(buf), LV_FS_MMAP_PATH "%s", path);
+
+    int fd = open(buf, O_RDONLY);
+    if(fd < 0) {
+        LV_LOG_WARN("Could not open file: %s, errno: %d", buf, errno);
+        return NULL;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) < 0 || st.st_size > (off_t)UINT32_MAX) {
+        LV_LOG_WARN("Could not get the size of file: %s, errno: %d", buf, errno);
+        close(fd);
+        return NULL;
+    }
+
+    mmap_file_t * file = lv_malloc_zeroed(sizeof(mmap_file_t));
+    LV_ASSERT_MALLOC(file);
+    if(file == NULL) {
+        close(fd);
+        return NULL;
+    }
+
+    file->size = (uint32_t)st.st_size;
+
+    /*Zero length mappings are not allowed*/
+    if(file->size > 0) {
+        void * map = mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(map == MAP_FAILED) {
+            LV_LOG_WARN("Could not map file: %s, errno: %d", buf, errno);
+            lv_free(file);
+            close(fd);
+            return NULL;
+        }
+        file->map = map;
+    }
+
+    /*The mapping stays valid after closing the file descriptor*/
+    close(fd);
+
+    return file;
+}
+
+/**
+ * Unmap and close a file
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle. (opened with fs_open)
+ * @return LV_FS_RES_OK: no error, the file is read
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_close(lv_fs_drv_t * drv, void * file_p)
+{
+    LV_UNUSED(drv);
+
+    mmap_file_t * file = file_p;
+    lv_fs_res_t res = LV_FS_RES_OK;
+    if(file->map && munmap(file->map, file->size) < 0) {
+        LV_LOG_WARN("Could not unmap file, errno: %d", errno);
+        res = LV_FS_RES_FS_ERR;
+    }
+
+    lv_free(file);
+    return res;
+}
+
+/**
+ * Copy data from the mapped file
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable.
+ * @param buf       pointer to a memory block where to store the read data
+ * @param btr       number of Bytes To Read
+ * @param br        the real number of read bytes (Byte Read)
+ * @return LV_FS_RES_OK: no error, the file is read
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_read(lv_fs_drv_t * drv, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(drv);
+
+    mmap_file_t * file = file_p;
+    uint32_t remaining = file->size - file->pos;
+    if(btr > remaining) btr = remaining;
+
+    if(btr) lv_memcpy(buf, file->map + file->pos, btr);
+    file->pos += btr;
+
+    *br = btr;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Set the read pointer
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable. (opened with fs_open )
+ * @param pos       the new position of read pointer
+ * @return LV_FS_RES_OK: no error, the file is read
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_seek(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(drv);
+
+    mmap_file_t * file = file_p;
+    int64_t new_pos;
+    switch(whence) {
+        case LV_FS_SEEK_SET:
+            new_pos = pos;
+            break;
+        case LV_FS_SEEK_CUR:
+            new_pos = (int64_t)file->pos + (int32_t)pos;
+            break;
+        case LV_FS_SEEK_END:
+            new_pos = (int64_t)file->size + (int32_t)pos;
+            break;
+        default:
+            return LV_FS_RES_INV_PARAM;
+    }
+
+    /*The file can't be expanded*/
+    if(new_pos < 0 || new_pos > file->size) return LV_FS_RES_INV_PARAM;
+
+    file->pos = (uint32_t)new_pos;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Give the position of the read pointer
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable
+ * @param pos_p     pointer to store the result
+ * @return LV_FS_RES_OK: no error, the file is read
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_tell(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p)
+{
+    LV_UNUSED(drv);
+
+    mmap_file_t * file = file_p;
+    *pos_p = file->pos;
+    return LV_FS_RES_OK;
+}
+
+/**
+ * Give the mapped content of the file
+ * @param drv       pointer to a driver where this function belongs
+ * @param file_p    a file handle variable
+ * @param buf       store the start of the mapping here
+ * @param size      store the size of the file here
+ * @return LV_FS_RES_OK: no error
+ *         any error from lv_fs_res_t enum
+ */
+static lv_fs_res_t fs_get_buffer(lv_fs_drv_t * drv, void * file_p, const void ** buf, uint32_t * size)
+{
+    LV_UNUSED(drv);
+
+    mmap_file_t * file = file_p;
+    if(file->map == NULL) return LV_FS_RES_NOT_EX;
+
+    *buf = file->map;
+    *size = file->size;
+    return LV_FS_RES_OK;
+}
+
+#else /*LV_USE_FS_MMAP == 0*/
+
+#if defined(LV_FS_MMAP_LETTER) && LV_FS_MMAP_LETTER != '\0'
+    #warning "LV_USE_FS_MMAP is not enabled but LV_FS_MMAP_LETTER is set"
+#endif
+
+#endif /*LV_USE_FS_MMAP*/
@@ -353,6 +353,42 @@
     #endif
 #endif
 
+/** 1: Drop or clip the draw tasks which are covered by a later opaque fill, image or layer
+ * in the same layer. Only the draw tasks not taken by a draw unit yet can be culled.
+ * See `lv_draw_occlusion_monitor()` for statistics. */
+#ifndef LV_DRAW_OCCLUSION_CULLING
+    #ifdef CONFIG_LV_DRAW_OCCLUSION_CULLING
+        #define LV_DRAW_OCCLUSION_CULLING CONFIG_LV_DRAW_OCCLUSION_CULLING
+    #else
+        #define LV_DRAW_OCCLUSION_CULLING 0
+    #endif
+#endif
+
+/** If > 0 and the display uses more draw units (see `lv_display_set_tile_cnt()`) the refreshed
+ * areas are split into a grid of tiles of about this size so that each fits the data cache.
+ * The draw tasks are collected once and replayed on each tile, so the draw units can render
+ * the tiles in parallel. 0: split the areas into full width horizontal stripes instead. */
+#ifndef LV_DRAW_TILE_SIZE
+    #ifdef CONFIG_LV_DRAW_TILE_SIZE
+        #define LV_DRAW_TILE_SIZE CONFIG_LV_DRAW_TILE_SIZE
+    #else
+        #define LV_DRAW_TILE_SIZE 0         /**< [bytes]*/
+    #endif
+#endif
+
+/** 1: Allow rendering displays on their own thread with `lv_display_set_render_thread()`.
+ * The widgets are drawn on the thread of `lv_timer_handler()` to record the draw tasks and
+ * the recorded draw tasks are rendered and flushed on the display's thread,
+ * so independent displays can be rendered in parallel. `flush_cb` is called from the display's thread too.
+ * Requires `LV_USE_OS` and can't be used with the SDL and OpenGL ES draw units. */
+#ifndef LV_USE_DISPLAY_RENDER_THREAD
+    #ifdef CONFIG_LV_USE_DISPLAY_RENDER_THREAD
+        #define LV_USE_DISPLAY_RENDER_THREAD CONFIG_LV_USE_DISPLAY_RENDER_THREAD
+    #else
+        #define LV_USE_DISPLAY_RENDER_THREAD 0
+    #endif
+#endif
+
 /** Stack size of drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
@@ -1192,6 +1228,17 @@
     #endif
 #endif
 
+/** Allow decoding image files on a background thread if they are not in the image cache yet.
+ *  Until an image is decoded a placeholder is drawn and the widget is redrawn when the image is ready.
+ *  Enable it with `lv_image_decoder_set_async(true)`. Requires `LV_USE_OS` and `LV_CACHE_DEF_SIZE > 0`. */
+#ifndef LV_USE_IMAGE_DECODER_ASYNC
+    #ifdef CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+        #define LV_USE_IMAGE_DECODER_ASYNC CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+    #else
+        #define LV_USE_IMAGE_DECODER_ASYNC  0
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1225,6 +1272,81 @@
     #endif
 #endif
 
+/** Keep the list of widgets using each style. `lv_obj_report_style_change(style)` then refreshes
+ *  only these widgets instead of walking all widgets, and only as much as the changed
+ *  properties require (e.g. color changes don't update the layout). */
+#ifndef LV_OBJ_STYLE_USER_INDEX
+    #ifdef CONFIG_LV_OBJ_STYLE_USER_INDEX
+        #define LV_OBJ_STYLE_USER_INDEX CONFIG_LV_OBJ_STYLE_USER_INDEX
+    #else
+        #define LV_OBJ_STYLE_USER_INDEX 0
+    #endif
+#endif
+
+/** Allow recording the draw tasks of widgets having `LV_OBJ_FLAG_CACHE_DRAW_LIST` once
+ *  and replaying them on the next refreshes instead of sending the draw events again. */
+#ifndef LV_OBJ_DRAW_LIST_CACHE
+    #ifdef CONFIG_LV_OBJ_DRAW_LIST_CACHE
+        #define LV_OBJ_DRAW_LIST_CACHE CONFIG_LV_OBJ_DRAW_LIST_CACHE
+    #else
+        #define LV_OBJ_DRAW_LIST_CACHE  0
+    #endif
+#endif
+
+/** Memory in bytes to keep the rendered layers of widgets with `lv_obj_set_layer_cache(obj, true)`
+ *  between refreshes. While only their transformation or opacity changes, the cached layer is
+ *  blended again instead of rendering the widget and its children. 0: disable the layer cache */
+#ifndef LV_OBJ_LAYER_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_LAYER_CACHE_SIZE
+        #define LV_OBJ_LAYER_CACHE_SIZE CONFIG_LV_OBJ_LAYER_CACHE_SIZE
+    #else
+        #define LV_OBJ_LAYER_CACHE_SIZE 0
+    #endif
+#endif
+
+/** Allocate the widgets and their `spec_attr` from slabs holding this many items each,
+ *  with one slab allocator per widget class. It reduces the heap fragmentation when screens
+ *  are created and deleted often. 0: allocate them from the heap one by one */
+#ifndef LV_OBJ_SLAB_ITEM_CNT
+    #ifdef CONFIG_LV_OBJ_SLAB_ITEM_CNT
+        #define LV_OBJ_SLAB_ITEM_CNT CONFIG_LV_OBJ_SLAB_ITEM_CNT
+    #else
+        #define LV_OBJ_SLAB_ITEM_CNT    0
+    #endif
+#endif
+
+/** Number of calls `lv_async_call()` can queue. The calls can be made from any thread or
+ *  interrupt without the LVGL lock and are run by `lv_timer_handler()`.
+ *  0: create a one-shot timer for every call, which requires the LVGL lock */
+#ifndef LV_ASYNC_QUEUE_SIZE
+    #ifdef CONFIG_LV_ASYNC_QUEUE_SIZE
+        #define LV_ASYNC_QUEUE_SIZE CONFIG_LV_ASYNC_QUEUE_SIZE
+    #else
+        #define LV_ASYNC_QUEUE_SIZE     0
+    #endif
+#endif
+#if LV_ASYNC_QUEUE_SIZE
+    /** Maximum number of calls to run in one `lv_timer_handler()`, the others run in the next ones.
+     *  0: run all the calls queued before `lv_timer_handler()` was started */
+    #ifndef LV_ASYNC_QUEUE_BUDGET
+        #ifdef CONFIG_LV_ASYNC_QUEUE_BUDGET
+            #define LV_ASYNC_QUEUE_BUDGET CONFIG_LV_ASYNC_QUEUE_BUDGET
+        #else
+            #define LV_ASYNC_QUEUE_BUDGET   0
+        #endif
+    #endif
+
+    /** 1: If the queue is full create a one-shot timer for the call. It's safe only in the LVGL thread.
+     *  0: Drop the call and return `LV_RESULT_INVALID` */
+    #ifndef LV_ASYNC_QUEUE_OVERFLOW_TIMER
+        #ifdef CONFIG_LV_ASYNC_QUEUE_OVERFLOW_TIMER
+            #define LV_ASYNC_QUEUE_OVERFLOW_TIMER CONFIG_LV_ASYNC_QUEUE_OVERFLOW_TIMER
+        #else
+            #define LV_ASYNC_QUEUE_OVERFLOW_TIMER   0
+        #endif
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -2558,6 +2680,31 @@
     #endif
 #endif
 
+/** API for open and mmap. Read-only access to memory-mapped files, images can be drawn from the mapping directly. */
+#ifndef LV_USE_FS_MMAP
+    #ifdef CONFIG_LV_USE_FS_MMAP
+        #define LV_USE_FS_MMAP CONFIG_LV_USE_FS_MMAP
+    #else
+        #define LV_USE_FS_MMAP 0
+    #endif
+#endif
+#if LV_USE_FS_MMAP
+    #ifndef LV_FS_MMAP_LETTER
+        #ifdef CONFIG_LV_FS_MMAP_LETTER
+            #define LV_FS_MMAP_LETTER CONFIG_LV_FS_MMAP_LETTER
+        #else
+            #define LV_FS_MMAP_LETTER '\0'      /**< Set an upper cased letter on which the drive will accessible (e.g. 'A') */
+        #endif
+    #endif
+    #ifndef LV_FS_MMAP_PATH
+        #ifdef CONFIG_LV_FS_MMAP_PATH
+            #define LV_FS_MMAP_PATH CONFIG_LV_FS_MMAP_PATH
+        #else
+            #define LV_FS_MMAP_PATH ""          /**< Set the working directory. File/directory paths will be appended to it. */
+        #endif
+    #endif
+#endif
+
 /** API for CreateFile, ReadFile, etc. */
 #ifndef LV_USE_FS_WIN32
     #ifdef CONFIG_LV_USE_FS_WIN32
@@ -2763,6 +2910,26 @@
     #endif
 #endif
 
+/** Max. number of bytes to read at once when drawing a bin image file which is not loaded to RAM.
+ *  The drawn area is read in bands of lines with one read per band. 0: read one line at a time */
+#ifndef LV_BIN_DECODER_BAND_SIZE
+    #ifdef CONFIG_LV_BIN_DECODER_BAND_SIZE
+        #define LV_BIN_DECODER_BAND_SIZE CONFIG_LV_BIN_DECODER_BAND_SIZE
+    #else
+        #define LV_BIN_DECODER_BAND_SIZE 0
+    #endif
+#endif
+
+/** Number of tiles of tiled bin image files (`LV_IMAGE_FLAGS_TILED`) to keep in RAM.
+ *  0: read the tiles every time they are drawn */
+#ifndef LV_BIN_DECODER_TILE_CACHE_CNT
+    #ifdef CONFIG_LV_BIN_DECODER_TILE_CACHE_CNT
+        #define LV_BIN_DECODER_TILE_CACHE_CNT CONFIG_LV_BIN_DECODER_TILE_CACHE_CNT
+    #else
+        #define LV_BIN_DECODER_TILE_CACHE_CNT 0
+    #endif
+#endif
+
 /** RLE decompress library */
 #ifndef LV_USE_RLE
     #ifdef CONFIG_LV_USE_RLE
@@ -3276,6 +3443,18 @@
         #define LV_USE_OBSERVER 1
     #endif
 #endif
+#if LV_USE_OBSERVER
+    /** Number of values other threads can post to subjects with `lv_subject_post_int()` and friends
+     *  without taking the LVGL lock. They are applied by `lv_timer_handler()`.
+     *  0: disable posting */
+    #ifndef LV_OBSERVER_POST_QUEUE_SIZE
+        #ifdef CONFIG_LV_OBSERVER_POST_QUEUE_SIZE
+            #define LV_OBSERVER_POST_QUEUE_SIZE CONFIG_LV_OBSERVER_POST_QUEUE_SIZE
+        #else
+            #define LV_OBSERVER_POST_QUEUE_SIZE 0
+        #endif
+    #endif
+#endif
 
 /** 1: Enable Pinyin input method
  *  - Requires: lv_keyboard */
@@ -15,6 +15,9 @@
 #include "core/lv_refr_private.h"
 #include "core/lv_obj_style_private.h"
 #include "core/lv_group_private.h"
+#include "core/lv_obj_draw_private.h"
+#include "core/lv_obj_class_private.h"
+#include "core/lv_obj_private.h"
 #include "lv_init.h"
 #include "core/lv_global.h"
 #include "core/lv_obj.h"
@@ -33,12 +36,14 @@
 #include "libs/libpng/lv_libpng.h"
 #include "libs/tiny_ttf/lv_tiny_ttf.h"
 #include "draw/lv_draw.h"
-#include "misc/lv_async.h"
+#include "misc/lv_async_private.h"
 #include "misc/lv_fs_private.h"
 #include "widgets/span/lv_span.h"
 #include "themes/simple/lv_theme_simple.h"
 #include "misc/lv_fs.h"
 #include "osal/lv_os_private.h"
+#include "others/observer/lv_observer_private.h"
+#include "others/ime/lv_ime_pinyin_private.h"
 
 #if LV_USE_NEMA_GFX
     #include "draw/nema_gfx/lv_draw_nema_gfx.h"
@@ -115,6 +120,16 @@ static inline void lv_global_init(lv_global_t * global)
 
     lv_ll_init(&(global->disp_ll), sizeof(lv_display_t));
     lv_ll_init(&(global->indev_ll), sizeof(lv_indev_t));
+#if LV_OBJ_LAYER_CACHE_SIZE
+    lv_ll_init(&(global->layer_cache_ll), sizeof(lv_obj_layer_cache_t));
+#endif
+#if LV_OBJ_SLAB_ITEM_CNT
+    lv_ll_init(&(global->obj_slab_ll), sizeof(lv_obj_class_slab_t));
+    lv_slab_init(&(global->spec_attr_slab), sizeof(lv_obj_spec_attr_t), LV_OBJ_SLAB_ITEM_CNT);
+#endif
+#if LV_USE_IME_PINYIN
+    lv_ll_init(&(global->ime_pinyin_trie_ll), sizeof(lv_ime_pinyin_shared_trie_t));
+#endif
 
     global->memory_zero = ZERO_MEM_SENTINEL;
     global->style_refresh = true;
@@ -191,6 +206,10 @@ void lv_init(void)
 
     lv_timer_core_init();
 
+#if LV_ASYNC_QUEUE_SIZE
+    lv_async_queue_init();
+#endif
+
     lv_fs_init();
 
     lv_layout_init();
@@ -199,6 +218,10 @@ void lv_init(void)
 
     lv_group_init();
 
+#if LV_USE_OBSERVER && LV_OBSERVER_POST_QUEUE_SIZE
+    lv_subject_post_queue_init();
+#endif
+
     lv_draw_init();
 
 #if LV_USE_DRAW_SW
@@ -304,6 +327,10 @@ void lv_init(void)
     lv_fs_posix_init();
 #endif
 
+#if LV_USE_FS_MMAP
+    lv_fs_mmap_init();
+#endif
+
 #if LV_USE_FS_WIN32 != '\0'
     lv_fs_win32_init();
 #endif
@@ -404,12 +431,17 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+    lv_bin_decoder_deinit();
     lv_image_decoder_deinit();
 
     lv_refr_deinit();
 
     lv_obj_style_deinit();
 
+#if LV_OBJ_SLAB_ITEM_CNT
+    lv_obj_class_slab_deinit();
+#endif
+
 #if LV_USE_PXP
 #if LV_USE_DRAW_PXP || LV_USE_ROTATE_PXP
     lv_draw_pxp_deinit();
@@ -440,6 +472,10 @@ void lv_deinit(void)
 
     lv_group_deinit();
 
+#if LV_USE_OBSERVER && LV_OBSERVER_POST_QUEUE_SIZE
+    lv_subject_post_queue_deinit();
+#endif
+
     lv_anim_core_deinit();
 
     lv_layout_deinit();
@@ -448,6 +484,10 @@ void lv_deinit(void)
 
     lv_timer_core_deinit();
 
+#if LV_ASYNC_QUEUE_SIZE
+    lv_async_queue_deinit();
+#endif
+
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
     lv_profiler_builtin_uninit();
 #endif
@@ -52,11 +52,13 @@ extern "C" {
 #include "core/lv_obj_style_private.h"
 #include "core/lv_obj_private.h"
 #include "core/lv_obj_scroll_private.h"
+#include "core/lv_obj_tree_private.h"
 #include "core/lv_obj_draw_private.h"
 #include "core/lv_obj_class_private.h"
 #include "core/lv_group_private.h"
 #include "core/lv_obj_event_private.h"
 #include "misc/lv_timer_private.h"
+#include "misc/lv_async_private.h"
 #include "misc/lv_area_private.h"
 #include "misc/lv_fs_private.h"
 #include "misc/lv_profiler_builtin_private.h"
@@ -101,6 +101,22 @@ bool lv_image_cache_is_enabled(void)
     return lv_cache_is_enabled(img_cache_p);
 }
 
+lv_result_t lv_image_cache_prefetch(const void * src)
+{
+    if(src == NULL || !lv_image_cache_is_enabled()) return LV_RESULT_INVALID;
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    if(lv_image_decoder_async_request(src, NULL) == LV_RESULT_OK) return LV_RESULT_OK;
+#endif
+
+    /*Decode it now, the decoded image remains in the cache*/
+    lv_image_decoder_dsc_t dsc;
+    lv_result_t res = lv_image_decoder_open(&dsc, src, NULL);
+    if(res == LV_RESULT_OK) lv_image_decoder_close(&dsc);
+
+    return res;
+}
+
 lv_iter_t * lv_image_cache_iter_create(void)
 {
     return lv_cache_iter_create(img_cache_p);
@@ -157,6 +173,10 @@ static void image_cache_free_cb(lv_image_cache_data_t * entry, void * user_data)
         lv_draw_buf_destroy(decoded);
     }
 
+    /*Let the decoder free what it kept for the entry*/
+    lv_image_decoder_t * decoder = (lv_image_decoder_t *)entry->decoder;
+    if(decoder && decoder->cache_free_cb) decoder->cache_free_cb(decoder, entry);
+
     /*Free the duplicated file name*/
     if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
 }
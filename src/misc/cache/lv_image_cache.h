@@ -56,6 +56,16 @@ void lv_image_cache_drop(const void * src);
  */
 bool lv_image_cache_is_enabled(void);
 
+/**
+ * Decode an image into the image cache before it's drawn, e.g. to prepare the images of the next screen.
+ * If asynchronous decoding is enabled with `lv_image_decoder_set_async(true)` image files are decoded
+ * on the background thread, else the image is decoded immediately.
+ * @param src       pointer to an image source
+ * @return          LV_RESULT_OK: the image is (being) decoded; LV_RESULT_INVALID: the image can't be decoded
+ *                  or the cache is disabled
+ */
+lv_result_t lv_image_cache_prefetch(const void * src);
+
 /**
  * Create an iterator to iterate over the image cache.
  * @return an iterator to iterate over the image cache.
@@ -40,6 +40,7 @@ static uint32_t convert_speed_to_time(uint32_t speed, int32_t start, int32_t end
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(lv_anim_t * a_current);
 static void remove_anim(void * a);
+static uint32_t anim_get_time(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -96,7 +97,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
     new_anim->run_round = state.anim_run_round;
-    new_anim->last_timer_run = lv_tick_get();
+    new_anim->last_timer_run = anim_get_time();
 
     /*Set the start value*/
     if(new_anim->early_apply) {
@@ -242,6 +243,11 @@ void lv_anim_refr_now(void)
     anim_timer(NULL);
 }
 
+void lv_anim_set_time_offset(uint32_t ofs)
+{
+    state.time_ofs = ofs;
+}
+
 int32_t lv_anim_path_linear(const lv_anim_t * a)
 {
     /*Calculate the current step*/
@@ -500,11 +506,13 @@ static void anim_timer(lv_timer_t * param)
     lv_anim_t * a = lv_ll_get_head(anim_ll_p);
 
     while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
+        uint32_t now = anim_get_time();
+        uint32_t elaps = now - a->last_timer_run;
+        /*Don't go back in time if the time offset was decreased*/
+        if(elaps > UINT32_MAX / 2) elaps = 0;
+        else a->last_timer_run = now;
         a->act_time += elaps;
 
-        a->last_timer_run = lv_tick_get();
-
         /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
          * happened in `anim_completed_handler` which could make this linked list reading corrupt
          * because the list is changed meanwhile
@@ -714,3 +722,12 @@ static void remove_anim(void * a)
     if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
     lv_free(a);
 }
+
+/**
+ * Get the time at which the animations are sampled
+ * @return      the current time plus the time offset
+ */
+static uint32_t anim_get_time(void)
+{
+    return lv_tick_get() + state.time_ofs;
+}
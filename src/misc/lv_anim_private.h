@@ -29,6 +29,7 @@ typedef struct {
     bool anim_run_round;
     lv_timer_t * timer;
     lv_ll_t anim_ll;
+    uint32_t time_ofs;  /**< Sample the animations this much ahead of the current time [ms]*/
 } lv_anim_state_t;
 
 /**********************
@@ -45,6 +46,13 @@ void lv_anim_core_init(void);
  */
 void lv_anim_core_deinit(void);
 
+/**
+ * Sample the animations ahead of the current time. Used to sample them at the time
+ * when the rendered frame will be visible.
+ * @param ofs   time to add to the current time [ms]
+ */
+void lv_anim_set_time_offset(uint32_t ofs);
+
 /**********************
  *      MACROS
  **********************/
@@ -7,13 +7,19 @@
  *      INCLUDES
  *********************/
 
-#include "lv_async.h"
+#include "lv_async_private.h"
 #include "lv_timer_private.h"
+#include "lv_atomic.h"
+#include "lv_math.h"
+#include "lv_profiler.h"
+#include "../core/lv_global.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define async_queue LV_GLOBAL_DEFAULT()->async_queue
 
 /**********************
  *      TYPEDEFS
@@ -29,6 +35,7 @@ typedef struct _lv_async_info_t {
  **********************/
 
 static void lv_async_timer_cb(lv_timer_t * timer);
+static lv_result_t async_timer_create(lv_async_cb_t async_xcb, void * user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -44,44 +51,57 @@ static void lv_async_timer_cb(lv_timer_t * timer);
 
 lv_result_t lv_async_call(lv_async_cb_t async_xcb, void * user_data)
 {
-    /*Allocate an info structure*/
-    lv_async_info_t * info = lv_malloc(sizeof(lv_async_info_t));
-
-    if(info == NULL)
-        return LV_RESULT_INVALID;
-
-    /*Create a new timer*/
-    lv_timer_t * timer = lv_timer_create(lv_async_timer_cb, 0, info);
-
-    if(timer == NULL) {
-        lv_free(info);
-        return LV_RESULT_INVALID;
+#if LV_ASYNC_QUEUE_SIZE
+    lv_async_info_t info;
+    info.cb = async_xcb;
+    info.user_data = user_data;
+    if(lv_mpsc_queue_push(&async_queue.queue, &info) == LV_RESULT_OK) {
+        lv_atomic_fetch_add(&async_queue.stat.posted, 1);
+        return LV_RESULT_OK;
     }
 
-    info->cb = async_xcb;
-    info->user_data = user_data;
+#if LV_ASYNC_QUEUE_OVERFLOW_TIMER
+    async_queue.stat.overflowed++;
+#else
+    lv_atomic_fetch_add(&async_queue.stat.dropped, 1);
+    return LV_RESULT_INVALID;
+#endif
+#endif
 
-    lv_timer_set_repeat_count(timer, 1);
-    return LV_RESULT_OK;
+    return async_timer_create(async_xcb, user_data);
 }
 
 lv_result_t lv_async_call_cancel(lv_async_cb_t async_xcb, void * user_data)
 {
-    lv_timer_t * timer = lv_timer_get_next(NULL);
     lv_result_t res = LV_RESULT_INVALID;
 
+#if LV_ASYNC_QUEUE_SIZE
+    /*Mark the queued calls as cancelled, they are skipped when popped*/
+    uint32_t i = 0;
+    lv_async_info_t * info;
+    while((info = lv_mpsc_queue_peek(&async_queue.queue, i)) != NULL) {
+        if(info->cb == async_xcb && info->user_data == user_data) {
+            info->cb = NULL;
+            async_queue.stat.cancelled++;
+            res = LV_RESULT_OK;
+        }
+        i++;
+    }
+#endif
+
+    lv_timer_t * timer = lv_timer_get_next(NULL);
     while(timer != NULL) {
         /*Find the next timer node*/
         lv_timer_t * timer_next = lv_timer_get_next(timer);
 
         /*Find async timer callback*/
         if(timer->timer_cb == lv_async_timer_cb) {
-            lv_async_info_t * info = (lv_async_info_t *)timer->user_data;
+            lv_async_info_t * timer_info = (lv_async_info_t *)timer->user_data;
 
             /*Match user function callback and user data*/
-            if(info->cb == async_xcb && info->user_data == user_data) {
+            if(timer_info->cb == async_xcb && timer_info->user_data == user_data) {
                 lv_timer_delete(timer);
-                lv_free(info);
+                lv_free(timer_info);
                 res = LV_RESULT_OK;
             }
         }
@@ -92,10 +112,93 @@ lv_result_t lv_async_call_cancel(lv_async_cb_t async_xcb, void * user_data)
     return res;
 }
 
+#if LV_ASYNC_QUEUE_SIZE
+
+void lv_async_get_stat(lv_async_stat_t * stat)
+{
+    *stat = async_queue.stat;
+}
+
+void lv_async_queue_init(void)
+{
+    lv_memzero(&async_queue.stat, sizeof(lv_async_stat_t));
+    lv_mpsc_queue_init(&async_queue.queue, sizeof(lv_async_info_t), LV_ASYNC_QUEUE_SIZE);
+}
+
+void lv_async_queue_deinit(void)
+{
+    lv_mpsc_queue_deinit(&async_queue.queue);
+}
+
+bool lv_async_queue_run(void)
+{
+    lv_mpsc_queue_t * queue = &async_queue.queue;
+
+    /*Don't run the calls queued meanwhile, e.g. by the callbacks, to not get stuck here*/
+    uint32_t cnt = lv_mpsc_queue_get_count(queue);
+    if(cnt == 0) return false;
+
+    LV_PROFILER_BEGIN;
+
+    async_queue.stat.max_pending = LV_MAX(async_queue.stat.max_pending, cnt);
+
+    bool more = false;
+#if LV_ASYNC_QUEUE_BUDGET
+    if(cnt > LV_ASYNC_QUEUE_BUDGET) {
+        cnt = LV_ASYNC_QUEUE_BUDGET;
+        more = true;
+    }
+#endif
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_async_info_t info;
+        /*The next call is still being written by a producer*/
+        if(lv_mpsc_queue_pop(queue, &info) != LV_RESULT_OK) {
+            more = true;
+            break;
+        }
+
+        if(info.cb == NULL) continue;   /*Cancelled*/
+
+        async_queue.stat.executed++;
+        info.cb(info.user_data);
+    }
+
+    LV_PROFILER_END;
+
+    return more;
+}
+
+#endif /*LV_ASYNC_QUEUE_SIZE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static lv_result_t async_timer_create(lv_async_cb_t async_xcb, void * user_data)
+{
+    /*Allocate an info structure*/
+    lv_async_info_t * info = lv_malloc(sizeof(lv_async_info_t));
+
+    if(info == NULL)
+        return LV_RESULT_INVALID;
+
+    /*Create a new timer*/
+    lv_timer_t * timer = lv_timer_create(lv_async_timer_cb, 0, info);
+
+    if(timer == NULL) {
+        lv_free(info);
+        return LV_RESULT_INVALID;
+    }
+
+    info->cb = async_xcb;
+    info->user_data = user_data;
+
+    lv_timer_set_repeat_count(timer, 1);
+    return LV_RESULT_OK;
+}
+
 static void lv_async_timer_cb(lv_timer_t * timer)
 {
     /*Save the info because an lv_async_call_cancel might delete it in the callback*/
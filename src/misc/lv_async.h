@@ -29,6 +29,20 @@ extern "C" {
  */
 typedef void (*lv_async_cb_t)(void *);
 
+#if LV_ASYNC_QUEUE_SIZE
+/**
+ * Statistics of the queue of the async calls.
+ */
+typedef struct {
+    uint32_t posted;        /**< Number of calls added to the queue*/
+    uint32_t executed;      /**< Number of calls run from the queue*/
+    uint32_t cancelled;     /**< Number of queued calls cancelled by `lv_async_call_cancel()`*/
+    uint32_t dropped;       /**< Number of calls dropped because the queue was full*/
+    uint32_t overflowed;    /**< Number of calls added as timer because the queue was full*/
+    uint32_t max_pending;   /**< The highest number of calls waiting in the queue*/
+} lv_async_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -40,16 +54,28 @@ typedef void (*lv_async_cb_t)(void *);
  *                 (the 'x' in the argument name indicates that it's not a fully generic function because it not follows
  *                  the `func_name(object, callback, ...)` convention)
  * @param user_data custom parameter
+ * @return          LV_RESULT_OK: the call was scheduled; LV_RESULT_INVALID: out of memory or the queue is full
+ * @note            With `LV_ASYNC_QUEUE_SIZE > 0` it can be called from any thread or interrupt
+ *                  without `lv_lock()`, unless the queue is full and `LV_ASYNC_QUEUE_OVERFLOW_TIMER` is enabled.
  */
 lv_result_t lv_async_call(lv_async_cb_t async_xcb, void * user_data);
 
 /**
- * Cancel an asynchronous function call
+ * Cancel an asynchronous function call. Only the LVGL thread can call it.
  * @param async_xcb a callback which is the task itself.
  * @param user_data custom parameter
+ * @return          LV_RESULT_OK: at least one call was cancelled; LV_RESULT_INVALID: no such call was found
  */
 lv_result_t lv_async_call_cancel(lv_async_cb_t async_xcb, void * user_data);
 
+#if LV_ASYNC_QUEUE_SIZE
+/**
+ * Get the statistics of the queue of the async calls.
+ * @param stat      pointer to an `lv_async_stat_t` variable to fill
+ */
+void lv_async_get_stat(lv_async_stat_t * stat);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,69 @@
+/**
+ * @file lv_async_private.h
+ *
+ */
+
+#ifndef LV_ASYNC_PRIVATE_H
+#define LV_ASYNC_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_async.h"
+
+#if LV_ASYNC_QUEUE_SIZE
+
+#include "lv_mpsc_queue.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * The queue of the async calls
+ */
+typedef struct {
+    lv_mpsc_queue_t queue;      /**< The queued `lv_async_info_t`s*/
+    lv_async_stat_t stat;       /**< Statistics, `posted` and `dropped` are updated atomically*/
+} lv_async_queue_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Allocate the queue of the async calls.
+ */
+void lv_async_queue_init(void);
+
+/**
+ * Free the queue of the async calls. The queued calls are dropped.
+ */
+void lv_async_queue_deinit(void);
+
+/**
+ * Run the queued async calls. Called from `lv_timer_handler()`.
+ * @return      true: there are more calls to run because the budget was used up
+ */
+bool lv_async_queue_run(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_ASYNC_QUEUE_SIZE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ASYNC_PRIVATE_H*/
@@ -0,0 +1,114 @@
+/**
+ * @file lv_atomic.h
+ * Atomic operations on 32 bit integers to share data between threads and interrupts
+ * without locking. Only the few operations needed by LVGL are provided.
+ */
+
+#ifndef LV_ATOMIC_H
+#define LV_ATOMIC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_types.h"
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#else
+#error "lv_atomic.h: no atomic operations are available. Use GCC, Clang, MSVC or a C11 compiler with <stdatomic.h>"
+#endif
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Read a value with acquire semantics: the memory accesses after it can't be moved before it.
+ * @param p     pointer to the value
+ * @return      the value
+ */
+static inline uint32_t lv_atomic_load(const volatile uint32_t * p)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+    return (uint32_t)_InterlockedOr((volatile long *)p, 0);
+#else
+    return atomic_load_explicit((const volatile _Atomic uint32_t *)p, memory_order_acquire);
+#endif
+}
+
+/**
+ * Write a value with release semantics: the memory accesses before it can't be moved after it.
+ * @param p     pointer to the value
+ * @param v     the new value
+ */
+static inline void lv_atomic_store(volatile uint32_t * p, uint32_t v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+    _InterlockedExchange((volatile long *)p, (long)v);
+#else
+    atomic_store_explicit((volatile _Atomic uint32_t *)p, v, memory_order_release);
+#endif
+}
+
+/**
+ * Set a value to `desired` only if it's equal to `expected`.
+ * @param p         pointer to the value
+ * @param expected  the expected current value
+ * @param desired   the new value
+ * @return          true: the value was updated; false: the value wasn't `expected`
+ */
+static inline bool lv_atomic_compare_exchange(volatile uint32_t * p, uint32_t expected, uint32_t desired)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#elif defined(_MSC_VER)
+    return (uint32_t)_InterlockedCompareExchange((volatile long *)p, (long)desired, (long)expected) == expected;
+#else
+    return atomic_compare_exchange_strong_explicit((volatile _Atomic uint32_t *)p, &expected, desired,
+                                                   memory_order_acq_rel, memory_order_acquire);
+#endif
+}
+
+/**
+ * Add to a value.
+ * @param p     pointer to the value
+ * @param v     the value to add
+ * @return      the value before the addition
+ */
+static inline uint32_t lv_atomic_fetch_add(volatile uint32_t * p, uint32_t v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_fetch_add(p, v, __ATOMIC_ACQ_REL);
+#elif defined(_MSC_VER)
+    return (uint32_t)_InterlockedExchangeAdd((volatile long *)p, (long)v);
+#else
+    return atomic_fetch_add_explicit((volatile _Atomic uint32_t *)p, v, memory_order_acq_rel);
+#endif
+}
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_ATOMIC_H*/
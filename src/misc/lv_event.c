@@ -10,6 +10,7 @@
 #include "../core/lv_global.h"
 #include "../stdlib/lv_mem.h"
 #include "lv_assert.h"
+#include "lv_math.h"
 #include "lv_types.h"
 
 /*********************
@@ -35,6 +36,7 @@ static void event_mark_deleting(lv_event_list_t * list, lv_event_dsc_t * dsc);
 static bool event_is_marked_deleting(lv_event_dsc_t * dsc);
 static uint32_t event_array_size(lv_event_list_t * list);
 static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index);
+static uint64_t event_code_to_mask(uint32_t code);
 
 /**********************
  *  STATIC VARIABLES
@@ -74,6 +76,9 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
     if(list == NULL) return LV_RESULT_OK;
     if(e->deleted) return LV_RESULT_INVALID;
 
+    /*Fast path for the common case when there is no handler for this event*/
+    if((list->code_mask & event_code_to_mask(e->code)) == 0) return LV_RESULT_OK;
+
     /* When obj is deleted in its own event, it will cause the `list->array` header to be released,
      * but the content still exists, which leads to memory leakage.
      * Therefore, back up the header in advance,
@@ -133,6 +138,7 @@ lv_event_dsc_t * lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event
     }
 
     lv_array_push_back(&list->array, &dsc);
+    list->code_mask |= event_code_to_mask(filter);
     return dsc;
 }
 
@@ -280,6 +286,13 @@ static void cleanup_event_list(lv_event_list_t * list)
     cleanup_event_list_core(&list->array);
 
     list->has_marked_deleting = false;
+
+    /*Rebuild the mask from the remaining handlers*/
+    list->code_mask = 0;
+    const uint32_t size = event_array_size(list);
+    for(uint32_t i = 0; i < size; i++) {
+        list->code_mask |= event_code_to_mask((*event_array_at(list, i))->filter);
+    }
 }
 
 static void event_mark_deleting(lv_event_list_t * list, lv_event_dsc_t * dsc)
@@ -299,3 +312,11 @@ static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index)
 {
     return lv_array_at(&list->array, index);
 }
+
+static uint64_t event_code_to_mask(uint32_t code)
+{
+    code &= ~(LV_EVENT_PREPROCESS | LV_EVENT_MARKED_DELETING);
+    if(code == LV_EVENT_ALL) return ~(uint64_t)0;
+
+    return (uint64_t)1 << LV_MIN(code, 63);
+}
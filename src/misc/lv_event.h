@@ -119,6 +119,8 @@ typedef enum {
 
 typedef struct {
     lv_array_t array;
+    uint64_t code_mask;                 /**< Bit `n` is set if there can be a handler for the event code `n`.
+                                          The codes above 62 share the last bit.*/
     uint8_t is_traversing: 1;          /**< True: the list is being nested traversed */
     uint8_t has_marked_deleting: 1;    /**< True: the list has marked deleting objects
                                          when some of events are marked as deleting */
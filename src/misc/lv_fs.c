@@ -301,6 +301,25 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     return res;
 }
 
+lv_fs_res_t lv_fs_get_buffer(lv_fs_file_t * file_p, const void ** buf, uint32_t * size)
+{
+    *buf = NULL;
+    *size = 0;
+
+    if(file_p->drv == NULL) return LV_FS_RES_INV_PARAM;
+
+    /*Memory buffers are used as cache so they can be returned directly*/
+    if(file_p->drv->cache_size == LV_FS_CACHE_FROM_BUFFER) {
+        *buf = file_p->cache->buffer;
+        *size = file_p->cache->end;
+        return LV_FS_RES_OK;
+    }
+
+    if(file_p->drv->get_buffer_cb == NULL) return LV_FS_RES_NOT_IMP;
+
+    return file_p->drv->get_buffer_cb(file_p->drv, file_p->file_d, buf, size);
+}
+
 lv_fs_res_t lv_fs_dir_open(lv_fs_dir_t * rddir_p, const char * path)
 {
     if(path == NULL) return LV_FS_RES_INV_PARAM;
@@ -78,6 +78,9 @@ struct _lv_fs_drv_t {
     lv_fs_res_t (*seek_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t pos, lv_fs_whence_t whence);
     lv_fs_res_t (*tell_cb)(lv_fs_drv_t * drv, void * file_p, uint32_t * pos_p);
 
+    /** Optional: give the whole content of the file if it's directly addressable (e.g. memory-mapped)*/
+    lv_fs_res_t (*get_buffer_cb)(lv_fs_drv_t * drv, void * file_p, const void ** buf, uint32_t * size);
+
     void * (*dir_open_cb)(lv_fs_drv_t * drv, const char * path);
     lv_fs_res_t (*dir_read_cb)(lv_fs_drv_t * drv, void * rddir_p, char * fn, uint32_t fn_len);
     lv_fs_res_t (*dir_close_cb)(lv_fs_drv_t * drv, void * rddir_p);
@@ -194,6 +197,16 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
  */
 lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos);
 
+/**
+ * Get the whole content of a file without copying it, if the driver keeps the file in memory
+ * (e.g. memory-mapped files). The buffer is valid until the file is closed and it must not be written.
+ * @param file_p    pointer to a lv_fs_file_t variable
+ * @param buf       store the start of the file's content here
+ * @param size      store the size of the file in bytes here
+ * @return          LV_FS_RES_OK or LV_FS_RES_NOT_IMP if the file is not directly addressable
+ */
+lv_fs_res_t lv_fs_get_buffer(lv_fs_file_t * file_p, const void ** buf, uint32_t * size);
+
 /**
  * Initialize a 'fs_dir_t' variable for directory reading
  * @param rddir_p   pointer to a 'lv_fs_dir_t' variable
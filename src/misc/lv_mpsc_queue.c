@@ -0,0 +1,147 @@
+/**
+ * @file lv_mpsc_queue.c
+ * Bounded multi-producer single-consumer queue of fixed-size items.
+ * Each cell has a sequence number telling whether it's free for the push
+ * of a given position or holds a published item (D. Vyukov's bounded queue).
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mpsc_queue.h"
+#include "lv_math.h"
+#include "lv_assert.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CELL_HEADER_SIZE    8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static inline volatile uint32_t * get_cell_seq(lv_mpsc_queue_t * queue, uint32_t pos);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_mpsc_queue_init(lv_mpsc_queue_t * queue, uint32_t item_size, uint32_t capacity)
+{
+    lv_memzero(queue, sizeof(lv_mpsc_queue_t));
+
+    /*A power of 2 to find the cell of a position with a mask even when the position overflows*/
+    uint32_t cell_cnt = 2;
+    while(cell_cnt < capacity) cell_cnt <<= 1;
+
+    queue->item_size = item_size;
+    queue->cell_size = CELL_HEADER_SIZE + LV_ALIGN_UP(item_size, 8);
+    queue->mask = cell_cnt - 1;
+    queue->cells = lv_malloc(cell_cnt * queue->cell_size);
+    LV_ASSERT_MALLOC(queue->cells);
+    if(queue->cells == NULL) return LV_RESULT_INVALID;
+
+    /*The cell of position `i` is free for the push of position `i`*/
+    uint32_t i;
+    for(i = 0; i < cell_cnt; i++) {
+        *get_cell_seq(queue, i) = i;
+    }
+
+    return LV_RESULT_OK;
+}
+
+void lv_mpsc_queue_deinit(lv_mpsc_queue_t * queue)
+{
+    if(queue->cells == NULL) return;
+
+    lv_free(queue->cells);
+    queue->cells = NULL;
+}
+
+lv_result_t lv_mpsc_queue_push(lv_mpsc_queue_t * queue, const void * item)
+{
+    LV_ASSERT_NULL(queue->cells);
+
+    volatile uint32_t * seq_p;
+    uint32_t pos = lv_atomic_load(&queue->enqueue_pos);
+    while(1) {
+        seq_p = get_cell_seq(queue, pos);
+        int32_t diff = (int32_t)(lv_atomic_load(seq_p) - pos);
+        if(diff == 0) {
+            /*The cell is free, claim the position unless an other producer was faster*/
+            if(lv_atomic_compare_exchange(&queue->enqueue_pos, pos, pos + 1)) break;
+        }
+        else if(diff < 0) {
+            /*The cell still holds the item pushed one round earlier*/
+            return LV_RESULT_INVALID;
+        }
+
+        pos = lv_atomic_load(&queue->enqueue_pos);
+    }
+
+    lv_memcpy((uint8_t *)seq_p + CELL_HEADER_SIZE, item, queue->item_size);
+
+    /*Publish the item for the consumer*/
+    lv_atomic_store(seq_p, pos + 1);
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_mpsc_queue_pop(lv_mpsc_queue_t * queue, void * item)
+{
+    uint32_t pos = queue->dequeue_pos;
+    volatile uint32_t * seq_p = get_cell_seq(queue, pos);
+    if(lv_atomic_load(seq_p) != pos + 1) return LV_RESULT_INVALID;
+
+    lv_memcpy(item, (uint8_t *)seq_p + CELL_HEADER_SIZE, queue->item_size);
+
+    /*Free the cell for the push one round later*/
+    lv_atomic_store(seq_p, pos + queue->mask + 1);
+    queue->dequeue_pos = pos + 1;
+
+    return LV_RESULT_OK;
+}
+
+void * lv_mpsc_queue_peek(lv_mpsc_queue_t * queue, uint32_t index)
+{
+    if(queue->cells == NULL || index > queue->mask) return NULL;
+
+    uint32_t pos = queue->dequeue_pos + index;
+    volatile uint32_t * seq_p = get_cell_seq(queue, pos);
+    if(lv_atomic_load(seq_p) != pos + 1) return NULL;
+
+    return (uint8_t *)seq_p + CELL_HEADER_SIZE;
+}
+
+uint32_t lv_mpsc_queue_get_count(lv_mpsc_queue_t * queue)
+{
+    return lv_atomic_load(&queue->enqueue_pos) - queue->dequeue_pos;
+}
+
+uint32_t lv_mpsc_queue_get_capacity(const lv_mpsc_queue_t * queue)
+{
+    return queue->mask + 1;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline volatile uint32_t * get_cell_seq(lv_mpsc_queue_t * queue, uint32_t pos)
+{
+    return (volatile uint32_t *)(queue->cells + (pos & queue->mask) * queue->cell_size);
+}
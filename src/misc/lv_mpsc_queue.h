@@ -0,0 +1,107 @@
+/**
+ * @file lv_mpsc_queue.h
+ * Bounded multi-producer single-consumer queue of fixed-size items.
+ * Any thread or interrupt can push without taking the LVGL lock,
+ * and only one thread (typically the one calling `lv_timer_handler()`) pops.
+ */
+
+#ifndef LV_MPSC_QUEUE_H
+#define LV_MPSC_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_types.h"
+#include "lv_atomic.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Description of a multi-producer single-consumer queue*/
+struct _lv_mpsc_queue_t {
+    uint8_t * cells;                /**< Each cell is a sequence number followed by an item*/
+    uint32_t item_size;             /**< Size of an item in bytes*/
+    uint32_t cell_size;             /**< Size of a cell in bytes, aligned*/
+    uint32_t mask;                  /**< Number of cells - 1, the number of cells is a power of 2*/
+    volatile uint32_t enqueue_pos;  /**< Position of the next push, shared by the producers*/
+    uint32_t dequeue_pos;           /**< Position of the next pop, used only by the consumer*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a queue and allocate its cells.
+ * @param queue         pointer to an `lv_mpsc_queue_t` variable to initialize
+ * @param item_size     size of an item in bytes
+ * @param capacity      number of items the queue can store, rounded up to a power of 2
+ * @return              LV_RESULT_OK: success; LV_RESULT_INVALID: out of memory
+ */
+lv_result_t lv_mpsc_queue_init(lv_mpsc_queue_t * queue, uint32_t item_size, uint32_t capacity);
+
+/**
+ * Free the cells of a queue. The items still in the queue are dropped.
+ * @param queue     pointer to a queue
+ */
+void lv_mpsc_queue_deinit(lv_mpsc_queue_t * queue);
+
+/**
+ * Copy an item to the end of the queue. Can be called from any thread or interrupt.
+ * @param queue     pointer to a queue
+ * @param item      pointer to the item to copy
+ * @return          LV_RESULT_OK: the item was added; LV_RESULT_INVALID: the queue is full
+ */
+lv_result_t lv_mpsc_queue_push(lv_mpsc_queue_t * queue, const void * item);
+
+/**
+ * Copy the first item of the queue and remove it. Only one thread can call it.
+ * @param queue     pointer to a queue
+ * @param item      pointer to a buffer to copy the item to
+ * @return          LV_RESULT_OK: an item was copied; LV_RESULT_INVALID: the queue is empty
+ *                  or the first item is still being written
+ */
+lv_result_t lv_mpsc_queue_pop(lv_mpsc_queue_t * queue, void * item);
+
+/**
+ * Get an item of the queue without removing it. Only the consumer thread can call it,
+ * and the item remains valid until it's popped.
+ * @param queue     pointer to a queue
+ * @param index     index of the item from the first one
+ * @return          pointer to the item or NULL if there is no such item or it's still being written
+ */
+void * lv_mpsc_queue_peek(lv_mpsc_queue_t * queue, uint32_t index);
+
+/**
+ * Get the number of items in the queue. The producers might change it any time,
+ * so it's only an estimate.
+ * @param queue     pointer to a queue
+ * @return          number of items
+ */
+uint32_t lv_mpsc_queue_get_count(lv_mpsc_queue_t * queue);
+
+/**
+ * Get the number of items the queue can store.
+ * @param queue     pointer to a queue
+ * @return          the capacity
+ */
+uint32_t lv_mpsc_queue_get_capacity(const lv_mpsc_queue_t * queue);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MPSC_QUEUE_H*/
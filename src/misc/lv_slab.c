@@ -0,0 +1,226 @@
+/**
+ * @file lv_slab.c
+ * Slab allocator for fixed-size items. The items are packed into chunks
+ * allocated by the 'lv_mem' module, and a chunk is freed when it becomes empty.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_slab.h"
+#include "lv_math.h"
+#include "lv_assert.h"
+#include "lv_log.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+#include "../stdlib/lv_sprintf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CHUNK_HEADER_SIZE   LV_ALIGN_UP(sizeof(lv_slab_chunk_t), 8)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_slab_chunk_t {
+    lv_slab_chunk_t * prev;     /**< Previous chunk in the list of chunks with free items*/
+    lv_slab_chunk_t * next;     /**< Next chunk in the list of chunks with free items*/
+    void * free_items;          /**< Linked list of the free items, the link is stored in the item*/
+    uint32_t used_cnt;          /**< Number of allocated items in this chunk*/
+};
+
+/**Stored before every item to find its chunk in O(1) when it's freed.
+ *Keeps the items 8 byte aligned on 32 bit targets too.*/
+typedef union {
+    lv_slab_chunk_t * chunk;
+    uint64_t align;
+} item_header_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_slab_chunk_t * chunk_create(lv_slab_t * slab);
+static void chunk_delete(lv_slab_t * slab, lv_slab_chunk_t * chunk);
+static void avail_add(lv_slab_t * slab, lv_slab_chunk_t * chunk);
+static void avail_remove(lv_slab_t * slab, lv_slab_chunk_t * chunk);
+static uint32_t get_stride(const lv_slab_t * slab);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_slab_init(lv_slab_t * slab, uint32_t item_size, uint32_t chunk_item_cnt)
+{
+    lv_memzero(slab, sizeof(lv_slab_t));
+
+    /*A free item stores the link to the next free item*/
+    item_size = LV_MAX(item_size, sizeof(void *));
+    slab->item_size = LV_ALIGN_UP(item_size, 8);
+    slab->chunk_item_cnt = LV_MAX(chunk_item_cnt, 1);
+}
+
+void lv_slab_deinit(lv_slab_t * slab)
+{
+    if(slab->used_cnt) {
+        LV_LOG_WARN("%" LV_PRIu32 " items are still allocated", slab->used_cnt);
+    }
+
+    lv_slab_chunk_t * chunk = slab->avail;
+    while(chunk) {
+        lv_slab_chunk_t * next = chunk->next;
+        if(chunk->used_cnt == 0) chunk_delete(slab, chunk);
+        chunk = next;
+    }
+
+    slab->reserved_cnt = 0;
+}
+
+void * lv_slab_alloc(lv_slab_t * slab)
+{
+    lv_slab_chunk_t * chunk = slab->avail;
+    if(chunk == NULL) {
+        chunk = chunk_create(slab);
+        if(chunk == NULL) return NULL;
+    }
+
+    void * item = chunk->free_items;
+    chunk->free_items = *(void **)item;
+    chunk->used_cnt++;
+    if(chunk->free_items == NULL) avail_remove(slab, chunk);
+
+    slab->used_cnt++;
+    slab->max_used_cnt = LV_MAX(slab->max_used_cnt, slab->used_cnt);
+
+    lv_memzero(item, slab->item_size);
+    return item;
+}
+
+void lv_slab_free(lv_slab_t * slab, void * item)
+{
+    if(item == NULL) return;
+
+    item_header_t * header = (item_header_t *)((uint8_t *)item - sizeof(item_header_t));
+    lv_slab_chunk_t * chunk = header->chunk;
+    LV_ASSERT_NULL(chunk);
+
+    /*The chunk was full so it wasn't in the list of available chunks*/
+    if(chunk->free_items == NULL) avail_add(slab, chunk);
+
+    *(void **)item = chunk->free_items;
+    chunk->free_items = item;
+    chunk->used_cnt--;
+    slab->used_cnt--;
+
+    /*Give the memory back to the heap as soon as possible to reduce fragmentation
+     *but keep the last chunk to not allocate it again if an item is allocated and freed repeatedly*/
+    if(chunk->used_cnt == 0 && slab->chunk_cnt > 1 && slab->total_cnt - slab->chunk_item_cnt >= slab->reserved_cnt) {
+        chunk_delete(slab, chunk);
+    }
+}
+
+void lv_slab_reserve(lv_slab_t * slab, uint32_t cnt)
+{
+    slab->reserved_cnt = cnt;
+
+    while(slab->total_cnt < cnt) {
+        if(chunk_create(slab) == NULL) break;
+    }
+
+    lv_slab_reclaim(slab);
+}
+
+void lv_slab_reclaim(lv_slab_t * slab)
+{
+    lv_slab_chunk_t * chunk = slab->avail;
+    while(chunk) {
+        lv_slab_chunk_t * next = chunk->next;
+        if(chunk->used_cnt == 0 && slab->total_cnt - slab->chunk_item_cnt >= slab->reserved_cnt) {
+            chunk_delete(slab, chunk);
+        }
+        chunk = next;
+    }
+}
+
+void lv_slab_monitor(const lv_slab_t * slab, lv_slab_monitor_t * mon_p)
+{
+    lv_memzero(mon_p, sizeof(lv_slab_monitor_t));
+    mon_p->item_size = slab->item_size;
+    mon_p->used_cnt = slab->used_cnt;
+    mon_p->total_cnt = slab->total_cnt;
+    mon_p->max_used_cnt = slab->max_used_cnt;
+    mon_p->chunk_cnt = slab->chunk_cnt;
+    mon_p->total_size = slab->chunk_cnt * (CHUNK_HEADER_SIZE + slab->chunk_item_cnt * get_stride(slab));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_slab_chunk_t * chunk_create(lv_slab_t * slab)
+{
+    uint32_t stride = get_stride(slab);
+    lv_slab_chunk_t * chunk = lv_malloc(CHUNK_HEADER_SIZE + slab->chunk_item_cnt * stride);
+    LV_ASSERT_MALLOC(chunk);
+    if(chunk == NULL) return NULL;
+
+    chunk->used_cnt = 0;
+    chunk->free_items = NULL;
+
+    /*Link the items in reverse order so that they are allocated in increasing address order*/
+    uint8_t * items = (uint8_t *)chunk + CHUNK_HEADER_SIZE;
+    int32_t i;
+    for(i = (int32_t)slab->chunk_item_cnt - 1; i >= 0; i--) {
+        item_header_t * header = (item_header_t *)(items + i * stride);
+        header->chunk = chunk;
+        void * item = (uint8_t *)header + sizeof(item_header_t);
+        *(void **)item = chunk->free_items;
+        chunk->free_items = item;
+    }
+
+    avail_add(slab, chunk);
+    slab->total_cnt += slab->chunk_item_cnt;
+    slab->chunk_cnt++;
+
+    return chunk;
+}
+
+static void chunk_delete(lv_slab_t * slab, lv_slab_chunk_t * chunk)
+{
+    avail_remove(slab, chunk);
+    slab->total_cnt -= slab->chunk_item_cnt;
+    slab->chunk_cnt--;
+    lv_free(chunk);
+}
+
+static void avail_add(lv_slab_t * slab, lv_slab_chunk_t * chunk)
+{
+    chunk->prev = NULL;
+    chunk->next = slab->avail;
+    if(slab->avail) slab->avail->prev = chunk;
+    slab->avail = chunk;
+}
+
+static void avail_remove(lv_slab_t * slab, lv_slab_chunk_t * chunk)
+{
+    if(chunk->prev) chunk->prev->next = chunk->next;
+    else slab->avail = chunk->next;
+    if(chunk->next) chunk->next->prev = chunk->prev;
+
+    chunk->prev = NULL;
+    chunk->next = NULL;
+}
+
+static uint32_t get_stride(const lv_slab_t * slab)
+{
+    return sizeof(item_header_t) + slab->item_size;
+}
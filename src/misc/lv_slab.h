@@ -0,0 +1,115 @@
+/**
+ * @file lv_slab.h
+ * Slab allocator for fixed-size items. The items are packed into chunks
+ * allocated by the 'lv_mem' module, and a chunk is freed when it becomes empty.
+ */
+
+#ifndef LV_SLAB_H
+#define LV_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_slab_chunk_t lv_slab_chunk_t;
+
+/** Description of a slab allocator*/
+struct _lv_slab_t {
+    lv_slab_chunk_t * avail;    /**< Chunks with at least one free item*/
+    uint32_t item_size;         /**< Size of an item in bytes, aligned*/
+    uint32_t chunk_item_cnt;    /**< Number of items in a chunk*/
+    uint32_t reserved_cnt;      /**< Keep empty chunks to store this many items*/
+    uint32_t used_cnt;          /**< Number of allocated items*/
+    uint32_t total_cnt;         /**< Number of items in all chunks*/
+    uint32_t max_used_cnt;      /**< The highest `used_cnt` so far*/
+    uint32_t chunk_cnt;         /**< Number of chunks*/
+};
+
+/** Usage statistics of a slab allocator*/
+typedef struct {
+    uint32_t item_size;         /**< Size of an item in bytes*/
+    uint32_t used_cnt;          /**< Number of allocated items*/
+    uint32_t total_cnt;         /**< Number of items the allocated chunks can store*/
+    uint32_t max_used_cnt;      /**< The highest number of allocated items so far*/
+    uint32_t chunk_cnt;         /**< Number of allocated chunks*/
+    uint32_t total_size;        /**< Memory used by the chunks in bytes*/
+} lv_slab_monitor_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Init a slab allocator. No memory is allocated until the first item is allocated.
+ * @param slab              pointer to an `lv_slab_t` variable to initialize
+ * @param item_size         size of an item in bytes
+ * @param chunk_item_cnt    number of items to allocate at once in a chunk
+ */
+void lv_slab_init(lv_slab_t * slab, uint32_t item_size, uint32_t chunk_item_cnt);
+
+/**
+ * Free the empty chunks of a slab allocator.
+ * All items have to be freed before this call, else the chunks holding them are leaked.
+ * @param slab      pointer to an `lv_slab_t` variable
+ */
+void lv_slab_deinit(lv_slab_t * slab);
+
+/**
+ * Allocate a zeroed item.
+ * @param slab      pointer to an `lv_slab_t` variable
+ * @return          pointer to the item or NULL if out of memory
+ */
+void * lv_slab_alloc(lv_slab_t * slab);
+
+/**
+ * Free an item allocated by `lv_slab_alloc()` of the same slab.
+ * Free its chunk too if it became empty, it's not the last chunk
+ * and it's not needed for the reserved items.
+ * @param slab      pointer to an `lv_slab_t` variable
+ * @param item      pointer to an item, can be NULL
+ */
+void lv_slab_free(lv_slab_t * slab, void * item);
+
+/**
+ * Allocate chunks in advance to store at least `cnt` items,
+ * and keep them even if they become empty. Free the empty chunks above it.
+ * @param slab      pointer to an `lv_slab_t` variable
+ * @param cnt       number of items to reserve space for. 0: release the reservation
+ */
+void lv_slab_reserve(lv_slab_t * slab, uint32_t cnt);
+
+/**
+ * Free all empty chunks which are not needed for the reserved items.
+ * @param slab      pointer to an `lv_slab_t` variable
+ */
+void lv_slab_reclaim(lv_slab_t * slab);
+
+/**
+ * Get the usage statistics of a slab allocator.
+ * @param slab      pointer to an `lv_slab_t` variable
+ * @param mon_p     pointer to a `lv_slab_monitor_t` variable to fill
+ */
+void lv_slab_monitor(const lv_slab_t * slab, lv_slab_monitor_t * mon_p);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_SLAB_H*/
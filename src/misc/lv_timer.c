@@ -6,7 +6,9 @@
  *      INCLUDES
  *********************/
 #include "lv_timer_private.h"
+#include "lv_async_private.h"
 #include "../core/lv_global.h"
+#include "../others/observer/lv_observer_private.h"
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_sprintf.h"
@@ -82,6 +84,15 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
 
     uint32_t handler_start = lv_tick_get();
 
+#if LV_USE_OBSERVER && LV_OBSERVER_POST_QUEUE_SIZE
+    /*Apply the values posted to the subjects by other threads*/
+    lv_subject_apply_posts();
+#endif
+
+#if LV_ASYNC_QUEUE_SIZE
+    bool async_pending = lv_async_queue_run();
+#endif
+
     if(handler_start == 0) {
         state.run_cnt++;
         if(state.run_cnt > 100) {
@@ -128,6 +139,11 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
     }
 
+#if LV_ASYNC_QUEUE_SIZE
+    /*Run the rest of the async calls as soon as possible*/
+    if(async_pending) time_until_next = 0;
+#endif
+
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
     if(idle_period_time >= IDLE_MEAS_PERIOD) {
@@ -104,6 +104,7 @@ typedef struct _lv_display_t lv_display_t;
 typedef struct _lv_layer_t lv_layer_t;
 typedef struct _lv_draw_unit_t lv_draw_unit_t;
 typedef struct _lv_draw_task_t lv_draw_task_t;
+typedef struct _lv_draw_recorder_t lv_draw_recorder_t;
 
 typedef struct _lv_indev_t lv_indev_t;
 
@@ -167,6 +168,10 @@ typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
 
 typedef struct _lv_obj_spec_attr_t lv_obj_spec_attr_t;
 
+typedef struct _lv_obj_draw_cache_t lv_obj_draw_cache_t;
+
+typedef struct _lv_obj_layer_cache_t lv_obj_layer_cache_t;
+
 typedef struct _lv_image_t lv_image_t;
 
 typedef struct _lv_animimg_t lv_animimg_t;
@@ -251,6 +256,8 @@ typedef struct _lv_win_t lv_win_t;
 
 typedef struct _lv_observer_t lv_observer_t;
 
+typedef struct _lv_subject_t lv_subject_t;
+
 typedef struct _lv_monkey_config_t lv_monkey_config_t;
 
 typedef struct _lv_ime_pinyin_t lv_ime_pinyin_t;
@@ -324,6 +331,10 @@ typedef uint32_t lv_prop_id_t;
 
 typedef struct _lv_array_t lv_array_t;
 
+typedef struct _lv_slab_t lv_slab_t;
+
+typedef struct _lv_mpsc_queue_t lv_mpsc_queue_t;
+
 typedef struct _lv_iter_t lv_iter_t;
 
 typedef struct _lv_circle_buf_t lv_circle_buf_t;
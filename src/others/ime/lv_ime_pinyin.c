@@ -33,15 +33,18 @@ static void lv_ime_pinyin_kb_event(lv_event_t * e);
 static void lv_ime_pinyin_cand_panel_event(lv_event_t * e);
 
 static void init_pinyin_dict(lv_obj_t * obj, const lv_pinyin_dict_t * dict);
+static void release_pinyin_trie(lv_ime_pinyin_t * pinyin_ime);
+static uint32_t get_dict_entry_cnt(const lv_pinyin_dict_t * dict);
 static void pinyin_input_proc(lv_obj_t * obj);
 static void pinyin_page_proc(lv_obj_t * obj, uint16_t btn);
 static char * pinyin_search_matching(lv_obj_t * obj, char * py_str, uint16_t * cand_num);
 static void pinyin_ime_clear_data(lv_obj_t * obj);
+static uint32_t pinyin_trie_find(lv_ime_pinyin_t * pinyin_ime, const char * py_str);
+static uint32_t pinyin_trie_find_child(const lv_ime_pinyin_trie_node_t * trie, uint32_t node, char letter);
 
 #if LV_IME_PINYIN_USE_K9_MODE
     static void pinyin_k9_init_data(lv_obj_t * obj);
     static void pinyin_k9_get_legal_py(lv_obj_t * obj, char * k9_input, const char * py9_map[]);
-    static bool pinyin_k9_is_valid_py(lv_obj_t * obj, char * py_str);
     static void pinyin_k9_fill_cand(lv_obj_t * obj);
     static void pinyin_k9_cand_page_proc(lv_obj_t * obj, uint16_t dir);
 #endif
@@ -445,6 +448,17 @@ void lv_ime_pinyin_set_dict(lv_obj_t * obj, lv_pinyin_dict_t * dict)
     init_pinyin_dict(obj, dict);
 }
 
+void lv_ime_pinyin_set_dict_with_trie(lv_obj_t * obj, const lv_pinyin_dict_t * dict,
+                                      const lv_ime_pinyin_trie_node_t * trie)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_ime_pinyin_t * pinyin_ime = (lv_ime_pinyin_t *)obj;
+
+    release_pinyin_trie(pinyin_ime);
+    pinyin_ime->dict = dict;
+    pinyin_ime->trie = dict ? trie : NULL;
+}
+
 void lv_ime_pinyin_set_mode(lv_obj_t * obj, lv_ime_pinyin_mode_t mode)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -499,6 +513,63 @@ const lv_pinyin_dict_t * lv_ime_pinyin_get_dict(lv_obj_t * obj)
  * Other functions
  *====================*/
 
+uint32_t lv_ime_pinyin_get_trie_node_cnt(const lv_pinyin_dict_t * dict)
+{
+    if(dict == NULL) return 0;
+
+    /*An entry adds a node for each letter after the prefix shared with the previous entry.
+     *The prefix can be shared with an earlier entry too if the entries are not sorted.*/
+    uint32_t entry_cnt = get_dict_entry_cnt(dict);
+    uint32_t node_cnt = 1;
+    const char * prev_py = "";
+    uint32_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        const char * py = dict[i].py;
+        const char * p = prev_py;
+        while(*py != '\0' && *py == *p) {
+            py++;
+            p++;
+        }
+        node_cnt += lv_strlen(py);
+        prev_py = dict[i].py;
+    }
+
+    return node_cnt;
+}
+
+uint32_t lv_ime_pinyin_build_trie(const lv_pinyin_dict_t * dict, lv_ime_pinyin_trie_node_t * trie)
+{
+    LV_ASSERT_NULL(trie);
+    if(dict == NULL) return 0;
+
+    uint32_t entry_cnt = get_dict_entry_cnt(dict);
+
+    lv_memzero(&trie[0], sizeof(lv_ime_pinyin_trie_node_t));
+    uint32_t node_cnt = 1;
+
+    uint32_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        uint32_t node = 0;
+        const char * py;
+        for(py = dict[i].py; *py != '\0'; py++) {
+            uint32_t child = pinyin_trie_find_child(trie, node, *py);
+            if(child == 0) {
+                /*The entries are added in order so the first entry reaching a node comes first*/
+                child = node_cnt;
+                node_cnt++;
+                trie[child].child = 0;
+                trie[child].sibling = trie[node].child;
+                trie[child].entry = (uint16_t)i;
+                trie[child].letter = *py;
+                trie[node].child = child;
+            }
+            node = child;
+        }
+    }
+
+    return node_cnt;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -534,8 +605,8 @@ static void lv_ime_pinyin_constructor(const lv_obj_class_t * class_p, lv_obj_t *
     pinyin_ime->ta_count = 0;
     pinyin_ime->cand_num = 0;
     lv_memzero(pinyin_ime->input_char, sizeof(pinyin_ime->input_char));
-    lv_memzero(pinyin_ime->py_num, sizeof(pinyin_ime->py_num));
-    lv_memzero(pinyin_ime->py_pos, sizeof(pinyin_ime->py_pos));
+    pinyin_ime->trie = NULL;
+    pinyin_ime->shared_trie = NULL;
 
     lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
 
@@ -594,6 +665,12 @@ static void lv_ime_pinyin_destructor(const lv_obj_class_t * class_p, lv_obj_t *
 
     lv_ime_pinyin_t * pinyin_ime = (lv_ime_pinyin_t *)obj;
 
+    release_pinyin_trie(pinyin_ime);
+
+#if LV_IME_PINYIN_USE_K9_MODE
+    lv_ll_clear(&pinyin_ime->k9_legal_py_ll);
+#endif
+
     if(lv_obj_is_valid(pinyin_ime->kb))
         lv_obj_delete(pinyin_ime->kb);
 
@@ -854,76 +931,135 @@ static void lv_ime_pinyin_style_change_event(lv_event_t * e)
     }
 }
 
+/**
+ * Use the shared prefix tree of a dictionary, build it if no other input method uses the dictionary.
+ * @param obj   pointer to a Pinyin input method object
+ * @param dict  pointer to a dictionary
+ */
 static void init_pinyin_dict(lv_obj_t * obj, const lv_pinyin_dict_t * dict)
 {
     lv_ime_pinyin_t * pinyin_ime = (lv_ime_pinyin_t *)obj;
 
-    char headletter = 'a';
-    uint16_t offset_sum = 0;
-    uint16_t offset_count = 0;
-    uint16_t letter_calc = 0;
-
+    release_pinyin_trie(pinyin_ime);
     pinyin_ime->dict = dict;
+    if(dict == NULL) return;
 
-    for(uint16_t i = 0; ; i++) {
-        if((NULL == (dict[i].py)) || (NULL == (dict[i].py_mb))) {
-            headletter = dict[i - 1].py[0];
-            letter_calc = headletter - 'a';
-            pinyin_ime->py_num[letter_calc] = offset_count;
-            break;
-        }
+    lv_ll_t * trie_ll = &LV_GLOBAL_DEFAULT()->ime_pinyin_trie_ll;
+    lv_ime_pinyin_shared_trie_t * shared;
+    LV_LL_READ(trie_ll, shared) {
+        if(shared->dict == dict) break;
+    }
 
-        if(headletter == (dict[i].py[0])) {
-            offset_count++;
-        }
-        else {
-            headletter = dict[i].py[0];
-            pinyin_ime->py_num[letter_calc] = offset_count;
-            letter_calc = headletter - 'a';
-            offset_sum += offset_count;
-            pinyin_ime->py_pos[letter_calc] = offset_sum;
+    if(shared == NULL) {
+        uint32_t node_cnt = lv_ime_pinyin_get_trie_node_cnt(dict);
+        lv_ime_pinyin_trie_node_t * trie = lv_malloc(node_cnt * sizeof(lv_ime_pinyin_trie_node_t));
+        LV_ASSERT_MALLOC(trie);
+        if(trie == NULL) return;
 
-            offset_count = 1;
+        shared = lv_ll_ins_head(trie_ll);
+        LV_ASSERT_MALLOC(shared);
+        if(shared == NULL) {
+            lv_free(trie);
+            return;
         }
+
+        lv_ime_pinyin_build_trie(dict, trie);
+        shared->dict = dict;
+        shared->trie = trie;
+        shared->ref_cnt = 0;
     }
+
+    shared->ref_cnt++;
+    pinyin_ime->shared_trie = shared;
+    pinyin_ime->trie = shared->trie;
+}
+
+/**
+ * Stop using the prefix tree and free it if it's shared and no other input method uses it.
+ * @param pinyin_ime    pointer to a Pinyin input method object
+ */
+static void release_pinyin_trie(lv_ime_pinyin_t * pinyin_ime)
+{
+    lv_ime_pinyin_shared_trie_t * shared = pinyin_ime->shared_trie;
+    pinyin_ime->shared_trie = NULL;
+    pinyin_ime->trie = NULL;
+    if(shared == NULL) return;
+
+    shared->ref_cnt--;
+    if(shared->ref_cnt == 0) {
+        lv_free(shared->trie);
+        lv_ll_remove(&LV_GLOBAL_DEFAULT()->ime_pinyin_trie_ll, shared);
+        lv_free(shared);
+    }
+}
+
+/**
+ * Get the number of the used entries of a dictionary.
+ * @param dict  pointer to a dictionary
+ * @return      the number of entries, the entries after the first `UINT16_MAX` are ignored
+ */
+static uint32_t get_dict_entry_cnt(const lv_pinyin_dict_t * dict)
+{
+    uint32_t entry_cnt = 0;
+    while(dict[entry_cnt].py != NULL && dict[entry_cnt].py_mb != NULL) entry_cnt++;
+
+    if(entry_cnt > UINT16_MAX) {
+        LV_LOG_WARN("only the first %d entries of the dictionary are used", UINT16_MAX);
+        entry_cnt = UINT16_MAX;
+    }
+
+    return entry_cnt;
 }
 
 static char * pinyin_search_matching(lv_obj_t * obj, char * py_str, uint16_t * cand_num)
 {
     lv_ime_pinyin_t * pinyin_ime = (lv_ime_pinyin_t *)obj;
 
-    const lv_pinyin_dict_t * cpHZ;
-    uint8_t index, len = 0, offset;
-    volatile uint8_t count = 0;
-
     if(*py_str == '\0')    return NULL;
     if(*py_str == 'i')     return NULL;
     if(*py_str == 'u')     return NULL;
     if(*py_str == 'v')     return NULL;
     if(*py_str == ' ')     return NULL;
 
-    offset = py_str[0] - 'a';
-    len = lv_strlen(py_str);
+    // the first entry starting with the input
+    uint32_t node = pinyin_trie_find(pinyin_ime, py_str);
+    if(node == 0) return NULL;
 
-    cpHZ  = &pinyin_ime->dict[pinyin_ime->py_pos[offset]];
-    count = pinyin_ime->py_num[offset];
+    const lv_pinyin_dict_t * cpHZ = &pinyin_ime->dict[pinyin_ime->trie[node].entry];
 
-    while(count--) {
-        for(index = 0; index < len; index++) {
-            if(*(py_str + index) != *((cpHZ->py) + index)) {
-                break;
-            }
-        }
+    // The Chinese character in UTF-8 encoding format is 3 bytes
+    *cand_num = lv_strlen((const char *)(cpHZ->py_mb)) / 3;
+    return (char *)(cpHZ->py_mb);
+}
 
-        // perfect match
-        if(len == 1 || index == len) {
-            // The Chinese character in UTF-8 encoding format is 3 bytes
-            * cand_num = lv_strlen((const char *)(cpHZ->py_mb)) / 3;
-            return (char *)(cpHZ->py_mb);
-        }
-        cpHZ++;
+/**
+ * Find the node of a prefix in the prefix tree
+ * @param pinyin_ime    pointer to a Pinyin input method object
+ * @param py_str        the prefix
+ * @return              index of the node or 0 if no entry starts with the prefix
+ */
+static uint32_t pinyin_trie_find(lv_ime_pinyin_t * pinyin_ime, const char * py_str)
+{
+    if(pinyin_ime->trie == NULL) return 0;
+
+    uint32_t node = 0;
+    while(*py_str != '\0') {
+        node = pinyin_trie_find_child(pinyin_ime->trie, node, *py_str);
+        if(node == 0) return 0;
+        py_str++;
     }
-    return NULL;
+
+    return node;
+}
+
+static uint32_t pinyin_trie_find_child(const lv_ime_pinyin_trie_node_t * trie, uint32_t node, char letter)
+{
+    uint32_t child;
+    for(child = trie[node].child; child != 0; child = trie[child].sibling) {
+        if(trie[child].letter == letter) return child;
+    }
+
+    return 0;
 }
 
 static void pinyin_ime_clear_data(lv_obj_t * obj)
@@ -1001,6 +1137,7 @@ static void pinyin_k9_get_legal_py(lv_obj_t * obj, char * k9_input, const char *
 
     char py_comp[LV_IME_PINYIN_K9_MAX_INPUT] = {0};
     int mark[LV_IME_PINYIN_K9_MAX_INPUT] = {0};
+    uint32_t node[LV_IME_PINYIN_K9_MAX_INPUT] = {0};
     int index = 0;
     int flag = 0;
     uint16_t count = 0;
@@ -1011,26 +1148,37 @@ static void pinyin_k9_get_legal_py(lv_obj_t * obj, char * k9_input, const char *
     ll_len = lv_ll_get_len(&pinyin_ime->k9_legal_py_ll);
     ll_index = lv_ll_get_head(&pinyin_ime->k9_legal_py_ll);
 
+    if(pinyin_ime->trie == NULL) return;
+
+    /*Walk the prefix tree with the letters of the keys so the combinations
+     *which are not a prefix in the dictionary are skipped early*/
     while(index != -1) {
         if(index == len) {
-            if(pinyin_k9_is_valid_py(obj, py_comp)) {
-                if((count >= ll_len) || (ll_len == 0)) {
-                    ll_index = lv_ll_ins_tail(&pinyin_ime->k9_legal_py_ll);
-                    lv_strcpy(ll_index->py_str, py_comp);
-                }
-                else if((count < ll_len)) {
-                    lv_strcpy(ll_index->py_str, py_comp);
-                    ll_index = lv_ll_get_next(&pinyin_ime->k9_legal_py_ll, ll_index);
-                }
-                count++;
+            if((count >= ll_len) || (ll_len == 0)) {
+                ll_index = lv_ll_ins_tail(&pinyin_ime->k9_legal_py_ll);
+                lv_strcpy(ll_index->py_str, py_comp);
+            }
+            else if((count < ll_len)) {
+                lv_strcpy(ll_index->py_str, py_comp);
+                ll_index = lv_ll_get_next(&pinyin_ime->k9_legal_py_ll, ll_index);
             }
+            count++;
             index--;
         }
         else {
             flag = mark[index];
-            if((size_t)flag < lv_strlen(py9_map[k9_input[index] - '2'])) {
-                py_comp[index] = py9_map[k9_input[index] - '2'][flag];
+            const char * letters = py9_map[k9_input[index] - '2'];
+            if((size_t)flag < lv_strlen(letters)) {
                 mark[index] = mark[index] + 1;
+
+                char letter = letters[flag];
+                if(index == 0 && (letter == 'i' || letter == 'u' || letter == 'v')) continue;
+
+                uint32_t child = pinyin_trie_find_child(pinyin_ime->trie, index == 0 ? 0 : node[index - 1], letter);
+                if(child == 0) continue;
+
+                py_comp[index] = letter;
+                node[index] = child;
                 index++;
             }
             else {
@@ -1046,42 +1194,6 @@ static void pinyin_k9_get_legal_py(lv_obj_t * obj, char * k9_input, const char *
     }
 }
 
-/*true: visible; false: not visible*/
-static bool pinyin_k9_is_valid_py(lv_obj_t * obj, char * py_str)
-{
-    lv_ime_pinyin_t * pinyin_ime = (lv_ime_pinyin_t *)obj;
-
-    const lv_pinyin_dict_t * cpHZ = NULL;
-    uint8_t index = 0, len = 0, offset = 0;
-    volatile uint8_t count = 0;
-
-    if(*py_str == '\0')    return false;
-    if(*py_str == 'i')     return false;
-    if(*py_str == 'u')     return false;
-    if(*py_str == 'v')     return false;
-
-    offset = py_str[0] - 'a';
-    len = lv_strlen(py_str);
-
-    cpHZ  = &pinyin_ime->dict[pinyin_ime->py_pos[offset]];
-    count = pinyin_ime->py_num[offset];
-
-    while(count--) {
-        for(index = 0; index < len; index++) {
-            if(*(py_str + index) != *((cpHZ->py) + index)) {
-                break;
-            }
-        }
-
-        // perfect match
-        if(len == 1 || index == len) {
-            return true;
-        }
-        cpHZ++;
-    }
-    return false;
-}
-
 static void pinyin_k9_fill_cand(lv_obj_t * obj)
 {
     uint16_t index = 0, tmp_len = 0;
@@ -38,6 +38,17 @@ typedef struct {
     const char * const py_mb;
 } lv_pinyin_dict_t;
 
+/**
+ * Node of the prefix tree of the dictionary's Pinyin strings.
+ * The root is the first node and the index 0 means "none" in the links.
+ */
+typedef struct {
+    uint32_t child;             /**< Index of the first child node, 0 if none*/
+    uint32_t sibling;           /**< Index of the next sibling node, 0 if none*/
+    uint16_t entry;             /**< Index of the first dictionary entry with the prefix of this node*/
+    char letter;                /**< The last letter of the prefix*/
+} lv_ime_pinyin_trie_node_t;
+
 /*Data of 9-key input(k9) mode*/
 typedef struct {
     char py_str[7];
@@ -67,11 +78,22 @@ void lv_ime_pinyin_set_keyboard(lv_obj_t * obj, lv_obj_t * kb);
 
 /**
  * Set the dictionary of Pinyin input method.
+ * The prefix tree of the dictionary is built once and shared by the input methods using the same dictionary.
  * @param obj  pointer to a Pinyin input method object
  * @param dict pointer to a Pinyin input method dictionary
  */
 void lv_ime_pinyin_set_dict(lv_obj_t * obj, lv_pinyin_dict_t * dict);
 
+/**
+ * Set the dictionary of Pinyin input method with its prebuilt prefix tree.
+ * Nothing is allocated so both can be constant data in ROM.
+ * @param obj  pointer to a Pinyin input method object
+ * @param dict pointer to a Pinyin input method dictionary
+ * @param trie the prefix tree of `dict` built by `lv_ime_pinyin_build_trie()`. It must be kept while in use.
+ */
+void lv_ime_pinyin_set_dict_with_trie(lv_obj_t * obj, const lv_pinyin_dict_t * dict,
+                                      const lv_ime_pinyin_trie_node_t * trie);
+
 /**
  * Set mode, 26-key input(k26) or 9-key input(k9).
  * @param obj  pointer to a Pinyin input method object
@@ -108,6 +130,23 @@ const lv_pinyin_dict_t * lv_ime_pinyin_get_dict(lv_obj_t * obj);
  * Other functions
  *====================*/
 
+/**
+ * Get the number of nodes needed for the prefix tree of a dictionary.
+ * It's exact if the entries are sorted alphabetically and an upper bound otherwise.
+ * @param dict pointer to a Pinyin input method dictionary
+ * @return     the number of nodes
+ */
+uint32_t lv_ime_pinyin_get_trie_node_cnt(const lv_pinyin_dict_t * dict);
+
+/**
+ * Build the prefix tree of a dictionary, e.g. to dump it to a constant array
+ * for `lv_ime_pinyin_set_dict_with_trie()`.
+ * @param dict pointer to a Pinyin input method dictionary
+ * @param trie buffer for `lv_ime_pinyin_get_trie_node_cnt()` nodes
+ * @return     the number of nodes used
+ */
+uint32_t lv_ime_pinyin_build_trie(const lv_pinyin_dict_t * dict, lv_ime_pinyin_trie_node_t * trie);
+
 /**********************
  *      MACROS
  **********************/
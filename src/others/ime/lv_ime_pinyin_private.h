@@ -27,12 +27,21 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/*Prefix tree built for a dictionary and shared by the input methods using it*/
+typedef struct {
+    const lv_pinyin_dict_t * dict;
+    lv_ime_pinyin_trie_node_t * trie;
+    uint32_t ref_cnt;           /* Number of input methods using the tree */
+} lv_ime_pinyin_shared_trie_t;
+
 /*Data of lv_ime_pinyin*/
 struct _lv_ime_pinyin_t {
     lv_obj_t obj;
     lv_obj_t * kb;
     lv_obj_t * cand_panel;
     const lv_pinyin_dict_t * dict;
+    const lv_ime_pinyin_trie_node_t * trie; /* Prefix tree of the dictionary, the root is the first node */
+    lv_ime_pinyin_shared_trie_t * shared_trie; /* The shared tree in use, NULL if the tree is set by the user */
     lv_ll_t k9_legal_py_ll;
     char * cand_str;            /* Candidate string */
     char   input_char[16];      /* Input box character */
@@ -45,8 +54,6 @@ struct _lv_ime_pinyin_t {
     uint16_t ta_count;          /* The number of characters entered in the text box this time */
     uint16_t cand_num;          /* Number of candidates */
     uint16_t py_page;           /* Current pinyin map pages(k26) */
-    uint16_t py_num[26];        /* Number and length of Pinyin */
-    uint16_t py_pos[26];        /* Pinyin position */
     lv_ime_pinyin_mode_t  mode; /* Set mode, 1: 26-key input(k26), 0: 9-key input(k9). Default: 1. */
 };
 
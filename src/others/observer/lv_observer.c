@@ -13,10 +13,14 @@
 #include "../../lvgl.h"
 #include "../../core/lv_obj_private.h"
 #include "../../misc/lv_event_private.h"
+#include "../../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define subject_dirty_head LV_GLOBAL_DEFAULT()->subject_dirty_head
+#define subject_dirty_tail LV_GLOBAL_DEFAULT()->subject_dirty_tail
+#define subject_post_queue LV_GLOBAL_DEFAULT()->subject_post_queue
 
 /**********************
  *      TYPEDEFS
@@ -27,9 +31,31 @@ typedef struct {
     uint32_t inv    : 1;
 } flag_and_cond_t;
 
+typedef enum {
+    NOTIFY_ALL,
+    NOTIFY_IMMEDIATE,       /**< Only the observers with the `immediate` flag*/
+    NOTIFY_DEFERRED,        /**< Only the observers without the `immediate` flag*/
+} notify_filter_t;
+
+#if LV_OBSERVER_POST_QUEUE_SIZE
+/** A value posted to a subject from an other thread*/
+typedef struct {
+    lv_subject_t * subject;         /**< NULL if a later value of the same subject was posted*/
+    lv_subject_value_t value;
+    lv_subject_type_t type;
+} subject_post_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void subject_changed(lv_subject_t * subject);
+static void subject_notify_filtered(lv_subject_t * subject, notify_filter_t filter);
+static void dirty_remove(lv_subject_t * subject);
+#if LV_OBSERVER_POST_QUEUE_SIZE
+static lv_result_t subject_post(lv_subject_t * subject, lv_subject_type_t type, lv_subject_value_t value);
+static void subject_drop_posts(lv_subject_t * subject);
+#endif
 static void unsubscribe_on_delete_cb(lv_event_t * e);
 static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject);
 static lv_observer_t * bind_to_bitfield(lv_subject_t * subject, lv_obj_t * obj, lv_observer_cb_t cb, uint32_t flag,
@@ -90,9 +116,9 @@ void lv_subject_set_int(lv_subject_t * subject, int32_t value)
         return;
     }
 
-    subject->prev_value.num = subject->value.num;
+    if(!subject->dirty) subject->prev_value.num = subject->value.num;
     subject->value.num = value;
-    lv_subject_notify(subject);
+    subject_changed(subject);
 }
 
 int32_t lv_subject_get_int(lv_subject_t * subject)
@@ -137,13 +163,13 @@ void lv_subject_copy_string(lv_subject_t * subject, const char * buf)
     }
 
     if(subject->size < 1) return;
-    if(subject->prev_value.pointer) {
+    if(subject->prev_value.pointer && !subject->dirty) {
         lv_strlcpy((char *)subject->prev_value.pointer, subject->value.pointer, subject->size);
     }
 
     lv_strlcpy((char *)subject->value.pointer, buf, subject->size);
 
-    lv_subject_notify(subject);
+    subject_changed(subject);
 
 }
 
@@ -183,9 +209,9 @@ void lv_subject_set_pointer(lv_subject_t * subject, void * ptr)
         return;
     }
 
-    subject->prev_value.pointer = subject->value.pointer;
+    if(!subject->dirty) subject->prev_value.pointer = subject->value.pointer;
     subject->value.pointer = ptr;
-    lv_subject_notify(subject);
+    subject_changed(subject);
 }
 
 const void * lv_subject_get_pointer(lv_subject_t * subject)
@@ -224,9 +250,9 @@ void lv_subject_set_color(lv_subject_t * subject, lv_color_t color)
         return;
     }
 
-    subject->prev_value.color = subject->value.color;
+    if(!subject->dirty) subject->prev_value.color = subject->value.color;
     subject->value.color = color;
-    lv_subject_notify(subject);
+    subject_changed(subject);
 }
 
 lv_color_t lv_subject_get_color(lv_subject_t * subject)
@@ -251,6 +277,7 @@ lv_color_t lv_subject_get_previous_color(lv_subject_t * subject)
 
 void lv_subject_init_group(lv_subject_t * subject, lv_subject_t * list[], uint32_t list_len)
 {
+    lv_memzero(subject, sizeof(lv_subject_t));
     subject->type = LV_SUBJECT_TYPE_GROUP;
     subject->size = list_len;
     lv_ll_init(&(subject->subs_ll), sizeof(lv_observer_t));
@@ -266,6 +293,11 @@ void lv_subject_init_group(lv_subject_t * subject, lv_subject_t * list[], uint32
 
 void lv_subject_deinit(lv_subject_t * subject)
 {
+    if(subject->dirty) dirty_remove(subject);
+#if LV_OBSERVER_POST_QUEUE_SIZE
+    subject_drop_posts(subject);
+#endif
+
     lv_observer_t * observer = lv_ll_get_head(&subject->subs_ll);
     while(observer) {
         lv_observer_t * observer_next = lv_ll_get_next(&subject->subs_ll, observer);
@@ -400,23 +432,143 @@ void lv_subject_notify(lv_subject_t * subject)
 {
     LV_ASSERT_NULL(subject);
 
-    lv_observer_t * observer;
-    LV_LL_READ(&(subject->subs_ll), observer) {
-        observer->notified = 0;
+    /*All the observers see the latest value now, no need to notify them again*/
+    if(subject->dirty) dirty_remove(subject);
+
+    subject_notify_filtered(subject, NOTIFY_ALL);
+}
+
+void lv_subject_set_deferred(lv_subject_t * subject, bool en)
+{
+    LV_ASSERT_NULL(subject);
+
+    subject->deferred = en;
+    if(en || !subject->dirty) return;
+
+    /*Deliver the pending change*/
+    dirty_remove(subject);
+    subject->notify_cnt++;
+    subject_notify_filtered(subject, NOTIFY_DEFERRED);
+}
+
+void lv_observer_set_immediate(lv_observer_t * observer, bool en)
+{
+    LV_ASSERT_NULL(observer);
+
+    observer->immediate = en;
+}
+
+uint32_t lv_subject_get_change_count(const lv_subject_t * subject)
+{
+    LV_ASSERT_NULL(subject);
+
+    return subject->change_cnt;
+}
+
+uint32_t lv_subject_get_notify_count(const lv_subject_t * subject)
+{
+    LV_ASSERT_NULL(subject);
+
+    return subject->notify_cnt;
+}
+
+void lv_subject_notify_deferred(void)
+{
+    if(subject_dirty_head == NULL) return;
+
+    LV_PROFILER_BEGIN;
+
+    /*The observers might make other subjects dirty. They are appended and notified in this cycle too.*/
+    while(subject_dirty_head) {
+        lv_subject_t * subject = subject_dirty_head;
+        dirty_remove(subject);
+        subject->notify_cnt++;
+        subject_notify_filtered(subject, NOTIFY_DEFERRED);
     }
 
-    do {
-        subject->notify_restart_query = 0;
-        LV_LL_READ(&(subject->subs_ll), observer) {
-            if(observer->cb && observer->notified == 0) {
-                observer->cb(observer, subject);
-                if(subject->notify_restart_query) break;
-                observer->notified = 1;
-            }
+    LV_PROFILER_END;
+}
+
+#if LV_OBSERVER_POST_QUEUE_SIZE
+
+lv_result_t lv_subject_post_int(lv_subject_t * subject, int32_t value)
+{
+    lv_subject_value_t v;
+    v.num = value;
+    return subject_post(subject, LV_SUBJECT_TYPE_INT, v);
+}
+
+lv_result_t lv_subject_post_pointer(lv_subject_t * subject, void * ptr)
+{
+    lv_subject_value_t v;
+    v.pointer = ptr;
+    return subject_post(subject, LV_SUBJECT_TYPE_POINTER, v);
+}
+
+lv_result_t lv_subject_post_color(lv_subject_t * subject, lv_color_t color)
+{
+    lv_subject_value_t v;
+    v.color = color;
+    return subject_post(subject, LV_SUBJECT_TYPE_COLOR, v);
+}
+
+void lv_subject_post_queue_init(void)
+{
+    lv_mpsc_queue_init(&subject_post_queue, sizeof(subject_post_t), LV_OBSERVER_POST_QUEUE_SIZE);
+}
+
+void lv_subject_post_queue_deinit(void)
+{
+    lv_mpsc_queue_deinit(&subject_post_queue);
+}
+
+void lv_subject_apply_posts(void)
+{
+    lv_mpsc_queue_t * queue = &subject_post_queue;
+
+    /*Apply only the posts available now. The producers can add more meanwhile
+     *but they will be applied in the next call.*/
+    uint32_t cnt = 0;
+    while(lv_mpsc_queue_peek(queue, cnt)) cnt++;
+    if(cnt == 0) return;
+
+    LV_PROFILER_BEGIN;
+
+    /*Going backward mark the earlier posts of the same subject as skipped*/
+    uint32_t i;
+    for(i = cnt; i > 0; i--) {
+        subject_post_t * post = lv_mpsc_queue_peek(queue, i - 1);
+        if(post->subject == NULL) continue;     /*The subject was deinitialized*/
+        if(post->subject->post_pending) post->subject = NULL;
+        else post->subject->post_pending = 1;
+    }
+
+    for(i = 0; i < cnt; i++) {
+        subject_post_t post;
+        lv_mpsc_queue_pop(queue, &post);
+        if(post.subject == NULL) continue;
+
+        post.subject->post_pending = 0;
+        switch(post.type) {
+            case LV_SUBJECT_TYPE_INT:
+                lv_subject_set_int(post.subject, post.value.num);
+                break;
+            case LV_SUBJECT_TYPE_POINTER:
+                lv_subject_set_pointer(post.subject, (void *)post.value.pointer);
+                break;
+            case LV_SUBJECT_TYPE_COLOR:
+                lv_subject_set_color(post.subject, post.value.color);
+                break;
+            default:
+                break;
         }
-    } while(subject->notify_restart_query);
+    }
+
+    LV_PROFILER_END;
 }
 
+#endif /*LV_OBSERVER_POST_QUEUE_SIZE*/
+
 lv_observer_t * lv_obj_bind_flag_if_eq(lv_obj_t * obj, lv_subject_t * subject, lv_obj_flag_t flag, int32_t ref_value)
 {
     lv_observer_t * observable = bind_to_bitfield(subject, obj, obj_flag_observer_cb, flag, ref_value, false);
@@ -552,11 +704,109 @@ void * lv_observer_get_user_data(const lv_observer_t * observer)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Called when the value of a subject was set.
+ * Notify all the observers, or if the subject is deferred only the immediate ones,
+ * and mark the subject dirty to notify the others in the next refresh cycle.
+ * @param subject   pointer to a subject
+ */
+static void subject_changed(lv_subject_t * subject)
+{
+    subject->change_cnt++;
+
+    if(!subject->deferred) {
+        subject_notify_filtered(subject, NOTIFY_ALL);
+        return;
+    }
+
+    subject_notify_filtered(subject, NOTIFY_IMMEDIATE);
+    if(subject->dirty) return;
+
+    subject->dirty = 1;
+    subject->next_dirty = NULL;
+    if(subject_dirty_tail) subject_dirty_tail->next_dirty = subject;
+    else subject_dirty_head = subject;
+    subject_dirty_tail = subject;
+
+    /*Wake up the paused refresh timers to flush the change*/
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+        disp = lv_display_get_next(disp);
+    }
+}
+
+static void subject_notify_filtered(lv_subject_t * subject, notify_filter_t filter)
+{
+    /*Mark the filtered out observers as already notified*/
+    lv_observer_t * observer;
+    LV_LL_READ(&(subject->subs_ll), observer) {
+        if(filter == NOTIFY_IMMEDIATE) observer->notified = !observer->immediate;
+        else if(filter == NOTIFY_DEFERRED) observer->notified = observer->immediate;
+        else observer->notified = 0;
+    }
+
+    do {
+        subject->notify_restart_query = 0;
+        LV_LL_READ(&(subject->subs_ll), observer) {
+            if(observer->cb && observer->notified == 0) {
+                observer->cb(observer, subject);
+                if(subject->notify_restart_query) break;
+                observer->notified = 1;
+            }
+        }
+    } while(subject->notify_restart_query);
+}
+
+static void dirty_remove(lv_subject_t * subject)
+{
+    lv_subject_t * prev = NULL;
+    lv_subject_t * s = subject_dirty_head;
+    while(s && s != subject) {
+        prev = s;
+        s = s->next_dirty;
+    }
+
+    subject->dirty = 0;
+    if(s == NULL) return;
+
+    if(prev) prev->next_dirty = subject->next_dirty;
+    else subject_dirty_head = subject->next_dirty;
+    if(subject_dirty_tail == subject) subject_dirty_tail = prev;
+    subject->next_dirty = NULL;
+}
+
+#if LV_OBSERVER_POST_QUEUE_SIZE
+static lv_result_t subject_post(lv_subject_t * subject, lv_subject_type_t type, lv_subject_value_t value)
+{
+    subject_post_t post;
+    post.subject = subject;
+    post.type = type;
+    post.value = value;
+    return lv_mpsc_queue_push(&subject_post_queue, &post);
+}
+
+/**
+ * Skip the values posted to a subject but not applied yet
+ * @param subject   pointer to a subject being deinitialized
+ */
+static void subject_drop_posts(lv_subject_t * subject)
+{
+    uint32_t i = 0;
+    subject_post_t * post;
+    while((post = lv_mpsc_queue_peek(&subject_post_queue, i)) != NULL) {
+        if(post->subject == subject) post->subject = NULL;
+        i++;
+    }
+    subject->post_pending = 0;
+}
+#endif
+
 static void group_notify_cb(lv_observer_t * observer, lv_subject_t * subject)
 {
     LV_UNUSED(subject);
     lv_subject_t * subject_group = observer->user_data;
-    lv_subject_notify(subject_group);
+    subject_changed(subject_group);
 }
 
 static void unsubscribe_on_delete_cb(lv_event_t * e)
@@ -50,15 +50,21 @@ typedef union {
 /**
  * The subject (an observable value)
  */
-typedef struct {
+struct _lv_subject_t {
     lv_ll_t subs_ll;                    /**< Subscribers*/
     uint32_t type   : 4;
     uint32_t size   : 28;               /**< Might be used to store a size related to `type`*/
     lv_subject_value_t value;           /**< Actual value*/
     lv_subject_value_t prev_value;      /**< Previous value*/
     uint32_t notify_restart_query : 1; /**< If an observer deleted start notifying from the beginning. */
+    uint32_t deferred : 1;              /**< Notify the observers only once per refresh cycle*/
+    uint32_t dirty : 1;                 /**< Changed since the last notification of the deferred observers*/
+    uint32_t post_pending : 1;          /**< Used internally to apply only the last posted value*/
+    uint32_t change_cnt;                /**< Number of times the value was set*/
+    uint32_t notify_cnt;                /**< Number of deferred notifications*/
+    lv_subject_t * next_dirty;          /**< Next subject in the list of dirty subjects*/
     void * user_data;                   /**< Additional parameter, can be used freely by the user*/
-} lv_subject_t;
+};
 
 /**
   * Callback called when the observed value changes
@@ -202,6 +208,8 @@ void lv_subject_init_group(lv_subject_t * subject, lv_subject_t * list[], uint32
  * @param subject   pointer to the subject
  * @note            objects added with `lv_subject_add_observer_obj` should be already deleted or
  *                  removed manually.
+ * @note            The values posted to the subject and not applied yet are dropped.
+ *                  The other threads shouldn't post to the subject anymore.
  */
 void lv_subject_deinit(lv_subject_t * subject);
 
@@ -288,6 +296,80 @@ void * lv_observer_get_user_data(const lv_observer_t * observer);
  */
 void lv_subject_notify(lv_subject_t * subject);
 
+/**
+ * Enable or disable the deferred notification of a subject.
+ * If enabled, setting the value notifies only the immediate observers and marks the subject dirty.
+ * The other observers are notified only once per refresh cycle, just before the layout
+ * is updated, and see only the latest value.
+ * If disabled while the subject is dirty, its observers are notified right away.
+ * @param subject       pointer to a subject
+ * @param en            true: enable deferred notification; false: notify on every change
+ * @note                the previous value is the value at the last deferred notification
+ */
+void lv_subject_set_deferred(lv_subject_t * subject, bool en);
+
+/**
+ * Notify an observer on every change even if its subject is deferred.
+ * Useful for observers which shouldn't miss any value, e.g. loggers.
+ * @param observer      pointer to an observer
+ * @param en            true: notify on every change; false: follow the subject's mode
+ */
+void lv_observer_set_immediate(lv_observer_t * observer, bool en);
+
+/**
+ * Get how many times the value of a subject was set.
+ * @param subject       pointer to a subject
+ * @return              the number of changes
+ */
+uint32_t lv_subject_get_change_count(const lv_subject_t * subject);
+
+/**
+ * Get how many times the observers of a deferred subject were notified.
+ * Compared to `lv_subject_get_change_count()` it tells how many updates were coalesced.
+ * @param subject       pointer to a subject
+ * @return              the number of deferred notifications
+ */
+uint32_t lv_subject_get_notify_count(const lv_subject_t * subject);
+
+/**
+ * Notify the observers of all the dirty deferred subjects.
+ * It's called automatically by the display refresh before the layout is updated.
+ */
+void lv_subject_notify_deferred(void);
+
+#if LV_OBSERVER_POST_QUEUE_SIZE
+
+/**
+ * Post a new value to an integer subject from any thread without taking the LVGL lock.
+ * The posted values are applied by `lv_timer_handler()` as if `lv_subject_set_int()` was called,
+ * but if a subject got more values meanwhile, only the last one is applied.
+ * @param subject   pointer to the subject, has to be valid until the value is applied
+ * @param value     the new value
+ * @return          LV_RESULT_OK: the value was posted; LV_RESULT_INVALID: the queue is full,
+ *                  see `LV_OBSERVER_POST_QUEUE_SIZE`
+ */
+lv_result_t lv_subject_post_int(lv_subject_t * subject, int32_t value);
+
+/**
+ * Post a new value to a pointer subject from any thread without taking the LVGL lock.
+ * See `lv_subject_post_int()`.
+ * @param subject   pointer to the subject, has to be valid until the value is applied
+ * @param ptr       new pointer
+ * @return          LV_RESULT_OK: the value was posted; LV_RESULT_INVALID: the queue is full
+ */
+lv_result_t lv_subject_post_pointer(lv_subject_t * subject, void * ptr);
+
+/**
+ * Post a new value to a color subject from any thread without taking the LVGL lock.
+ * See `lv_subject_post_int()`.
+ * @param subject   pointer to the subject, has to be valid until the value is applied
+ * @param color     the new color
+ * @return          LV_RESULT_OK: the value was posted; LV_RESULT_INVALID: the queue is full
+ */
+lv_result_t lv_subject_post_color(lv_subject_t * subject, lv_color_t color);
+
+#endif /*LV_OBSERVER_POST_QUEUE_SIZE*/
+
 /**
  * Set an object flag if an integer subject's value is equal to a reference value, clear the flag otherwise
  * @param obj           pointer to an object
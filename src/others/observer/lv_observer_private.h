@@ -37,6 +37,7 @@ struct _lv_observer_t {
     uint32_t auto_free_user_data : 1;   /**< Automatically free user data when the observer is removed */
     uint32_t notified : 1;              /**< Mark if this observer was already notified*/
     uint32_t for_obj : 1;               /**< `target` is an `lv_obj_t *`*/
+    uint32_t immediate : 1;             /**< Notify on every change even if the subject is deferred*/
 };
 
 
@@ -44,6 +45,25 @@ struct _lv_observer_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_OBSERVER_POST_QUEUE_SIZE
+/**
+ * Allocate the queue of the posted subject values.
+ */
+void lv_subject_post_queue_init(void);
+
+/**
+ * Free the queue of the posted subject values.
+ */
+void lv_subject_post_queue_deinit(void);
+
+/**
+ * Apply the values posted by `lv_subject_post_int()` and friends.
+ * Only the last posted value of each subject is applied.
+ * Called from `lv_timer_handler()`.
+ */
+void lv_subject_apply_posts(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -20,6 +20,9 @@
  *********************/
 #define MY_CLASS (&lv_chart_class)
 
+/*The min. and max. values are stored for blocks of 2^MINMAX_BLOCK_SHIFT points on the lowest level*/
+#define MINMAX_BLOCK_SHIFT  3
+
 #define LV_CHART_HDIV_DEF 3
 #define LV_CHART_VDIV_DEF 5
 #define LV_CHART_POINT_CNT_DEF 10
@@ -38,12 +41,21 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
 static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer);
+static void draw_series_polyline(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_line_dsc_t * line_dsc,
+                                 lv_draw_rect_dsc_t * point_dsc, const lv_area_t * clip_area);
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
 static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
+static void get_column_point_range(lv_chart_t * chart, int32_t col, int32_t w, uint32_t * id_start,
+                                   uint32_t * id_cnt);
+static void minmax_build(lv_chart_t * chart, lv_chart_series_t * ser);
+static void minmax_update(lv_chart_t * chart, lv_chart_series_t * ser, uint32_t id);
+static void minmax_invalidate_all(lv_chart_t * chart);
+static void minmax_get(lv_chart_t * chart, lv_chart_series_t * ser, uint32_t id_start, uint32_t id_end,
+                       int32_t * min, int32_t * max);
 
 /**********************
  *  STATIC VARIABLES
@@ -122,6 +134,11 @@ void lv_chart_set_point_count(lv_obj_t * obj, uint32_t cnt)
         }
         if(!ser->y_ext_buf_assigned) new_points_alloc(obj, ser, cnt, &ser->y_points);
         ser->start_point = 0;
+
+        /*The number of blocks changes so allocate them again when needed*/
+        lv_free(ser->minmax);
+        ser->minmax = NULL;
+        ser->minmax_valid = 0;
     }
 
     chart->point_cnt = cnt;
@@ -158,7 +175,7 @@ void lv_chart_set_range(lv_obj_t * obj, lv_chart_axis_t axis, int32_t min, int32
             return;
     }
 
-    lv_chart_refresh(obj);
+    lv_obj_invalidate(obj);
 }
 
 void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode)
@@ -274,9 +291,73 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The data might have been changed directly in the arrays*/
+    minmax_invalidate_all((lv_chart_t *)obj);
     lv_obj_invalidate(obj);
 }
 
+void lv_chart_set_minmax_decimation(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->minmax_decimation == en) return;
+
+    chart->minmax_decimation = en;
+    if(!en) {
+        lv_chart_series_t * ser;
+        LV_LL_READ(&chart->series_ll, ser) {
+            lv_free(ser->minmax);
+            ser->minmax = NULL;
+            ser->minmax_valid = 0;
+        }
+    }
+
+    lv_obj_invalidate(obj);
+}
+
+bool lv_chart_get_minmax_decimation(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    return chart->minmax_decimation;
+}
+
+bool lv_chart_get_min_max_value(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, uint32_t cnt,
+                                int32_t * min, int32_t * max)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(ser);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    *min = INT32_MAX;
+    *max = INT32_MIN;
+    if(id >= chart->point_cnt) return false;
+    if(cnt > chart->point_cnt - id) cnt = chart->point_cnt - id;
+    if(cnt == 0) return false;
+
+    if(chart->minmax_decimation && !ser->minmax_valid) minmax_build(chart, ser);
+
+    /*Convert to array indices. In shift mode the range can wrap around the end of the array.*/
+    uint32_t start = id;
+    if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) start = (ser->start_point + id) % chart->point_cnt;
+
+    if(start + cnt <= chart->point_cnt) {
+        minmax_get(chart, ser, start, start + cnt, min, max);
+    }
+    else {
+        int32_t min2;
+        int32_t max2;
+        minmax_get(chart, ser, start, chart->point_cnt, min, max);
+        minmax_get(chart, ser, 0, start + cnt - chart->point_cnt, &min2, &max2);
+        *min = LV_MIN(*min, min2);
+        *max = LV_MAX(*max, max2);
+    }
+
+    return *min <= *max;
+}
+
 /*======================
  * Series
  *=====================*/
@@ -351,6 +432,7 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_free(series->y_points);
     if(!series->x_ext_buf_assigned && series->x_points) lv_free(series->x_points);
+    lv_free(series->minmax);
 
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
@@ -364,7 +446,7 @@ void lv_chart_hide_series(lv_obj_t * chart, lv_chart_series_t * series, bool hid
     LV_ASSERT_NULL(series);
 
     series->hidden = hide ? 1 : 0;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 void lv_chart_set_series_color(lv_obj_t * chart, lv_chart_series_t * series, lv_color_t color)
@@ -373,7 +455,7 @@ void lv_chart_set_series_color(lv_obj_t * chart, lv_chart_series_t * series, lv_
     LV_ASSERT_NULL(series);
 
     series->color = color;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 lv_color_t lv_chart_get_series_color(lv_obj_t * chart, const lv_chart_series_t * series)
@@ -433,7 +515,7 @@ void lv_chart_set_cursor_pos(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_po
 
     cursor->pos = *pos;
     cursor->pos_set = 1;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 void lv_chart_set_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_chart_series_t * ser, uint32_t point_id)
@@ -445,7 +527,7 @@ void lv_chart_set_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_
     cursor->pos_set = 0;
     if(ser == NULL) ser = lv_chart_get_series_next(chart, NULL);
     cursor->ser = ser;
-    lv_chart_refresh(chart);
+    lv_obj_invalidate(chart);
 }
 
 lv_point_t lv_chart_get_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor)
@@ -471,7 +553,8 @@ void lv_chart_set_all_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t val
         ser->y_points[i] = value;
     }
     ser->start_point = 0;
-    lv_chart_refresh(obj);
+    ser->minmax_valid = 0;
+    lv_obj_invalidate(obj);
 }
 
 void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t value)
@@ -481,6 +564,7 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
     ser->y_points[ser->start_point] = value;
+    minmax_update(chart, ser, ser->start_point);
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
@@ -500,6 +584,7 @@ void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, int32_t x
 
     ser->x_points[ser->start_point] = x_value;
     ser->y_points[ser->start_point] = y_value;
+    minmax_update(chart, ser, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
 }
@@ -512,6 +597,7 @@ void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t
 
     if(id >= chart->point_cnt) return;
     ser->y_points[id] = value;
+    minmax_update(chart, ser, id);
     invalidate_point(obj, id);
 }
 
@@ -530,6 +616,7 @@ void lv_chart_set_value_by_id2(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t
     if(id >= chart->point_cnt) return;
     ser->x_points[id] = x_value;
     ser->y_points[id] = y_value;
+    minmax_update(chart, ser, id);
     invalidate_point(obj, id);
 }
 
@@ -541,6 +628,7 @@ void lv_chart_set_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t a
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
+    ser->minmax_valid = 0;
     lv_obj_invalidate(obj);
 }
 
@@ -641,6 +729,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_free(ser->y_points);
         if(!ser->x_ext_buf_assigned) lv_free(ser->x_points);
+        lv_free(ser->minmax);
 
         lv_ll_remove(&chart->series_ll, ser);
         lv_free(ser);
@@ -820,6 +909,15 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     if(LV_MIN(point_w, point_h) > line_dsc.width / 2) line_dsc.raw_end = 1;
     if(line_dsc.width == 1) line_dsc.raw_end = 1;
 
+    /*Draw connected polylines instead of lines one by one if the lines are not dashed and
+     *not modified one by one in draw task events*/
+    bool dashed = line_dsc.dash_width && line_dsc.dash_gap;
+    if(!dashed && !lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+        draw_series_polyline(obj, layer, &line_dsc, &point_dsc_default, &clip_area_ori);
+        layer->_clip_area = clip_area_ori;
+        return;
+    }
+
     /*If there are at least as many points as pixels then draw only vertical lines*/
     bool crowded_mode = (int32_t)chart->point_cnt >= w;
 
@@ -1054,6 +1152,190 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
     }
 }
 
+/**
+ * Draw the line series as polylines. The polylines are broken only at the `LV_CHART_POINT_NONE` points.
+ * @param obj           pointer to a chart
+ * @param layer         the layer to draw to, its clip area is already truncated to the chart
+ * @param line_dsc      the line draw descriptor initialized from the styles of the items
+ * @param point_dsc     the draw descriptor of the points
+ * @param clip_area     the original clip area of the layer
+ */
+static void draw_series_polyline(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_line_dsc_t * line_dsc,
+                                 lv_draw_rect_dsc_t * point_dsc, const lv_area_t * clip_area)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    int32_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
+    int32_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN) + border_width;
+    int32_t w     = lv_obj_get_content_width(obj);
+    int32_t h     = lv_obj_get_content_height(obj);
+    int32_t x_ofs = obj->coords.x1 + pad_left - lv_obj_get_scroll_left(obj);
+    int32_t y_ofs = obj->coords.y1 + pad_top - lv_obj_get_scroll_top(obj);
+
+    /*Nothing is visible and the columns of the crowded mode would be divided by `w`*/
+    if(w <= 0) return;
+
+    int32_t point_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR) / 2;
+    int32_t point_h = lv_obj_get_style_height(obj, LV_PART_INDICATOR) / 2;
+
+    /*If there are at least as many points as pixels then keep only the min and max values on each x*/
+    bool crowded_mode = (int32_t)chart->point_cnt >= w;
+
+    /*In crowded mode there are max. 2 points on each x*/
+    uint32_t points_size = crowded_mode ? (uint32_t)(w + 1) * 2 : chart->point_cnt;
+    lv_point_precise_t * points = lv_malloc(sizeof(lv_point_precise_t) * points_size);
+    LV_ASSERT_MALLOC(points);
+    if(points == NULL) return;
+
+    lv_draw_polyline_dsc_t polyline_dsc;
+    lv_draw_polyline_dsc_init(&polyline_dsc);
+    polyline_dsc.base = line_dsc->base;
+    polyline_dsc.base.dsc_size = sizeof(lv_draw_polyline_dsc_t);
+    polyline_dsc.width = line_dsc->width;
+    polyline_dsc.opa = line_dsc->opa;
+    polyline_dsc.blend_mode = line_dsc->blend_mode;
+    polyline_dsc.round_start = line_dsc->round_start;
+    polyline_dsc.round_end = line_dsc->round_end;
+    polyline_dsc.points = points;
+
+    /*The points cover the line endings if they are large enough*/
+    if(LV_MIN(point_w, point_h) > line_dsc->width / 2) {
+        polyline_dsc.round_start = 0;
+        polyline_dsc.round_end = 0;
+    }
+
+    polyline_dsc.base.id1 = lv_ll_get_len(&chart->series_ll) - 1;
+    point_dsc->base.id1 = polyline_dsc.base.id1;
+
+    lv_chart_series_t * ser;
+    LV_LL_READ_BACK(&chart->series_ll, ser) {
+        if(ser->hidden) {
+            polyline_dsc.base.id1--;
+            point_dsc->base.id1--;
+            continue;
+        }
+        polyline_dsc.color = ser->color;
+        point_dsc->bg_color = ser->color;
+
+        int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+        int32_t y_range = chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec];
+        uint32_t point_cnt = 0;
+
+        if(crowded_mode) {
+            /*Draw the min. and max. values of the points on each visible pixel column*/
+            int32_t col_margin = line_dsc->width + 1;
+            int32_t col_first = LV_MAX(clip_area->x1 - x_ofs - col_margin, 0);
+            int32_t col_last = LV_MIN(clip_area->x2 - x_ofs + col_margin, w);
+            int32_t col;
+            for(col = col_first; col <= col_last + 1; col++) {
+                uint32_t id_start = 0;
+                uint32_t id_cnt = 0;
+                int32_t v_min = 0;
+                int32_t v_max = 0;
+                bool has_value = false;
+                if(col <= col_last) {
+                    get_column_point_range(chart, col, w, &id_start, &id_cnt);
+                    if(id_cnt == 0) continue;
+                    has_value = lv_chart_get_min_max_value(obj, ser, id_start, id_cnt, &v_min, &v_max);
+                }
+
+                /*Draw the collected points when a gap or the end of the visible part is reached*/
+                if(!has_value) {
+                    if(point_cnt >= 2) {
+                        polyline_dsc.point_cnt = point_cnt;
+                        lv_draw_polyline(layer, &polyline_dsc);
+                    }
+                    point_cnt = 0;
+                    continue;
+                }
+
+                int32_t y_top = h - ((v_max - chart->ymin[ser->y_axis_sec]) * h) / y_range + y_ofs;
+                int32_t y_bottom = h - ((v_min - chart->ymin[ser->y_axis_sec]) * h) / y_range + y_ofs;
+
+                /*Start with the end closer to the previous column to not cross the line*/
+                if(point_cnt > 0 && LV_ABS(points[point_cnt - 1].y - y_bottom) < LV_ABS(points[point_cnt - 1].y - y_top)) {
+                    int32_t y_tmp = y_top;
+                    y_top = y_bottom;
+                    y_bottom = y_tmp;
+                }
+
+                points[point_cnt].x = col + x_ofs;
+                points[point_cnt].y = y_top;
+                point_cnt++;
+                if(y_bottom != y_top) {
+                    points[point_cnt].x = col + x_ofs;
+                    points[point_cnt].y = y_bottom;
+                    point_cnt++;
+                }
+            }
+
+            polyline_dsc.base.id1--;
+            point_dsc->base.id1--;
+            continue;
+        }
+
+        int32_t x_prev = LV_COORD_MIN;
+
+        uint32_t i;
+        for(i = 0; i <= chart->point_cnt; i++) {
+            int32_t p_act = (start_point + i) % chart->point_cnt;
+            int32_t x = (w * i) / (chart->point_cnt - 1) + x_ofs;
+
+            /*Draw the collected points when a gap or the end of the visible part is reached*/
+            bool last = i == chart->point_cnt || x_prev > clip_area->x2 + point_w + 1;
+            if(last || ser->y_points[p_act] == LV_CHART_POINT_NONE) {
+                if(point_cnt >= 2) {
+                    polyline_dsc.point_cnt = point_cnt;
+                    lv_draw_polyline(layer, &polyline_dsc);
+                }
+                point_cnt = 0;
+                if(last) break;
+                continue;
+            }
+
+            int32_t y_tmp = (int32_t)((int32_t)ser->y_points[p_act] - chart->ymin[ser->y_axis_sec]) * h;
+            int32_t y = h - y_tmp / y_range + y_ofs;
+
+            /*Start from the last point before the visible part*/
+            if(x < clip_area->x1 - point_w - 1) point_cnt = 0;
+
+            points[point_cnt].x = x;
+            points[point_cnt].y = y;
+            point_cnt++;
+            x_prev = x;
+        }
+
+        /*Draw the points on top of the lines*/
+        if(point_w && point_h) {
+            for(i = 0; i < chart->point_cnt; i++) {
+                int32_t p_act = (start_point + i) % chart->point_cnt;
+                if(ser->y_points[p_act] == LV_CHART_POINT_NONE) continue;
+
+                int32_t x = (w * i) / (chart->point_cnt - 1) + x_ofs;
+                if(x < clip_area->x1 - point_w - 1) continue;
+                if(x > clip_area->x2 + point_w + 1) break;
+
+                int32_t y_tmp = (int32_t)((int32_t)ser->y_points[p_act] - chart->ymin[ser->y_axis_sec]) * h;
+                int32_t y = h - y_tmp / y_range + y_ofs;
+
+                lv_area_t point_area;
+                point_area.x1 = x - point_w;
+                point_area.x2 = x + point_w;
+                point_area.y1 = y - point_h;
+                point_area.y2 = y + point_h;
+                point_dsc->base.id2 = i;
+                lv_draw_rect(layer, point_dsc, &point_area);
+            }
+        }
+
+        polyline_dsc.base.id1--;
+        point_dsc->base.id1--;
+    }
+
+    lv_free(points);
+}
+
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer)
 {
     lv_area_t clip_area;
@@ -1357,4 +1639,225 @@ static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t c
     }
 }
 
+/**
+ * Get the range of point indices drawn on a pixel column of a crowded line chart
+ * @param chart     pointer to a chart
+ * @param col       the pixel column relative to the content area
+ * @param w         the width of the content area
+ * @param id_start  store the index of the first point here
+ * @param id_cnt    store the number of points here. Can be 0 if there are no points on the column.
+ */
+static void get_column_point_range(lv_chart_t * chart, int32_t col, int32_t w, uint32_t * id_start,
+                                   uint32_t * id_cnt)
+{
+    /*Point `i` is drawn on the `(w * i) / (point_cnt - 1)` column*/
+    int64_t last_id = chart->point_cnt - 1;
+    int64_t start = ((int64_t)col * last_id + w - 1) / w;
+    int64_t end = ((int64_t)(col + 1) * last_id + w - 1) / w;
+    if(end > (int64_t)chart->point_cnt) end = chart->point_cnt;
+    if(start > end) start = end;
+
+    *id_start = (uint32_t)start;
+    *id_cnt = (uint32_t)(end - start);
+}
+
+/**
+ * Get the number of blocks on a level of the min. max. pyramid
+ * @param point_cnt     number of points
+ * @param level         the level. Level 0 has the smallest blocks
+ * @return              the number of blocks
+ */
+static uint32_t minmax_get_block_cnt(uint32_t point_cnt, uint32_t level)
+{
+    uint32_t shift = MINMAX_BLOCK_SHIFT + level;
+    return (uint32_t)(((uint64_t)point_cnt + (1ULL << shift) - 1) >> shift);
+}
+
+/**
+ * Get the min. and max. value of the points in a block on the lowest level
+ * @param chart     pointer to a chart
+ * @param ser       pointer to a series
+ * @param block     index of the block
+ * @param minmax    store the min. and max. values here
+ */
+static void minmax_calc_block(lv_chart_t * chart, lv_chart_series_t * ser, uint32_t block, int32_t * minmax)
+{
+    uint32_t id = block << MINMAX_BLOCK_SHIFT;
+    uint32_t id_end = LV_MIN(id + (1 << MINMAX_BLOCK_SHIFT), chart->point_cnt);
+    int32_t min = INT32_MAX;
+    int32_t max = INT32_MIN;
+    for(; id < id_end; id++) {
+        int32_t v = ser->y_points[id];
+        if(v == LV_CHART_POINT_NONE) continue;
+        if(v < min) min = v;
+        if(v > max) max = v;
+    }
+    minmax[0] = min;
+    minmax[1] = max;
+}
+
+/**
+ * Build the min. max. pyramid of a series. The blocks of each level store the min. and max.
+ * of two blocks of the level below, so the min. and max. of any range can be found in O(log n) time.
+ * The blocks are indexed by the array indices, so appending to the ring buffer
+ * updates only the blocks of the new point.
+ * @param chart     pointer to a chart
+ * @param ser       pointer to a series
+ */
+static void minmax_build(lv_chart_t * chart, lv_chart_series_t * ser)
+{
+    LV_PROFILER_BEGIN;
+
+    uint32_t block_cnt_sum = 0;
+    uint32_t level = 0;
+    uint32_t block_cnt;
+    do {
+        block_cnt = minmax_get_block_cnt(chart->point_cnt, level);
+        block_cnt_sum += block_cnt;
+        level++;
+    } while(block_cnt > 1);
+
+    if(ser->minmax == NULL) {
+        ser->minmax = lv_malloc(block_cnt_sum * 2 * sizeof(int32_t));
+        LV_ASSERT_MALLOC(ser->minmax);
+        if(ser->minmax == NULL) {
+            LV_PROFILER_END;
+            return;
+        }
+    }
+
+    int32_t * minmax = ser->minmax;
+    block_cnt = minmax_get_block_cnt(chart->point_cnt, 0);
+    uint32_t i;
+    for(i = 0; i < block_cnt; i++) {
+        minmax_calc_block(chart, ser, i, &minmax[i * 2]);
+    }
+
+    level = 1;
+    while(block_cnt > 1) {
+        int32_t * lower = minmax;
+        uint32_t lower_cnt = block_cnt;
+        minmax += block_cnt * 2;
+        block_cnt = minmax_get_block_cnt(chart->point_cnt, level);
+        for(i = 0; i < block_cnt; i++) {
+            int32_t * child = &lower[i * 4];
+            bool has_second = i * 2 + 1 < lower_cnt;
+            minmax[i * 2] = has_second ? LV_MIN(child[0], child[2]) : child[0];
+            minmax[i * 2 + 1] = has_second ? LV_MAX(child[1], child[3]) : child[1];
+        }
+        level++;
+    }
+
+    ser->minmax_valid = 1;
+
+    LV_PROFILER_END;
+}
+
+/**
+ * Update the min. max. pyramid of a series after a point was changed
+ * @param chart     pointer to a chart
+ * @param ser       pointer to a series
+ * @param id        the array index of the changed point
+ */
+static void minmax_update(lv_chart_t * chart, lv_chart_series_t * ser, uint32_t id)
+{
+    if(!ser->minmax_valid) return;
+
+    int32_t * minmax = ser->minmax;
+    uint32_t block = id >> MINMAX_BLOCK_SHIFT;
+    uint32_t block_cnt = minmax_get_block_cnt(chart->point_cnt, 0);
+    minmax_calc_block(chart, ser, block, &minmax[block * 2]);
+
+    uint32_t level = 1;
+    while(block_cnt > 1) {
+        int32_t * lower = minmax;
+        uint32_t lower_cnt = block_cnt;
+        minmax += block_cnt * 2;
+        block_cnt = minmax_get_block_cnt(chart->point_cnt, level);
+        block >>= 1;
+
+        int32_t * child = &lower[block * 4];
+        bool has_second = block * 2 + 1 < lower_cnt;
+        minmax[block * 2] = has_second ? LV_MIN(child[0], child[2]) : child[0];
+        minmax[block * 2 + 1] = has_second ? LV_MAX(child[1], child[3]) : child[1];
+        level++;
+    }
+}
+
+/**
+ * Mark the min. max. pyramid of all series as outdated
+ * @param chart     pointer to a chart
+ */
+static void minmax_invalidate_all(lv_chart_t * chart)
+{
+    lv_chart_series_t * ser;
+    LV_LL_READ(&chart->series_ll, ser) {
+        ser->minmax_valid = 0;
+    }
+}
+
+/**
+ * Get the min. and max. value of a range of points. Use the min. max. pyramid if it's valid
+ * and check the points one by one otherwise.
+ * @param chart     pointer to a chart
+ * @param ser       pointer to a series
+ * @param id_start  the array index of the first point
+ * @param id_end    the array index after the last point
+ * @param min       store the min. value here. `INT32_MAX` if there are only `LV_CHART_POINT_NONE` points
+ * @param max       store the max. value here. `INT32_MIN` if there are only `LV_CHART_POINT_NONE` points
+ */
+static void minmax_get(lv_chart_t * chart, lv_chart_series_t * ser, uint32_t id_start, uint32_t id_end,
+                       int32_t * min, int32_t * max)
+{
+    *min = INT32_MAX;
+    *max = INT32_MIN;
+
+    /*Check the points one by one until the start and end are aligned to the lowest level blocks*/
+    uint32_t block_mask = (1 << MINMAX_BLOCK_SHIFT) - 1;
+    bool use_blocks = ser->minmax_valid && (id_end - id_start) > block_mask;
+    uint32_t aligned_start = use_blocks ? (id_start + block_mask) & ~block_mask : id_end;
+    uint32_t aligned_end = use_blocks ? LV_MAX(id_end & ~block_mask, aligned_start) : id_end;
+    if(id_end == chart->point_cnt) aligned_end = id_end;  /*The last block can be partial*/
+
+    uint32_t id;
+    for(id = id_start; id < aligned_start; id++) {
+        int32_t v = ser->y_points[id];
+        if(v == LV_CHART_POINT_NONE) continue;
+        if(v < *min) *min = v;
+        if(v > *max) *max = v;
+    }
+    for(id = aligned_end; id < id_end; id++) {
+        int32_t v = ser->y_points[id];
+        if(v == LV_CHART_POINT_NONE) continue;
+        if(v < *min) *min = v;
+        if(v > *max) *max = v;
+    }
+
+    if(aligned_start >= aligned_end) return;
+
+    /*Go up on the levels and use the largest blocks which are fully in the range*/
+    uint32_t lo = aligned_start >> MINMAX_BLOCK_SHIFT;
+    uint32_t hi = (aligned_end + block_mask) >> MINMAX_BLOCK_SHIFT;
+    int32_t * minmax = ser->minmax;
+    uint32_t level = 0;
+    uint32_t block_cnt = minmax_get_block_cnt(chart->point_cnt, 0);
+    while(lo < hi) {
+        if(lo & 1) {
+            *min = LV_MIN(*min, minmax[lo * 2]);
+            *max = LV_MAX(*max, minmax[lo * 2 + 1]);
+            lo++;
+        }
+        if(hi & 1) {
+            hi--;
+            *min = LV_MIN(*min, minmax[hi * 2]);
+            *max = LV_MAX(*max, minmax[hi * 2 + 1]);
+        }
+        lo >>= 1;
+        hi >>= 1;
+        minmax += block_cnt * 2;
+        level++;
+        block_cnt = minmax_get_block_cnt(chart->point_cnt, level);
+    }
+}
+
 #endif
@@ -146,6 +146,40 @@ void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint3
  */
 void lv_chart_refresh(lv_obj_t * obj);
 
+/**
+ * Keep the min. and max. values of the blocks of points up to date in a multi-level summary
+ * to find the min. and max. values of any range of points quickly.
+ * If there are more points than horizontal pixels, line charts are drawn by looking up the
+ * min. and max. values for each pixel column, so drawing takes time proportional to the width
+ * instead of the number of points. Setting a point updates only the blocks containing it.
+ * It needs about the half of the memory of the points per series.
+ * @param obj       pointer to a chart object
+ * @param en        true: enable the min. max. summary; false: disable it and free its memory
+ * @note            If the values are modified directly in the arrays, call `lv_chart_refresh()`
+ */
+void lv_chart_set_minmax_decimation(lv_obj_t * obj, bool en);
+
+/**
+ * Get whether the min. max. summary of the points is enabled
+ * @param obj       pointer to a chart object
+ * @return          true: enabled
+ */
+bool lv_chart_get_minmax_decimation(const lv_obj_t * obj);
+
+/**
+ * Get the smallest and largest value of a range of points of a series.
+ * `LV_CHART_POINT_NONE` points are ignored.
+ * @param obj       pointer to a chart object
+ * @param ser       pointer to a data series on 'chart'
+ * @param id        index of the first point in the drawing order, i.e. 0 is the left most point
+ * @param cnt       number of points to check
+ * @param min       store the smallest value here
+ * @param max       store the largest value here
+ * @return          true: there was at least one point with a value in the range
+ */
+bool lv_chart_get_min_max_value(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, uint32_t cnt,
+                                int32_t * min, int32_t * max);
+
 /*======================
  * Series
  *=====================*/
@@ -33,8 +33,10 @@ extern "C" {
 struct _lv_chart_series_t {
     int32_t * x_points;
     int32_t * y_points;
+    int32_t * minmax;           /**< Min. and max. values of blocks of `y_points` on multiple levels*/
     lv_color_t color;
     uint32_t start_point;
+    uint32_t minmax_valid : 1;  /**< 1: `minmax` is up to date*/
     uint32_t hidden : 1;
     uint32_t x_ext_buf_assigned : 1;
     uint32_t y_ext_buf_assigned : 1;
@@ -65,6 +67,7 @@ struct _lv_chart_t {
     uint32_t point_cnt;         /**< Point number in a data line*/
     lv_chart_type_t type  : 3;  /**< Line or column chart*/
     lv_chart_update_mode_t update_mode : 1;
+    uint32_t minmax_decimation : 1; /**< 1: keep the min. and max. values of the point blocks up to date*/
 };
 
 
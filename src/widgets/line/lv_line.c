@@ -31,6 +31,8 @@
 static void lv_line_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void line_set_points(lv_obj_t * obj, const lv_point_precise_t points[], uint32_t point_num, bool mut);
 static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void draw_polyline(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_line_dsc_t * line_dsc, int32_t x_ofs,
+                          int32_t y_ofs);
 
 /**********************
  *  STATIC VARIABLES
@@ -238,6 +240,13 @@ static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_draw_line_dsc_init(&line_dsc);
         lv_obj_init_draw_line_dsc(obj, LV_PART_MAIN, &line_dsc);
 
+        /*Draw the lines in one go if the lines are not dashed and not modified one by one in draw task events*/
+        bool dashed = line_dsc.dash_width && line_dsc.dash_gap;
+        if(line->point_num > 2 && !dashed && !lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+            draw_polyline(obj, layer, &line_dsc, x_ofs, y_ofs);
+            return;
+        }
+
         /*Read all points and draw the lines*/
         uint32_t i;
         for(i = 0; i < line->point_num - 1; i++) {
@@ -264,4 +273,48 @@ static void lv_line_event(const lv_obj_class_t * class_p, lv_event_t * e)
         }
     }
 }
+
+/**
+ * Draw all the points of the line as one polyline
+ * @param obj           pointer to a line
+ * @param layer         the layer to draw to
+ * @param line_dsc      the line draw descriptor initialized from the styles
+ * @param x_ofs         x offset of the points
+ * @param y_ofs         y offset of the points
+ */
+static void draw_polyline(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_line_dsc_t * line_dsc, int32_t x_ofs,
+                          int32_t y_ofs)
+{
+    lv_line_t * line = (lv_line_t *)obj;
+
+    lv_point_precise_t * points = lv_malloc(sizeof(lv_point_precise_t) * line->point_num);
+    LV_ASSERT_MALLOC(points);
+    if(points == NULL) return;
+
+    int32_t w = lv_obj_get_width(obj);
+    int32_t h = lv_obj_get_height(obj);
+    uint32_t i;
+    for(i = 0; i < line->point_num; i++) {
+        points[i].x = resolve_point_coord(line->point_array.constant[i].x, w) + x_ofs;
+        points[i].y = resolve_point_coord(line->point_array.constant[i].y, h);
+        if(line->y_inv == 0) points[i].y = points[i].y + y_ofs;
+        else points[i].y = h - points[i].y + y_ofs;
+    }
+
+    lv_draw_polyline_dsc_t polyline_dsc;
+    lv_draw_polyline_dsc_init(&polyline_dsc);
+    polyline_dsc.base = line_dsc->base;
+    polyline_dsc.base.dsc_size = sizeof(lv_draw_polyline_dsc_t);
+    polyline_dsc.color = line_dsc->color;
+    polyline_dsc.width = line_dsc->width;
+    polyline_dsc.opa = line_dsc->opa;
+    polyline_dsc.blend_mode = line_dsc->blend_mode;
+    polyline_dsc.round_start = line_dsc->round_start;
+    polyline_dsc.round_end = line_dsc->round_end;
+    polyline_dsc.points = points;
+    polyline_dsc.point_cnt = line->point_num;
+    lv_draw_polyline(layer, &polyline_dsc);
+
+    lv_free(points);
+}
 #endif
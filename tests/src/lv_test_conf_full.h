@@ -14,6 +14,17 @@
 #define LV_USE_ASSERT_STYLE             1
 #define LV_USE_FLOAT      1
 #define LV_USE_MATRIX     1
+#define LV_OBJ_DRAW_LIST_CACHE  1
+#define LV_OBJ_LAYER_CACHE_SIZE (1024 * 1024)
+#define LV_ASYNC_QUEUE_SIZE     16
+#define LV_BIN_DECODER_BAND_SIZE (16 * 1024)
+#define LV_BIN_DECODER_TILE_CACHE_CNT 8
+#define LV_DRAW_OCCLUSION_CULLING 1
+#define LV_DRAW_TILE_SIZE       (16 * 1024)
+#ifdef LV_USE_OS
+#define LV_USE_DISPLAY_RENDER_THREAD 1   /*Requires an OS*/
+#define LV_USE_IMAGE_DECODER_ASYNC 1     /*Requires an OS*/
+#endif
 
 #define LV_FONT_MONTSERRAT_8    1
 #define LV_FONT_MONTSERRAT_10   1
@@ -63,6 +74,8 @@
 #ifndef _WIN32
     #define LV_USE_FS_POSIX     1
     #define LV_FS_POSIX_LETTER  'B'
+    #define LV_USE_FS_MMAP      1
+    #define LV_FS_MMAP_LETTER   'D'
 #else
     #define LV_USE_FS_WIN32 1
     #define LV_FS_WIN32_LETTER 'C'
@@ -86,6 +99,7 @@
 #define LV_USE_IMGFONT      1
 #define LV_USE_IME_PINYIN       1
 #define LV_USE_OBSERVER         1
+#define LV_OBSERVER_POST_QUEUE_SIZE 64
 #define LV_USE_FILE_EXPLORER    1
 #define LV_USE_TINY_TTF         1
 #define LV_USE_SYSMON           1
@@ -9,4 +9,29 @@ void lv_test_wait(uint32_t ms)
     lv_refr_now(NULL);
 }
 
+static void draw_main_cnt_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+void lv_test_count_draw_main(lv_obj_t * obj, uint32_t * cnt)
+{
+    lv_obj_add_event_cb(obj, draw_main_cnt_cb, LV_EVENT_DRAW_MAIN, cnt);
+}
+
+uint32_t lv_test_draw_buf_max_diff(const lv_draw_buf_t * buf1, const lv_draw_buf_t * buf2)
+{
+    if(buf1->data_size != buf2->data_size) return UINT32_MAX;
+
+    uint32_t max_diff = 0;
+    uint32_t i;
+    for(i = 0; i < buf1->data_size; i++) {
+        uint32_t diff = (uint32_t)LV_ABS((int32_t)buf1->data[i] - buf2->data[i]);
+        max_diff = LV_MAX(max_diff, diff);
+    }
+
+    return max_diff;
+}
+
 #endif
@@ -24,4 +24,19 @@ static inline size_t lv_test_get_free_mem(void)
 
 void lv_test_wait(uint32_t ms);
 
+/**
+ * Count how many times an object is drawn
+ * @param obj   pointer to an object
+ * @param cnt   incremented on each `LV_EVENT_DRAW_MAIN` of `obj`
+ */
+void lv_test_count_draw_main(lv_obj_t * obj, uint32_t * cnt);
+
+/**
+ * Get the largest difference between the bytes of two draw buffers, e.g. snapshots
+ * @param buf1  pointer to a draw buffer
+ * @param buf2  pointer to an other draw buffer
+ * @return      the largest difference or `UINT32_MAX` if the sizes are different
+ */
+uint32_t lv_test_draw_buf_max_diff(const lv_draw_buf_t * buf1, const lv_draw_buf_t * buf2);
+
 #endif /*LV_TEST_HELPERS_H*/
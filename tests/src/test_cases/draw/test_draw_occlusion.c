@@ -0,0 +1,140 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_W    300
+#define CANVAS_H    200
+
+static lv_obj_t * canvas;
+static lv_draw_buf_t * canvas_buf;
+static lv_draw_buf_t * ref_buf;
+
+/*The draw tasks of a canvas layer are dispatched only in `lv_canvas_finish_layer()`,
+ *so all the draw tasks are added before any of them could be taken by a draw unit*/
+static void render(bool with_panel, int32_t x1, int32_t y1, int32_t x2, int32_t y2, lv_opa_t opa, int32_t radius)
+{
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    if(with_panel) {
+        lv_draw_rect_dsc_t panel_dsc;
+        lv_draw_rect_dsc_init(&panel_dsc);
+        panel_dsc.bg_color = lv_color_hex(0xe0e0e0);
+        panel_dsc.border_color = lv_color_hex(0x808080);
+        panel_dsc.border_width = 2;
+        panel_dsc.radius = 8;
+        lv_area_t panel_area = {50, 50, 249, 149};
+        lv_draw_rect(&layer, &panel_dsc, &panel_area);
+
+        lv_draw_label_dsc_t label_dsc;
+        lv_draw_label_dsc_init(&label_dsc);
+        label_dsc.text = "Covered text";
+        lv_area_t label_area = {100, 90, 199, 109};
+        lv_draw_label(&layer, &label_dsc, &label_area);
+    }
+
+    lv_draw_rect_dsc_t cover_dsc;
+    lv_draw_rect_dsc_init(&cover_dsc);
+    cover_dsc.bg_color = lv_color_hex(0x3060a0);
+    cover_dsc.bg_opa = opa;
+    cover_dsc.radius = radius;
+    lv_area_t cover_area = {x1, y1, x2, y2};
+    lv_draw_rect(&layer, &cover_dsc, &cover_area);
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+/*Render without the panel to the reference buffer and with the panel to the canvas*/
+static void render_both(int32_t x1, int32_t y1, int32_t x2, int32_t y2, lv_opa_t opa, int32_t radius)
+{
+    render(false, x1, y1, x2, y2, opa, radius);
+    lv_draw_buf_copy(ref_buf, NULL, canvas_buf, NULL);
+
+    lv_draw_occlusion_monitor_reset();
+    render(true, x1, y1, x2, y2, opa, radius);
+}
+
+/*Compare only the pixels as the padding at the end of the lines is not rendered*/
+static bool rows_equal(int32_t y1, int32_t y2)
+{
+    int32_t y;
+    for(y = y1; y <= y2; y++) {
+        if(lv_memcmp(lv_draw_buf_goto_xy(ref_buf, 0, y), lv_draw_buf_goto_xy(canvas_buf, 0, y), CANVAS_W * 4) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void setUp(void)
+{
+    canvas_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888, 0);
+    ref_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888, 0);
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, canvas_buf);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_draw_buf_destroy(canvas_buf);
+    lv_draw_buf_destroy(ref_buf);
+}
+
+void test_draw_occlusion_cull_covered(void)
+{
+    render_both(40, 40, 259, 159, LV_OPA_COVER, 0);
+
+    lv_draw_occlusion_monitor_t mon;
+    lv_draw_occlusion_monitor(&mon);
+    TEST_ASSERT_GREATER_THAN(0, mon.culled_task_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(200 * 100, mon.saved_px_cnt);
+
+    /*The result is the same as without the covered panel*/
+    TEST_ASSERT_TRUE(rows_equal(0, CANVAS_H - 1));
+}
+
+void test_draw_occlusion_clip_partially_covered(void)
+{
+    /*Covers the bottom half of the panel on its whole width*/
+    render_both(40, 100, 259, 199, LV_OPA_COVER, 0);
+
+    lv_draw_occlusion_monitor_t mon;
+    lv_draw_occlusion_monitor(&mon);
+    TEST_ASSERT_GREATER_THAN(0, mon.clipped_task_cnt);
+    TEST_ASSERT_GREATER_THAN(0, mon.saved_px_cnt);
+
+    /*The visible top half is drawn normally*/
+    TEST_ASSERT_FALSE(rows_equal(0, 99));
+    TEST_ASSERT_TRUE(rows_equal(100, CANVAS_H - 1));
+}
+
+void test_draw_occlusion_translucent_cover(void)
+{
+    lv_draw_occlusion_monitor_reset();
+    render(true, 40, 40, 259, 159, LV_OPA_50, 0);
+
+    lv_draw_occlusion_monitor_t mon;
+    lv_draw_occlusion_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.culled_task_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.clipped_task_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.saved_px_cnt);
+}
+
+void test_draw_occlusion_rounded_cover(void)
+{
+    render_both(50, 50, 249, 149, LV_OPA_COVER, 20);
+
+    /*The label is covered but the corners of the panel are visible*/
+    lv_draw_occlusion_monitor_t mon;
+    lv_draw_occlusion_monitor(&mon);
+    TEST_ASSERT_GREATER_THAN(0, mon.culled_task_cnt);
+
+    TEST_ASSERT_FALSE(rows_equal(0, CANVAS_H - 1));
+}
+
+#endif
@@ -0,0 +1,153 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static const lv_point_precise_t zigzag[] = {
+    {20, 60}, {60, 20}, {100, 60}, {140, 20}, {180, 60}, {190, 20}, {200, 60}
+};
+
+static void draw_event_cb(lv_event_t * e)
+{
+    lv_layer_t * layer = lv_event_get_layer(e);
+
+    lv_draw_polyline_dsc_t dsc;
+    lv_draw_polyline_dsc_init(&dsc);
+    dsc.points = zigzag;
+    dsc.point_cnt = sizeof(zigzag) / sizeof(zigzag[0]);
+
+    static const int32_t widths[] = {1, 4, 12};
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_point_precise_t points[sizeof(zigzag) / sizeof(zigzag[0])];
+        uint32_t p;
+        for(p = 0; p < dsc.point_cnt; p++) {
+            points[p].x = zigzag[p].x;
+            points[p].y = zigzag[p].y + i * 80;
+        }
+
+        /*Butt caps on the left, round caps on the right*/
+        dsc.points = points;
+        dsc.width = widths[i];
+        dsc.color = lv_palette_main(LV_PALETTE_BLUE);
+        dsc.round_start = 0;
+        dsc.round_end = 0;
+        lv_draw_polyline(layer, &dsc);
+
+        for(p = 0; p < dsc.point_cnt; p++) points[p].x += 220;
+        dsc.color = lv_palette_main(LV_PALETTE_RED);
+        dsc.opa = LV_OPA_50;
+        dsc.round_start = 1;
+        dsc.round_end = 1;
+        lv_draw_polyline(layer, &dsc);
+        dsc.opa = LV_OPA_COVER;
+    }
+
+    /*Leaves the screen and comes back, only the visible parts are rendered*/
+    static const lv_point_precise_t clipped[] = {{500, 300}, {900, 350}, {700, 600}, {600, 400}, {780, 420}};
+    dsc.points = clipped;
+    dsc.point_cnt = sizeof(clipped) / sizeof(clipped[0]);
+    dsc.width = 8;
+    dsc.color = lv_palette_main(LV_PALETTE_GREEN);
+    lv_draw_polyline(layer, &dsc);
+
+    /*Too few points to draw anything*/
+    dsc.point_cnt = 1;
+    lv_draw_polyline(layer, &dsc);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_draw_polyline(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
+    lv_obj_add_event_cb(obj, draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/polyline_1.png");
+}
+
+void test_draw_polyline_chart(void)
+{
+    /*More points than pixels, the lines are reduced to the min. and max. values on each column*/
+    lv_obj_t * chart = lv_chart_create(lv_screen_active());
+    lv_obj_set_size(chart, 380, 200);
+    lv_obj_set_pos(chart, 10, 10);
+    lv_chart_set_point_count(chart, 2000);
+    lv_obj_set_style_size(chart, 0, 0, LV_PART_INDICATOR);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_PRIMARY_Y);
+    uint32_t i;
+    for(i = 0; i < 2000; i++) {
+        lv_chart_set_next_value(chart, ser, (int32_t)((i * 37) % 50 + (i / 40)));
+    }
+
+    /*Some gaps break the lines*/
+    chart = lv_chart_create(lv_screen_active());
+    lv_obj_set_size(chart, 380, 200);
+    lv_obj_set_pos(chart, 410, 10);
+    lv_chart_set_point_count(chart, 20);
+    ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+    for(i = 0; i < 20; i++) {
+        lv_chart_set_next_value(chart, ser, i % 7 == 3 ? LV_CHART_POINT_NONE : (int32_t)((i * 29) % 100));
+    }
+
+    /*Wide chart scrolled on its parent, only the visible points are drawn*/
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 780, 240);
+    lv_obj_set_pos(cont, 10, 230);
+    chart = lv_chart_create(cont);
+    lv_obj_set_size(chart, 3000, LV_PCT(100));
+    lv_obj_set_style_line_width(chart, 6, LV_PART_ITEMS);
+    lv_chart_set_point_count(chart, 50);
+    ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_GREEN), LV_CHART_AXIS_PRIMARY_Y);
+    for(i = 0; i < 50; i++) {
+        lv_chart_set_next_value(chart, ser, (int32_t)((i * 41) % 100));
+    }
+    lv_obj_update_layout(cont);
+    lv_obj_scroll_to_x(cont, 1000, LV_ANIM_OFF);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/polyline_chart_1.png");
+}
+
+void test_draw_polyline_dsc_compare(void)
+{
+    lv_point_precise_t points[3] = {{10, 10}, {50, 40}, {90, 10}};
+    lv_draw_polyline_dsc_t dsc;
+    lv_draw_polyline_dsc_init(&dsc);
+    dsc.points = points;
+    dsc.point_cnt = 3;
+    dsc.width = 4;
+
+    lv_draw_polyline_dsc_t * clone = lv_draw_polyline_dsc_clone(&dsc);
+    TEST_ASSERT_NOT_NULL(clone);
+    TEST_ASSERT_NOT_EQUAL(points, clone->points);
+    TEST_ASSERT_EQUAL_INT32(0, lv_draw_polyline_dsc_compare(&dsc, clone));
+
+    /*The points are changed at the same address*/
+    points[1].y = 60;
+    TEST_ASSERT_NOT_EQUAL_INT32(0, lv_draw_polyline_dsc_compare(&dsc, clone));
+    TEST_ASSERT_EQUAL_INT32(40, clone->points[1].y);
+
+    points[1].y = 40;
+    TEST_ASSERT_EQUAL_INT32(0, lv_draw_polyline_dsc_compare(&dsc, clone));
+
+    dsc.point_cnt = 2;
+    TEST_ASSERT_NOT_EQUAL_INT32(0, lv_draw_polyline_dsc_compare(&dsc, clone));
+
+    dsc.point_cnt = 3;
+    dsc.width = 5;
+    TEST_ASSERT_NOT_EQUAL_INT32(0, lv_draw_polyline_dsc_compare(&dsc, clone));
+
+    lv_free(clone);
+}
+
+#endif
@@ -295,6 +295,50 @@ void test_rotate270_L8(void)
     TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedArray, dstArray, sizeof(dstArray));
 }
 
+static void rotate_large(lv_color_format_t cf)
+{
+    /*Not a multiple of the block size to test the partial blocks too*/
+    const int32_t w = 53;
+    const int32_t h = 37;
+    const uint32_t px_size = lv_color_format_get_size(cf);
+    const int32_t src_stride = (w + 5) * px_size;
+    const int32_t dst_stride = (h + 3) * px_size;
+
+    uint8_t * src = lv_malloc(src_stride * h);
+    uint8_t * rotated = lv_malloc_zeroed(dst_stride * w);
+    uint8_t * back = lv_malloc_zeroed(src_stride * h);
+    uint32_t i;
+    for(i = 0; i < (uint32_t)(src_stride * h); i++) src[i] = (uint8_t)(i * 7 + i / 251);
+
+    lv_draw_sw_rotate(src, rotated, w, h, src_stride, dst_stride, LV_DISPLAY_ROTATION_90, cf);
+
+    /*The top right pixel is the top left after rotating with 90 degrees*/
+    int32_t x, y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(&src[y * src_stride + x * px_size],
+                                          &rotated[(w - x - 1) * dst_stride + y * px_size], px_size);
+        }
+    }
+
+    lv_draw_sw_rotate(rotated, back, h, w, dst_stride, src_stride, LV_DISPLAY_ROTATION_270, cf);
+    for(y = 0; y < h; y++) {
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(&src[y * src_stride], &back[y * src_stride], w * px_size);
+    }
+
+    lv_free(src);
+    lv_free(rotated);
+    lv_free(back);
+}
+
+void test_rotate_large(void)
+{
+    rotate_large(LV_COLOR_FORMAT_L8);
+    rotate_large(LV_COLOR_FORMAT_RGB565);
+    rotate_large(LV_COLOR_FORMAT_RGB888);
+    rotate_large(LV_COLOR_FORMAT_ARGB8888);
+}
+
 void test_invert(void)
 {
     uint8_t expected_buf[10] = {0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xf9, 0xf8, 0xf7, 0xf6};
@@ -0,0 +1,137 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t task_added_cnt;
+
+static void draw_task_added_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    task_added_cnt++;
+}
+
+static int32_t idle_dispatch_cb(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
+{
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(layer);
+    return LV_DRAW_UNIT_IDLE;
+}
+
+static lv_obj_t * create_scene(void)
+{
+    lv_obj_t * panel = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(panel, 300, 200);
+    lv_obj_center(panel);
+    lv_obj_set_style_bg_grad_color(panel, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_dir(panel, LV_GRAD_DIR_VER, 0);
+    lv_obj_set_style_shadow_width(panel, 30, 0);
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(panel, draw_task_added_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+
+    lv_obj_t * label = lv_label_create(panel);
+    lv_label_set_text(label, "Rendered in tiles\nacross the tile borders");
+    lv_obj_center(label);
+    lv_obj_add_flag(label, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(label, draw_task_added_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+
+    lv_obj_t * arc = lv_arc_create(lv_screen_active());
+    lv_obj_set_pos(arc, 20, 20);
+
+    return arc;
+}
+
+static lv_draw_buf_t * render_screen(uint32_t tile_cnt)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_display_set_tile_cnt(disp, tile_cnt);
+
+    task_added_cnt = 0;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+
+    return lv_draw_buf_dup(lv_display_get_buf_active(disp));
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_display_set_tile_cnt(lv_display_get_default(), 1);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_draw_tiles_same_result(void)
+{
+    create_scene();
+
+    lv_draw_buf_t * ref = render_screen(1);
+    uint32_t ref_task_added_cnt = task_added_cnt;
+    lv_draw_buf_t * tiled = render_screen(4);
+
+    TEST_ASSERT_EQUAL_MEMORY(ref->data, tiled->data, ref->data_size);
+
+    /*The widgets were drawn only once and the draw tasks were replayed on the tiles*/
+    TEST_ASSERT_EQUAL_UINT32(ref_task_added_cnt, task_added_cnt);
+
+    lv_draw_buf_destroy(ref);
+    lv_draw_buf_destroy(tiled);
+}
+
+void test_draw_tiles_layer_fallback(void)
+{
+    lv_obj_t * arc = create_scene();
+
+    /*Layers can't be recorded so the widgets are drawn on each tile*/
+    lv_obj_set_style_opa_layered(arc, LV_OPA_70, 0);
+
+    lv_draw_buf_t * ref = render_screen(1);
+    uint32_t ref_task_added_cnt = task_added_cnt;
+    lv_draw_buf_t * tiled = render_screen(4);
+
+    TEST_ASSERT_EQUAL_MEMORY(ref->data, tiled->data, ref->data_size);
+    TEST_ASSERT_GREATER_THAN_UINT32(ref_task_added_cnt, task_added_cnt);
+
+    lv_draw_buf_destroy(ref);
+    lv_draw_buf_destroy(tiled);
+}
+
+void test_draw_tiles_first_task_covers_the_tile(void)
+{
+    /*The draw tasks are checked one by one only with more draw units.
+     *Keep it the last test as the draw unit can't be removed.*/
+    lv_draw_unit_t * unit = lv_draw_create_unit(sizeof(lv_draw_unit_t));
+    unit->dispatch_cb = idle_dispatch_cb;
+
+    /*A tile sharing a larger buffer, as created by the tiled rendering*/
+    lv_area_t buf_area = {0, 0, 99, 99};
+    lv_area_t tile_area = {0, 0, 49, 99};
+    lv_layer_t tile;
+    lv_memzero(&tile, sizeof(tile));
+    tile.buf_area = buf_area;
+    tile._clip_area = tile_area;
+    tile.phy_clip_area = tile_area;
+
+    lv_draw_task_t * t1 = lv_draw_add_task(&tile, &tile_area);
+    t1->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+
+    /*It doesn't overlap the first task, so only the shortcut can skip it*/
+    lv_area_t other_area = {60, 0, 99, 99};
+    lv_draw_task_t * t2 = lv_draw_add_task(&tile, &other_area);
+    t2->clip_area = other_area;
+
+    /*The first task covers the whole tile, so nothing else is checked*/
+    TEST_ASSERT_NULL(lv_draw_get_next_available_task(&tile, NULL, LV_DRAW_UNIT_NONE));
+
+    /*If the first task doesn't cover the tile the others are checked*/
+    t1->_real_area.x2 = 29;
+    TEST_ASSERT_EQUAL_PTR(t2, lv_draw_get_next_available_task(&tile, NULL, LV_DRAW_UNIT_NONE));
+
+    lv_free(t1);
+    lv_free(t2);
+}
+
+#endif
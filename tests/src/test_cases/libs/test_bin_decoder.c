@@ -89,4 +89,177 @@ void test_bin_decoder_argb8888_tile(void)
     bin_decoder_tile(&test_image_cogwheel_argb8888, "libs/bin_decoder_4.png");
 }
 
+static lv_draw_buf_t * snapshot_image(const char * src, int32_t x, int32_t y)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, src);
+    lv_obj_set_pos(img, x, y);
+
+    lv_draw_buf_t * snapshot = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot);
+    lv_obj_clean(lv_screen_active());
+
+    return snapshot;
+}
+
+/*Convert a bin image file to the tiled layout, the same way as LVGLImage.py --tile does*/
+static void create_tiled_file(const char * src, const char * src_tiled, uint16_t tile_w, uint16_t tile_h)
+{
+    lv_fs_file_t f;
+    lv_image_header_t header;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, src, LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, &header, sizeof(header), NULL));
+    /*The test files use the legacy header without magic and stride*/
+    if(header.magic != LV_IMAGE_HEADER_MAGIC) {
+        header.cf = header.magic;
+        header.magic = LV_IMAGE_HEADER_MAGIC;
+    }
+    if(header.stride == 0) header.stride = header.w * lv_color_format_get_bpp(header.cf) / 8;
+    uint32_t data_size = header.stride * header.h;
+    uint8_t * data = lv_malloc(data_size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, data, data_size, NULL));
+    lv_fs_close(&f);
+
+    uint32_t px_size = lv_color_format_get_bpp(header.cf) / 8;
+    uint32_t tile_stride = tile_w * px_size;
+    uint8_t * tile_line = lv_malloc(tile_stride);
+    lv_image_tile_header_t tile_header = {tile_w, tile_h};
+
+    header.flags |= LV_IMAGE_FLAGS_TILED;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, src_tiled, LV_FS_MODE_WR));
+    lv_fs_write(&f, &header, sizeof(header), NULL);
+    lv_fs_write(&f, &tile_header, sizeof(tile_header), NULL);
+    for(uint32_t tile_y = 0; tile_y < header.h; tile_y += tile_h) {
+        for(uint32_t tile_x = 0; tile_x < header.w; tile_x += tile_w) {
+            uint32_t w = LV_MIN(tile_w, header.w - tile_x);
+            for(uint32_t y = tile_y; y < tile_y + tile_h; y++) {
+                lv_memzero(tile_line, tile_stride);
+                if(y < header.h) lv_memcpy(tile_line, data + y * header.stride + tile_x * px_size, w * px_size);
+                lv_fs_write(&f, tile_line, tile_stride, NULL);
+            }
+        }
+    }
+    lv_fs_close(&f);
+
+    lv_free(tile_line);
+    lv_free(data);
+}
+
+static void bin_decoder_tiled(const char * src, const char * src_tiled)
+{
+    /*Whole image and only a part of it at various tile offsets*/
+    static const lv_point_t pos[] = {{10, 10}, {-41, -27}, {-5, 250}};
+
+    create_tiled_file(src, src_tiled, 32, 24);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(pos) / sizeof(pos[0]); i++) {
+        lv_draw_buf_t * expected = snapshot_image(src, pos[i].x, pos[i].y);
+        lv_draw_buf_t * tiled = snapshot_image(src_tiled, pos[i].x, pos[i].y);
+        TEST_ASSERT_EQUAL_MEMORY(expected->data, tiled->data, expected->data_size);
+        lv_draw_buf_destroy(expected);
+        lv_draw_buf_destroy(tiled);
+    }
+}
+
+void test_bin_decoder_tiled_argb8888(void)
+{
+    bin_decoder_tiled("A:src/test_files/binimages/cogwheel.ARGB8888.bin",
+                      "A:src/test_files/binimages/cogwheel.ARGB8888.tiled.bin");
+}
+
+void test_bin_decoder_tiled_rgb565(void)
+{
+    bin_decoder_tiled("A:src/test_files/binimages/cogwheel.RGB565.bin",
+                      "A:src/test_files/binimages/cogwheel.RGB565.tiled.bin");
+}
+
+/*The lines and tiles decoded by parts have the stride of the draw buffers*/
+static void bin_decoder_get_area_stride(const char * src)
+{
+    lv_image_decoder_dsc_t dsc;
+    lv_image_decoder_args_t args = {0};
+    args.no_cache = true;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src, &args));
+
+    /*With `LV_BIN_DECODER_RAM_LOAD` the whole image is decoded too*/
+    const lv_draw_buf_t * whole = dsc.decoded;
+
+    lv_area_t full_area = {3, 5, 50, 40};
+    lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+    uint32_t cnt = 0;
+    while(lv_image_decoder_get_area(&dsc, &full_area, &decoded_area) == LV_RESULT_OK) {
+        const lv_draw_buf_t * decoded = dsc.decoded;
+        TEST_ASSERT_EQUAL_UINT32(0, decoded->header.stride % LV_DRAW_BUF_STRIDE_ALIGN);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(lv_draw_buf_width_to_stride(decoded->header.w, decoded->header.cf),
+                                            decoded->header.stride);
+
+        if(whole) {
+            uint32_t line_len = decoded->header.w * lv_color_format_get_bpp(decoded->header.cf) / 8;
+            int32_t y;
+            for(y = 0; y < (int32_t)decoded->header.h; y++) {
+                TEST_ASSERT_EQUAL_MEMORY(lv_draw_buf_goto_xy(whole, decoded_area.x1, decoded_area.y1 + y),
+                                         lv_draw_buf_goto_xy(decoded, 0, y), line_len);
+            }
+        }
+        cnt++;
+    }
+    TEST_ASSERT_GREATER_THAN(0, cnt);
+    lv_image_decoder_close(&dsc);
+}
+
+void test_bin_decoder_get_area_stride(void)
+{
+    create_tiled_file("A:src/test_files/binimages/cogwheel.ARGB8888.bin",
+                      "A:src/test_files/binimages/cogwheel.ARGB8888.tiled.bin", 32, 24);
+
+    bin_decoder_get_area_stride("A:src/test_files/binimages/cogwheel.ARGB8888.bin");
+    bin_decoder_get_area_stride("A:src/test_files/binimages/cogwheel.ARGB8888.tiled.bin");
+    bin_decoder_get_area_stride("A:src/test_files/binimages/cogwheel.RGB565.bin");
+}
+
+#if LV_USE_FS_MMAP
+void test_bin_decoder_mmap(void)
+{
+    static const char * const srcs[] = {
+        "src/test_files/binimages/cogwheel.ARGB8888.bin",
+        "src/test_files/binimages/cogwheel.XRGB8888.bin",
+        "src/test_files/binimages/cogwheel.RGB565.bin",
+        "src/test_files/binimages/cogwheel.RGB565A8.bin",
+    };
+
+    uint32_t i;
+    for(i = 0; i < sizeof(srcs) / sizeof(srcs[0]); i++) {
+        char src_read[128];
+        char src_mmap[128];
+        lv_snprintf(src_read, sizeof(src_read), "A:%s", srcs[i]);
+        lv_snprintf(src_mmap, sizeof(src_mmap), "D:%s", srcs[i]);
+
+        /*The pixels are used from the mapped file and the file stays mapped while the image is cached*/
+        lv_image_decoder_dsc_t dsc;
+        lv_image_decoder_args_t args = {0};
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src_mmap, &args));
+        TEST_ASSERT_NOT_NULL(dsc.decoded);
+        TEST_ASSERT_NOT_NULL(dsc.cache_entry);
+        TEST_ASSERT_FALSE(lv_draw_buf_has_flag(dsc.decoded, LV_IMAGE_FLAGS_MODIFIABLE));
+        TEST_ASSERT_FALSE(lv_draw_buf_has_flag(dsc.decoded, LV_IMAGE_FLAGS_ALLOCATED));
+        const lv_draw_buf_t * mapped_buf = dsc.decoded;
+        lv_image_decoder_close(&dsc);
+
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, src_mmap, &args));
+        TEST_ASSERT_EQUAL_PTR(mapped_buf, dsc.decoded);
+        lv_image_decoder_close(&dsc);
+
+        /*Unmapped when it's evicted*/
+        lv_image_cache_drop(src_mmap);
+
+        lv_draw_buf_t * expected = snapshot_image(src_read, 10, 10);
+        lv_draw_buf_t * mapped = snapshot_image(src_mmap, 10, 10);
+        TEST_ASSERT_EQUAL_MEMORY(expected->data, mapped->data, expected->data_size);
+        lv_draw_buf_destroy(expected);
+        lv_draw_buf_destroy(mapped);
+    }
+}
+#endif
+
 #endif
@@ -0,0 +1,144 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_ASYNC_QUEUE_SIZE
+
+#if LV_USE_OS == LV_OS_PTHREAD
+#include <sched.h>
+#endif
+
+static uint32_t call_cnt;
+static uint32_t call_sum;
+
+static void async_cb(void * user_data)
+{
+    call_cnt++;
+    call_sum += (uint32_t)(uintptr_t)user_data;
+}
+
+static void repost_cb(void * user_data)
+{
+    call_cnt++;
+    lv_async_call(repost_cb, user_data);
+}
+
+void setUp(void)
+{
+    call_cnt = 0;
+    call_sum = 0;
+}
+
+void tearDown(void)
+{
+    lv_async_call_cancel(repost_cb, NULL);
+    lv_timer_handler();
+}
+
+void test_async_call_queue(void)
+{
+    lv_async_stat_t stat_ori;
+    lv_async_get_stat(&stat_ori);
+
+    uint32_t i;
+    for(i = 1; i <= 3; i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_async_call(async_cb, (void *)(uintptr_t)i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, call_cnt);
+
+    /*Cancel only the matching call*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_async_call_cancel(async_cb, (void *)(uintptr_t)2));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_async_call_cancel(async_cb, (void *)(uintptr_t)4));
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1 + 3, call_sum);
+
+    lv_async_stat_t stat;
+    lv_async_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(3, stat.posted - stat_ori.posted);
+    TEST_ASSERT_EQUAL_UINT32(2, stat.executed - stat_ori.executed);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.cancelled - stat_ori.cancelled);
+}
+
+void test_async_call_overflow(void)
+{
+    lv_async_stat_t stat_ori;
+    lv_async_get_stat(&stat_ori);
+
+    uint32_t i;
+    for(i = 0; i < LV_ASYNC_QUEUE_SIZE; i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_async_call(async_cb, NULL));
+    }
+
+#if LV_ASYNC_QUEUE_OVERFLOW_TIMER
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_async_call(async_cb, NULL));
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(LV_ASYNC_QUEUE_SIZE + 1, call_cnt);
+#else
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_async_call(async_cb, NULL));
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(LV_ASYNC_QUEUE_SIZE, call_cnt);
+
+    lv_async_stat_t stat;
+    lv_async_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(1, stat.dropped - stat_ori.dropped);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(LV_ASYNC_QUEUE_SIZE, stat.max_pending);
+#endif
+}
+
+void test_async_call_repost(void)
+{
+    /*A call posted by a callback runs only in the next timer handler*/
+    lv_async_call(repost_cb, NULL);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, call_cnt);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, call_cnt);
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+
+#define PRODUCER_CNT    3
+#define CALL_CNT        500
+
+static void producer_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    uint32_t i;
+    for(i = 1; i <= CALL_CNT; i++) {
+        while(lv_async_call(async_cb, (void *)(uintptr_t)i) != LV_RESULT_OK) {
+            sched_yield();
+        }
+    }
+}
+
+void test_async_call_threads(void)
+{
+    lv_thread_t threads[PRODUCER_CNT];
+    uint32_t i;
+    for(i = 0; i < PRODUCER_CNT; i++) {
+        lv_thread_init(&threads[i], LV_THREAD_PRIO_MID, producer_cb, 16 * 1024, NULL);
+    }
+
+    /*The calls are made without lv_lock() and run in this thread*/
+    while(call_cnt < PRODUCER_CNT * CALL_CNT) {
+        lv_timer_handler();
+        sched_yield();
+    }
+
+    for(i = 0; i < PRODUCER_CNT; i++) {
+        lv_thread_delete(&threads[i]);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(PRODUCER_CNT * CALL_CNT, call_cnt);
+    TEST_ASSERT_EQUAL_UINT32(PRODUCER_CNT * CALL_CNT * (CALL_CNT + 1) / 2, call_sum);
+}
+
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,136 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define DISP_HOR_RES    40
+#define DISP_VER_RES    20
+
+static lv_display_t * disp;
+static lv_display_t * disp_ori;
+static uint8_t flushed[DISP_HOR_RES * DISP_VER_RES * 2 + 8];
+static uint32_t flush_cnt;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    lv_color_format_t cf = lv_display_get_flush_color_format(d);
+    uint32_t palette_size = LV_COLOR_INDEXED_PALETTE_SIZE(cf) * 4;
+    uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), cf);
+
+    /*Keep only the first flushed line*/
+    lv_memcpy(flushed, px_map, palette_size + stride);
+    flush_cnt++;
+    lv_display_flush_ready(d);
+}
+
+static void create_display(lv_color_format_t cf, lv_display_render_mode_t render_mode)
+{
+    disp_ori = lv_display_get_default();
+    disp = lv_display_create(DISP_HOR_RES, DISP_VER_RES);
+    lv_display_set_color_format(disp, cf);
+
+    uint32_t buf_size = lv_draw_buf_width_to_stride(DISP_HOR_RES, cf) * DISP_VER_RES;
+    void * buf = lv_malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    lv_display_set_driver_data(disp, buf);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, cf), NULL, buf_size, render_mode);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0xff0000), 0);
+}
+
+void setUp(void)
+{
+    flush_cnt = 0;
+    lv_memzero(flushed, sizeof(flushed));
+}
+
+void tearDown(void)
+{
+    void * buf = lv_display_get_driver_data(disp);
+    lv_display_delete(disp);
+    lv_free(buf);
+    lv_display_set_default(disp_ori);
+}
+
+void test_display_flush_convert_rgb565_in_place(void)
+{
+    create_display(LV_COLOR_FORMAT_XRGB8888, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_color_format(disp, LV_COLOR_FORMAT_RGB565_SWAPPED);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565_SWAPPED, lv_display_get_flush_color_format(disp));
+
+    lv_refr_now(disp);
+    TEST_ASSERT_GREATER_THAN(0, flush_cnt);
+
+    uint16_t * px = (uint16_t *)flushed;
+    TEST_ASSERT_EQUAL_HEX16(0x00F8, px[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x00F8, px[DISP_HOR_RES - 1]);
+}
+
+void test_display_flush_convert_same_format(void)
+{
+    create_display(LV_COLOR_FORMAT_RGB565, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_color_format(disp, LV_COLOR_FORMAT_RGB565);
+
+    /*Flushed as rendered*/
+    lv_refr_now(disp);
+    TEST_ASSERT_GREATER_THAN(0, flush_cnt);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565, lv_display_get_flush_color_format(disp));
+
+    uint16_t * px = (uint16_t *)flushed;
+    TEST_ASSERT_EQUAL_HEX16(0xF800, px[0]);
+}
+
+void test_display_flush_convert_not_supported(void)
+{
+    create_display(LV_COLOR_FORMAT_L8, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_color_format(disp, LV_COLOR_FORMAT_RGB565);
+
+    /*The conversion is not tried again after the first failure*/
+    lv_refr_now(disp);
+    TEST_ASSERT_GREATER_THAN(0, flush_cnt);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_UNKNOWN, lv_display_get_flush_color_format(disp));
+}
+
+void test_display_flush_convert_i1_direct(void)
+{
+    create_display(LV_COLOR_FORMAT_RGB888, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_flush_color_format(disp, LV_COLOR_FORMAT_I1);
+    lv_display_set_flush_dither(disp, true);
+    TEST_ASSERT_TRUE(lv_display_get_flush_dither(disp));
+
+    /*A white box in the top left corner*/
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_color(obj, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_size(obj, 16, 16);
+
+    lv_refr_now(disp);
+    TEST_ASSERT_GREATER_THAN(0, flush_cnt);
+
+    /*Black and white palette then 16 white pixels*/
+    lv_color32_t * palette = (lv_color32_t *)flushed;
+    TEST_ASSERT_EQUAL_UINT8(0x00, palette[0].red);
+    TEST_ASSERT_EQUAL_UINT8(0xff, palette[1].red);
+    TEST_ASSERT_EQUAL_HEX8(0xff, flushed[8]);
+    TEST_ASSERT_EQUAL_HEX8(0xff, flushed[9]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, flushed[10]);
+
+    /*The rendered image is kept in the draw buffer for the next refreshes*/
+    uint8_t * rendered = lv_display_get_buf_active(disp)->data;
+    TEST_ASSERT_EQUAL_HEX8(0xff, rendered[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xff, rendered[3]);
+}
+
+#endif
@@ -0,0 +1,200 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define DISP_HOR_RES    64
+#define DISP_VER_RES    32
+#define BLOCK_W         16
+
+static lv_display_t * disp;
+static lv_display_t * disp_ori;
+
+/*The content of the simulated panel*/
+static uint16_t panel[DISP_VER_RES][DISP_HOR_RES];
+static lv_area_t flushed_areas[8];
+static uint32_t flush_cnt;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    if(flush_cnt < 8) flushed_areas[flush_cnt] = *area;
+    flush_cnt++;
+
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&panel[y][area->x1], px_map, w * 2);
+        px_map += stride;
+    }
+
+    lv_display_flush_ready(d);
+}
+
+static lv_obj_t * create_box(int32_t x, int32_t y)
+{
+    lv_obj_t * obj = lv_obj_create(lv_display_get_screen_active(disp));
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x0000ff), 0);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, 8, 4);
+    return obj;
+}
+
+static void refresh(void)
+{
+    flush_cnt = 0;
+    lv_refr_now(disp);
+}
+
+void setUp(void)
+{
+    disp_ori = lv_display_get_default();
+    disp = lv_display_create(DISP_HOR_RES, DISP_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+
+    uint32_t buf_size = lv_draw_buf_width_to_stride(DISP_HOR_RES, LV_COLOR_FORMAT_RGB565) * DISP_VER_RES;
+    void * buf = lv_malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    lv_display_set_driver_data(disp, buf);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, LV_COLOR_FORMAT_RGB565), NULL, buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0xff0000), 0);
+
+    lv_display_set_flush_delta(disp, BLOCK_W);
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_W, lv_display_get_flush_delta(disp));
+
+    lv_memzero(panel, sizeof(panel));
+}
+
+void tearDown(void)
+{
+    void * buf = lv_display_get_driver_data(disp);
+    lv_display_delete(disp);
+    lv_free(buf);
+    lv_display_set_default(disp_ori);
+}
+
+void test_display_flush_delta_first_frame(void)
+{
+    create_box(20, 10);
+    refresh();
+
+    /*Nothing is known about the panel so everything is sent*/
+    lv_display_flush_delta_stats_t stats;
+    lv_display_get_flush_delta_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(DISP_HOR_RES * DISP_VER_RES * 2, stats.rendered_bytes);
+    TEST_ASSERT_EQUAL_UINT32(stats.rendered_bytes, stats.flushed_bytes);
+
+    TEST_ASSERT_EQUAL_HEX16(0xf800, panel[0][0]);
+    TEST_ASSERT_EQUAL_HEX16(0x001f, panel[10][20]);
+    TEST_ASSERT_EQUAL_HEX16(0x001f, panel[13][27]);
+    TEST_ASSERT_EQUAL_HEX16(0xf800, panel[14][27]);
+}
+
+void test_display_flush_delta_unchanged(void)
+{
+    create_box(20, 10);
+    refresh();
+
+    /*Only one block of the last area is sent to let the driver know that the refresh is ready*/
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    refresh();
+
+    lv_display_flush_delta_stats_t stats;
+    lv_display_get_flush_delta_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(DISP_HOR_RES * DISP_VER_RES * 2, stats.rendered_bytes);
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_W * 2, stats.flushed_bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+}
+
+void test_display_flush_delta_shrink(void)
+{
+    lv_obj_t * box = create_box(20, 10);
+    refresh();
+
+    lv_obj_set_style_bg_color(box, lv_color_hex(0x00ff00), 0);
+    refresh();
+
+    /*The invalidated area is rounded to whole blocks and only the rows of the box are sent*/
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_EQUAL_INT32(16, flushed_areas[0].x1);
+    TEST_ASSERT_EQUAL_INT32(31, flushed_areas[0].x2);
+    TEST_ASSERT_EQUAL_INT32(10, flushed_areas[0].y1);
+    TEST_ASSERT_EQUAL_INT32(13, flushed_areas[0].y2);
+
+    TEST_ASSERT_EQUAL_HEX16(0x07e0, panel[10][20]);
+    TEST_ASSERT_EQUAL_HEX16(0x07e0, panel[13][27]);
+    TEST_ASSERT_EQUAL_HEX16(0xf800, panel[13][28]);
+}
+
+void test_display_flush_delta_split(void)
+{
+    lv_obj_t * box1 = create_box(4, 0);
+    lv_obj_t * box2 = create_box(40, 28);
+    refresh();
+
+    lv_obj_set_style_bg_color(box1, lv_color_hex(0x00ff00), 0);
+    lv_obj_set_style_bg_color(box2, lv_color_hex(0x00ff00), 0);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    refresh();
+
+    /*The changed rows are far from each other so they are sent in 2 bands*/
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+    TEST_ASSERT_EQUAL_INT32(0, flushed_areas[0].x1);
+    TEST_ASSERT_EQUAL_INT32(15, flushed_areas[0].x2);
+    TEST_ASSERT_EQUAL_INT32(0, flushed_areas[0].y1);
+    TEST_ASSERT_EQUAL_INT32(3, flushed_areas[0].y2);
+    TEST_ASSERT_EQUAL_INT32(32, flushed_areas[1].x1);
+    TEST_ASSERT_EQUAL_INT32(47, flushed_areas[1].x2);
+    TEST_ASSERT_EQUAL_INT32(28, flushed_areas[1].y1);
+    TEST_ASSERT_EQUAL_INT32(31, flushed_areas[1].y2);
+
+    lv_display_flush_delta_stats_t stats;
+    lv_display_get_flush_delta_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2 * 16 * 4 * 2, stats.flushed_bytes);
+
+    TEST_ASSERT_EQUAL_HEX16(0x07e0, panel[0][4]);
+    TEST_ASSERT_EQUAL_HEX16(0x07e0, panel[31][47]);
+    TEST_ASSERT_EQUAL_HEX16(0xf800, panel[31][48]);
+    TEST_ASSERT_EQUAL_HEX16(0xf800, panel[16][4]);
+}
+
+void test_display_flush_delta_full_period(void)
+{
+    lv_obj_t * box = create_box(20, 10);
+    refresh();
+
+    /*Simulate pixels which weren't flushed because of a hash collision*/
+    panel[0][0] = 0;
+
+    /*The first refresh is counted too*/
+    uint32_t i;
+    for(i = 2; i < LV_DISPLAY_FLUSH_DELTA_FULL_PERIOD; i++) {
+        lv_obj_invalidate(box);
+        refresh();
+    }
+    TEST_ASSERT_EQUAL_HEX16(0, panel[0][0]);
+
+    /*The whole screen is flushed periodically*/
+    lv_obj_invalidate(box);
+    refresh();
+
+    lv_display_flush_delta_stats_t stats;
+    lv_display_get_flush_delta_stats(disp, &stats);
+    TEST_ASSERT_EQUAL_UINT32(DISP_HOR_RES * DISP_VER_RES * 2, stats.flushed_bytes);
+    TEST_ASSERT_EQUAL_HEX16(0xf800, panel[0][0]);
+}
+
+#endif
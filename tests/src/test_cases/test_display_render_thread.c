@@ -0,0 +1,191 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DISPLAY_RENDER_THREAD
+
+#define DISP_HOR_RES    160
+#define DISP_VER_RES    120
+
+static lv_display_t * disp;
+static lv_display_t * disp_ori;
+
+/*The content of the simulated panel*/
+static uint16_t panel[DISP_VER_RES][DISP_HOR_RES];
+static uint16_t panel_ref[DISP_VER_RES][DISP_HOR_RES];
+static uint32_t render_ready_cnt;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&panel[y][area->x1], px_map, w * 2);
+        px_map += stride;
+    }
+
+    lv_display_flush_ready(d);
+}
+
+static void render_ready_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    render_ready_cnt++;
+}
+
+static lv_obj_t * create_scene(void)
+{
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+
+    lv_obj_t * panel_obj = lv_obj_create(scr);
+    lv_obj_set_size(panel_obj, 120, 80);
+    lv_obj_center(panel_obj);
+    lv_obj_set_style_bg_grad_color(panel_obj, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_dir(panel_obj, LV_GRAD_DIR_VER, 0);
+    lv_obj_set_style_shadow_width(panel_obj, 20, 0);
+
+    lv_obj_t * label = lv_label_create(panel_obj);
+    lv_label_set_text(label, "Rendered on\nits own thread");
+    lv_obj_center(label);
+
+    lv_obj_t * arc = lv_arc_create(scr);
+    lv_obj_set_size(arc, 60, 60);
+    lv_obj_set_pos(arc, 4, 4);
+
+    return arc;
+}
+
+static void render(bool threaded)
+{
+    lv_display_set_render_thread(disp, threaded);
+    TEST_ASSERT_EQUAL(threaded, lv_display_get_render_thread(disp));
+
+    lv_memzero(panel, sizeof(panel));
+    render_ready_cnt = 0;
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+}
+
+void setUp(void)
+{
+    disp_ori = lv_display_get_default();
+    disp = lv_display_create(DISP_HOR_RES, DISP_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+
+    /*Smaller than the screen to render the frames in more parts*/
+    uint32_t buf_size = lv_draw_buf_width_to_stride(DISP_HOR_RES, LV_COLOR_FORMAT_RGB565) * DISP_VER_RES / 4;
+    void * buf = lv_malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    lv_display_set_driver_data(disp, buf);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, LV_COLOR_FORMAT_RGB565), NULL, buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, render_ready_cb, LV_EVENT_RENDER_READY, NULL);
+
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+}
+
+void tearDown(void)
+{
+    void * buf = lv_display_get_driver_data(disp);
+    lv_display_delete(disp);
+    lv_free(buf);
+    lv_display_set_default(disp_ori);
+}
+
+void test_display_render_thread_same_result(void)
+{
+    create_scene();
+
+    render(false);
+    lv_memcpy(panel_ref, panel, sizeof(panel));
+    TEST_ASSERT_EQUAL_UINT32(1, render_ready_cnt);
+
+    render(true);
+    TEST_ASSERT_EQUAL_MEMORY(panel_ref, panel, sizeof(panel));
+    TEST_ASSERT_EQUAL_UINT32(1, render_ready_cnt);
+
+    /*Render only a part of the screen on the thread*/
+    lv_obj_t * label = lv_label_create(lv_display_get_screen_active(disp));
+    lv_label_set_text(label, "Updated");
+    lv_obj_align(label, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+    lv_refr_now(disp);
+    lv_memcpy(panel_ref, panel, sizeof(panel));
+
+    render(false);
+    TEST_ASSERT_EQUAL_MEMORY(panel_ref, panel, sizeof(panel));
+}
+
+void test_display_render_thread_layer_fallback(void)
+{
+    lv_obj_t * arc = create_scene();
+
+    /*Layers can't be recorded so the frame is rendered without the thread*/
+    lv_obj_set_style_opa_layered(arc, LV_OPA_70, 0);
+
+    render(false);
+    lv_memcpy(panel_ref, panel, sizeof(panel));
+
+    render(true);
+    TEST_ASSERT_EQUAL_MEMORY(panel_ref, panel, sizeof(panel));
+    TEST_ASSERT_EQUAL_UINT32(1, render_ready_cnt);
+}
+
+void test_display_render_thread_delete_while_rendering(void)
+{
+    create_scene();
+    lv_display_set_render_thread(disp, true);
+
+    /*Start rendering and delete the widgets while the frame might be still rendered*/
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_display_refr_timer(disp->refr_timer);
+    lv_obj_clean(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+
+    /*Only the screen remained*/
+    uint16_t bg = panel[DISP_VER_RES / 2][DISP_HOR_RES / 2];
+    int32_t y;
+    for(y = 0; y < DISP_VER_RES; y++) {
+        int32_t x;
+        for(x = 0; x < DISP_HOR_RES; x++) {
+            TEST_ASSERT_EQUAL_HEX16(bg, panel[y][x]);
+        }
+    }
+
+    /*The display can be deleted while its thread is running*/
+}
+
+void test_display_render_thread_draw_unit_mask(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_draw_unit_mask(disp));
+
+    /*All draw units can't be reserved while the other display has no draw units*/
+    uint32_t unit_cnt = lv_draw_get_unit_count();
+    uint32_t all_units = unit_cnt >= 32 ? 0xFFFFFFFF : (1UL << unit_cnt) - 1;
+    lv_display_set_draw_unit_mask(disp, all_units);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_draw_unit_mask(disp));
+
+    create_scene();
+    render(false);
+    lv_memcpy(panel_ref, panel, sizeof(panel));
+
+    /*Only the first draw unit renders the display*/
+    if(unit_cnt > 1) {
+        lv_display_set_draw_unit_mask(disp, 0x1);
+        TEST_ASSERT_EQUAL_UINT32(0x1, lv_display_get_draw_unit_mask(disp));
+    }
+
+    render(true);
+    TEST_ASSERT_EQUAL_MEMORY(panel_ref, panel, sizeof(panel));
+}
+
+#endif
+
+#endif
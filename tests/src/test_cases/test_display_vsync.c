@@ -0,0 +1,171 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define DISP_HOR_RES    64
+#define DISP_VER_RES    32
+
+static lv_display_t * disp;
+static lv_display_t * disp_ori;
+static uint32_t render_ready_cnt;
+static uint32_t flush_time;
+static int32_t anim_value;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+
+    /*Simulate a slow display*/
+    lv_tick_inc(flush_time);
+    lv_display_flush_ready(d);
+}
+
+static void render_ready_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    render_ready_cnt++;
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    LV_UNUSED(var);
+    anim_value = v;
+}
+
+/*Report 60 Hz vsyncs for a while. The last vsync is at the current time.*/
+static void report_vsyncs(void)
+{
+    static const uint32_t intervals[] = {17, 17, 16};
+    uint32_t i;
+    for(i = 0; i < 60; i++) {
+        lv_tick_inc(intervals[i % 3]);
+        lv_display_report_vsync(disp, lv_tick_get());
+    }
+}
+
+static void refr_timer(void)
+{
+    lv_display_refr_timer(lv_display_get_refr_timer(disp));
+}
+
+void setUp(void)
+{
+    disp_ori = lv_display_get_default();
+    disp = lv_display_create(DISP_HOR_RES, DISP_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+
+    uint32_t buf_size = lv_draw_buf_width_to_stride(DISP_HOR_RES, LV_COLOR_FORMAT_RGB565) * DISP_VER_RES;
+    void * buf = lv_malloc(buf_size + LV_DRAW_BUF_ALIGN);
+    lv_display_set_driver_data(disp, buf);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, LV_COLOR_FORMAT_RGB565), NULL, buf_size,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, render_ready_cb, LV_EVENT_RENDER_READY, NULL);
+
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+
+    render_ready_cnt = 0;
+    flush_time = 0;
+}
+
+void tearDown(void)
+{
+    lv_anim_delete_all();
+    lv_anim_set_time_offset(0);
+
+    void * buf = lv_display_get_driver_data(disp);
+    lv_display_delete(disp);
+    lv_free(buf);
+    lv_display_set_default(disp_ori);
+}
+
+void test_display_vsync_period(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0, lv_display_get_vsync_period(disp));
+
+    report_vsyncs();
+    TEST_ASSERT_UINT32_WITHIN(300, 16667, lv_display_get_vsync_period(disp));
+
+    /*Skipped vsyncs (e.g. nothing was flushed) don't change the period*/
+    lv_tick_inc(67);
+    lv_display_report_vsync(disp, lv_tick_get());
+    TEST_ASSERT_UINT32_WITHIN(300, 16667, lv_display_get_vsync_period(disp));
+}
+
+void test_display_vsync_render_before_vsync(void)
+{
+    report_vsyncs();
+    lv_tick_inc(2);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+
+    /*Rendering is fast so it's delayed until just before the next vsync*/
+    refr_timer();
+    TEST_ASSERT_EQUAL_UINT32(0, render_ready_cnt);
+
+    lv_tick_inc(12);
+    refr_timer();
+    TEST_ASSERT_EQUAL_UINT32(0, render_ready_cnt);
+
+    lv_tick_inc(1);
+    refr_timer();
+    TEST_ASSERT_EQUAL_UINT32(1, render_ready_cnt);
+}
+
+void test_display_vsync_adapt_to_render_cost(void)
+{
+    report_vsyncs();
+
+    /*Learn that rendering takes 5 ms*/
+    flush_time = 5;
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(5000, lv_display_get_render_cost(disp));
+    render_ready_cnt = 0;
+
+    report_vsyncs();
+    lv_tick_inc(2);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+
+    /*Rendering is started 5 ms + margin earlier*/
+    refr_timer();
+    TEST_ASSERT_EQUAL_UINT32(0, render_ready_cnt);
+
+    lv_tick_inc(8);
+    refr_timer();
+    TEST_ASSERT_EQUAL_UINT32(1, render_ready_cnt);
+}
+
+void test_display_vsync_anim_at_presentation(void)
+{
+    report_vsyncs();
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, anim_exec_cb);
+    lv_anim_set_values(&a, 0, 100000);
+    lv_anim_set_duration(&a, 1000);
+    lv_anim_start(&a);
+
+    lv_tick_inc(15);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    refr_timer();
+    TEST_ASSERT_EQUAL_UINT32(1, render_ready_cnt);
+
+    /*The frame will be visible at the next vsync, 16 ms after the start of the animation*/
+    TEST_ASSERT_EQUAL_INT32(16 * 1024 / 1000 * 100000 >> 10, anim_value);
+
+    /*The offset is used only for the frame, later the animations wait for the tick to catch up*/
+    lv_tick_inc(1);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL_INT32(16 * 1024 / 1000 * 100000 >> 10, anim_value);
+}
+
+#endif
@@ -0,0 +1,105 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_draw_buf_convert_color_format(void)
+{
+    /*Red, light gray and dark blue in XRGB8888 (B, G, R, X)*/
+    uint8_t src[3 * 4] = {
+        0x00, 0x00, 0xFF, 0xFF,     0xC0, 0xC0, 0xC0, 0xFF,     0x40, 0x00, 0x00, 0xFF
+    };
+    lv_area_t area = {0, 0, 2, 0};
+
+    uint16_t rgb565[3];
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_buf_convert_color_format(src, sizeof(src), LV_COLOR_FORMAT_XRGB8888,
+                                                                     rgb565, sizeof(rgb565), LV_COLOR_FORMAT_RGB565,
+                                                                     &area, &area, false));
+    TEST_ASSERT_EQUAL_HEX16(0xF800, rgb565[0]);
+    TEST_ASSERT_EQUAL_HEX16(0xC618, rgb565[1]);
+    TEST_ASSERT_EQUAL_HEX16(0x0008, rgb565[2]);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_buf_convert_color_format(src, sizeof(src), LV_COLOR_FORMAT_XRGB8888,
+                                                                     rgb565, sizeof(rgb565), LV_COLOR_FORMAT_RGB565_SWAPPED,
+                                                                     &area, &area, false));
+    TEST_ASSERT_EQUAL_HEX16(0x00F8, rgb565[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x18C6, rgb565[1]);
+    TEST_ASSERT_EQUAL_HEX16(0x0800, rgb565[2]);
+
+    uint8_t l8[3];
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_buf_convert_color_format(src, sizeof(src), LV_COLOR_FORMAT_XRGB8888,
+                                                                     l8, sizeof(l8), LV_COLOR_FORMAT_L8,
+                                                                     &area, &area, false));
+    TEST_ASSERT_EQUAL_UINT8(76, l8[0]);
+    TEST_ASSERT_EQUAL_UINT8(0xC0, l8[1]);
+    TEST_ASSERT_EQUAL_UINT8(7, l8[2]);
+
+    /*Only the light gray is bright. Convert from the second pixel to check that the other bits are kept.*/
+    uint8_t src_ofs[4 * 4] = {0};
+    lv_memcpy(src_ofs + 4, src, sizeof(src));
+    uint8_t i1 = 0x81;
+    lv_area_t buf_area = {0, 0, 3, 0};
+    lv_area_t area_ofs = {1, 0, 3, 0};
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_buf_convert_color_format(src_ofs, sizeof(src_ofs), LV_COLOR_FORMAT_XRGB8888,
+                                                                     &i1, 1, LV_COLOR_FORMAT_I1,
+                                                                     &buf_area, &area_ofs, false));
+    TEST_ASSERT_EQUAL_HEX8(0xA1, i1);
+
+    /*RGB565 can be only swapped*/
+    uint16_t rgb565_src[3] = {0xF800, 0xC618, 0x0008};
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_buf_convert_color_format(rgb565_src, sizeof(rgb565_src), LV_COLOR_FORMAT_RGB565,
+                                                                     rgb565, sizeof(rgb565), LV_COLOR_FORMAT_RGB565_SWAPPED,
+                                                                     &area, &area, false));
+    TEST_ASSERT_EQUAL_HEX16(0x00F8, rgb565[0]);
+    TEST_ASSERT_EQUAL_HEX16(0x18C6, rgb565[1]);
+    TEST_ASSERT_EQUAL_HEX16(0x0800, rgb565[2]);
+
+    /*Not supported conversions*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_buf_convert_color_format(src, sizeof(src), LV_COLOR_FORMAT_XRGB8888,
+                                                                          l8, sizeof(l8), LV_COLOR_FORMAT_A8,
+                                                                          &area, &area, false));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_draw_buf_convert_color_format(src, sizeof(src), LV_COLOR_FORMAT_RGB565,
+                                                                          l8, sizeof(l8), LV_COLOR_FORMAT_L8,
+                                                                          &area, &area, false));
+}
+
+void test_draw_buf_convert_color_format_dither(void)
+{
+    /*A gray between two RGB565 levels in place. On average the dithered result should match it.*/
+    const int32_t w = 16;
+    const int32_t h = 8;
+    uint8_t buf[16 * 8 * 3];
+    lv_memset(buf, 0x84, sizeof(buf));
+
+    lv_area_t area = {0, 0, w - 1, h - 1};
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_draw_buf_convert_color_format(buf, w * 3, LV_COLOR_FORMAT_RGB888,
+                                                                     buf, w * 2, LV_COLOR_FORMAT_RGB565,
+                                                                     &area, &area, true));
+
+    uint16_t * rgb565 = (uint16_t *)buf;
+    uint32_t red_sum = 0;
+    uint32_t red_levels = 0;
+    int32_t i;
+    for(i = 0; i < w * h; i++) {
+        uint32_t red = rgb565[i] >> 11;
+        red_levels |= 1 << red;
+        red_sum += red << 3;
+    }
+
+    /*Both 0x80 and 0x88 are used and the average is 0x84*/
+    TEST_ASSERT_EQUAL_HEX32((1 << 16) | (1 << 17), red_levels);
+    TEST_ASSERT_EQUAL_UINT32(0x84, red_sum / (w * h));
+}
+
+#endif
@@ -0,0 +1,110 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+static uint32_t draw_main_cnt;
+
+static lv_obj_t * create_cached_tree(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 200);
+    lv_obj_center(cont);
+    lv_obj_add_flag(cont, LV_OBJ_FLAG_CACHE_DRAW_LIST);
+
+    lv_obj_t * btn = lv_button_create(cont);
+    lv_obj_t * label = lv_label_create(btn);
+    lv_label_set_text(label, "Cached");
+    lv_test_count_draw_main(label, &draw_main_cnt);
+
+    return cont;
+}
+
+void setUp(void)
+{
+    draw_main_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_draw_list_cache_replays_without_events(void)
+{
+    create_cached_tree();
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_main_cnt);
+
+    /*Only the screen is redrawn, the container is replayed*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_main_cnt);
+}
+
+void test_draw_list_cache_rerecords_on_child_change(void)
+{
+    lv_obj_t * cont = create_cached_tree();
+    lv_obj_t * label = lv_obj_get_child(lv_obj_get_child(cont, 0), 0);
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_main_cnt);
+
+    lv_label_set_text(label, "Changed");
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    /*Moving the container changes its coordinates*/
+    lv_obj_set_x(cont, 10);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, draw_main_cnt);
+
+    /*Style changes might be inherited*/
+    lv_obj_set_style_text_color(cont, lv_color_hex(0xff0000), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, draw_main_cnt);
+}
+
+void test_draw_list_cache_same_result(void)
+{
+    lv_obj_t * cont = create_cached_tree();
+    lv_refr_now(NULL);
+
+    lv_draw_buf_t * cached = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(cached);
+
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_CACHE_DRAW_LIST);
+    lv_draw_buf_t * normal = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(normal);
+
+    /*The same draw tasks are replayed so the result is exactly the same*/
+    TEST_ASSERT_EQUAL_UINT32(0, lv_test_draw_buf_max_diff(normal, cached));
+
+    lv_draw_buf_destroy(cached);
+    lv_draw_buf_destroy(normal);
+}
+
+void test_draw_list_cache_released_on_change(void)
+{
+    lv_obj_t * cont = create_cached_tree();
+    lv_obj_t * label = lv_obj_get_child(lv_obj_get_child(cont, 0), 0);
+    lv_refr_now(NULL);
+
+    lv_obj_draw_cache_t * cache = cont->spec_attr->draw_cache;
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_NOT_NULL(cache->task_head);
+
+    /*The recorded draw tasks are freed right away, not only when recorded again*/
+    lv_label_set_text(label, "Changed");
+    TEST_ASSERT_NULL(cache->task_head);
+    TEST_ASSERT_FALSE(cache->valid);
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(cache->valid);
+    TEST_ASSERT_NOT_NULL(cache->task_head);
+}
+
+#endif
@@ -143,4 +143,69 @@ void test_event_delete_obj_in_recursive_event_call(void)
     lv_test_mouse_click_at(30, 30);
 }
 
+static uint32_t mask_cnt;
+static void event_mask_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    mask_cnt++;
+}
+
+static void event_mask_remove_self_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    mask_cnt++;
+    lv_obj_remove_event_cb(obj, event_mask_remove_self_cb);
+}
+
+void test_event_code_mask(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_event_cb(obj, event_mask_cb, LV_EVENT_CLICKED, NULL);
+    lv_event_list_t * list = &obj->spec_attr->event_list;
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)1 << LV_EVENT_CLICKED, list->code_mask);
+
+    /*Events without a handler are skipped*/
+    mask_cnt = 0;
+    lv_obj_send_event(obj, LV_EVENT_PRESSED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, mask_cnt);
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, mask_cnt);
+
+    /*Preprocess handlers use the bit of their code*/
+    lv_obj_add_event_cb(obj, event_mask_cb, LV_EVENT_PRESSED | LV_EVENT_PREPROCESS, NULL);
+    TEST_ASSERT_BITS_HIGH((uint64_t)1 << LV_EVENT_PRESSED, list->code_mask);
+    lv_obj_send_event(obj, LV_EVENT_PRESSED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, mask_cnt);
+
+    /*The bits are cleared when the handlers are removed*/
+    lv_obj_remove_event_cb(obj, event_mask_cb);
+    lv_obj_remove_event_cb(obj, event_mask_cb);
+    TEST_ASSERT_EQUAL_UINT64(0, list->code_mask);
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, mask_cnt);
+
+    /*LV_EVENT_ALL sets every bit*/
+    lv_obj_add_event_cb(obj, event_mask_cb, LV_EVENT_ALL, NULL);
+    TEST_ASSERT_EQUAL_UINT64(~(uint64_t)0, list->code_mask);
+    lv_obj_send_event(obj, LV_EVENT_SCROLL, NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, mask_cnt);
+    lv_obj_remove_event_cb(obj, event_mask_cb);
+
+    /*Custom event codes share the last bit*/
+    uint32_t custom_code = lv_event_register_id();
+    lv_obj_add_event_cb(obj, event_mask_cb, custom_code, NULL);
+    lv_obj_send_event(obj, custom_code, NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, mask_cnt);
+
+    /*Removing a handler while the list is traversed updates the mask afterwards*/
+    lv_obj_add_event_cb(obj, event_mask_remove_self_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(5, mask_cnt);
+    TEST_ASSERT_BITS_LOW((uint64_t)1 << LV_EVENT_CLICKED, list->code_mask);
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL_UINT32(5, mask_cnt);
+
+    lv_obj_delete(obj);
+}
+
 #endif
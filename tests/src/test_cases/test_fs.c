@@ -274,4 +274,60 @@ void test_write_read_random(void)
     drv->cache_size = original_cache_size;
 }
 
+#if LV_USE_FS_MMAP
+void test_read_mmap(void)
+{
+    lv_fs_res_t res;
+    lv_fs_file_t f;
+
+    /*Only reading is supported*/
+    res = lv_fs_open(&f, "D:src/test_files/readtest.txt", LV_FS_MODE_WR);
+    TEST_ASSERT_NOT_EQUAL(LV_FS_RES_OK, res);
+
+    res = lv_fs_open(&f, "D:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    /*The content is directly accessible*/
+    const void * buf;
+    uint32_t size;
+    res = lv_fs_get_buffer(&f, &buf, &size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL_MEMORY(read_exp, buf, strlen(read_exp));
+
+    /*But it can be read normally too*/
+    uint8_t buf_rd[79];
+    uint32_t cnt = 0;
+    uint32_t br = 1;
+    while(br) {
+        res = lv_fs_read(&f, buf_rd, sizeof(buf_rd), &br);
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+        TEST_ASSERT_TRUE(memcmp(buf_rd, (const uint8_t *)buf + cnt, br) == 0);
+        cnt += br;
+    }
+    TEST_ASSERT_EQUAL(size, cnt);
+
+    uint32_t pos;
+    res = lv_fs_seek(&f, 100, LV_FS_SEEK_SET);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_read(&f, buf_rd, 10, &br);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL(10, br);
+    TEST_ASSERT_EQUAL_MEMORY(read_exp + 100, buf_rd, 10);
+    res = lv_fs_tell(&f, &pos);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    TEST_ASSERT_EQUAL(110, pos);
+
+    res = lv_fs_close(&f);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    /*Other drivers don't support direct access*/
+    res = lv_fs_open(&f, "B:src/test_files/readtest.txt", LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+    res = lv_fs_get_buffer(&f, &buf, &size);
+    TEST_ASSERT_EQUAL(LV_FS_RES_NOT_IMP, res);
+    TEST_ASSERT_NULL(buf);
+    lv_fs_close(&f);
+}
+#endif
+
 #endif
@@ -0,0 +1,201 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include <sched.h>
+
+#define TEST_IMG_SRC "A:src/test_assets/test_img_lvgl_logo.png"
+
+/*Upper bound of the yields while waiting for the decoder thread*/
+#define WAIT_YIELD_MAX  10000000
+
+LV_IMAGE_DECLARE(test_img_lvgl_logo_png);
+
+static uint32_t img_task_cnt;
+static const void * last_img_src;
+
+static void draw_task_added_cb(lv_event_t * e)
+{
+    lv_draw_task_t * t = lv_event_get_draw_task(e);
+    if(t->type != LV_DRAW_TASK_TYPE_IMAGE) return;
+
+    lv_draw_image_dsc_t * dsc = t->draw_dsc;
+    last_img_src = dsc->src;
+    img_task_cnt++;
+}
+
+static lv_obj_t * create_image(void)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, TEST_IMG_SRC);
+    lv_obj_set_size(img, 105, 33);
+    lv_obj_center(img);
+    lv_obj_add_flag(img, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(img, draw_task_added_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+
+    return img;
+}
+
+/*Wait until the decoder thread finishes the queued images and let the timer handle them*/
+static bool wait_for_decoding(void)
+{
+    uint32_t i;
+    for(i = 0; !lv_image_decoder_async_is_idle(); i++) {
+        if(i == WAIT_YIELD_MAX) return false;
+        sched_yield();
+    }
+
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    return true;
+}
+
+static bool wait_for_image_task(void)
+{
+    if(!wait_for_decoding()) return false;
+
+    /*The widget was invalidated by the timer so it's drawn now*/
+    lv_refr_now(NULL);
+    return img_task_cnt > 0;
+}
+
+void setUp(void)
+{
+    img_task_cnt = 0;
+    last_img_src = NULL;
+    lv_image_cache_drop(NULL);
+    lv_image_decoder_set_async(true);
+}
+
+void tearDown(void)
+{
+    lv_image_decoder_set_async(false);
+    lv_image_decoder_set_async_placeholder(NULL);
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+}
+
+void test_image_decoder_async_draws_when_decoded(void)
+{
+    create_image();
+    lv_refr_now(NULL);
+
+    /*The image is decoded in the background so it's not drawn in the first frame*/
+    TEST_ASSERT_EQUAL_UINT32(0, img_task_cnt);
+
+    /*The image is invalidated and drawn when it's decoded*/
+    TEST_ASSERT_TRUE(wait_for_image_task());
+    TEST_ASSERT_EQUAL_STRING(TEST_IMG_SRC, last_img_src);
+
+    /*The next frames are drawn from the cache directly*/
+    img_task_cnt = 0;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, img_task_cnt);
+}
+
+void test_image_decoder_async_placeholder(void)
+{
+    lv_image_decoder_set_async_placeholder(&test_img_lvgl_logo_png);
+    create_image();
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(1, img_task_cnt);
+    TEST_ASSERT_EQUAL_PTR(&test_img_lvgl_logo_png, last_img_src);
+
+    img_task_cnt = 0;
+    TEST_ASSERT_TRUE(wait_for_image_task());
+    TEST_ASSERT_EQUAL_STRING(TEST_IMG_SRC, last_img_src);
+}
+
+void test_image_decoder_async_prefetch(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_cache_prefetch(NULL));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_cache_prefetch(TEST_IMG_SRC));
+
+    TEST_ASSERT_TRUE(wait_for_decoding());
+
+    /*The prefetched image is drawn in the first frame*/
+    create_image();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, img_task_cnt);
+}
+
+void test_image_decoder_async_evicted_before_drawing(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_cache_prefetch(TEST_IMG_SRC));
+    TEST_ASSERT_TRUE(wait_for_decoding());
+
+    /*Not decoded again in the background but drawn directly*/
+    lv_image_cache_drop(TEST_IMG_SRC);
+    create_image();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, img_task_cnt);
+}
+
+void test_image_decoder_async_prefetched_jobs_bounded(void)
+{
+    /*The images which can't be decoded are remembered until they are requested*/
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        char src[64];
+        lv_snprintf(src, sizeof(src), "A:src/test_assets/not_existing_%d.png", (int)i);
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_cache_prefetch(src));
+        TEST_ASSERT_TRUE(wait_for_decoding());
+    }
+
+    /*Only the most recent ones are kept if they are never requested*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(16, lv_ll_get_len(&LV_GLOBAL_DEFAULT()->img_decoder_async.job_ll));
+}
+
+void test_image_decoder_async_prefetch_sync(void)
+{
+    lv_image_decoder_set_async(false);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_cache_prefetch(TEST_IMG_SRC));
+
+    create_image();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, img_task_cnt);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_image_decoder_async_draws_when_decoded(void)
+{
+}
+
+void test_image_decoder_async_placeholder(void)
+{
+}
+
+void test_image_decoder_async_prefetch(void)
+{
+}
+
+void test_image_decoder_async_evicted_before_drawing(void)
+{
+}
+
+void test_image_decoder_async_prefetched_jobs_bounded(void)
+{
+}
+
+void test_image_decoder_async_prefetch_sync(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,174 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_IME_PINYIN
+
+/*Not grouped by the first letter on purpose*/
+static lv_pinyin_dict_t test_dict[] = {
+    { "zhu", "猪主" },
+    { "a", "啊" },
+    { "ba", "吧八" },
+    { "bai", "白百" },
+    { "zhong", "中种" },
+    { NULL, NULL }
+};
+
+static const lv_pinyin_dict_t sorted_dict[] = {
+    { "a", "啊" },
+    { "ba", "吧八" },
+    { "bai", "白百" },
+    { "zhong", "中种" },
+    { "zhu", "猪主" },
+    { NULL, NULL }
+};
+
+static lv_obj_t * pinyin_ime;
+static lv_obj_t * kb;
+static lv_obj_t * ta;
+
+void setUp(void)
+{
+    pinyin_ime = lv_ime_pinyin_create(lv_screen_active());
+    kb = lv_keyboard_create(lv_screen_active());
+    ta = lv_textarea_create(lv_screen_active());
+    lv_keyboard_set_textarea(kb, ta);
+    lv_ime_pinyin_set_keyboard(pinyin_ime, kb);
+    lv_ime_pinyin_set_dict(pinyin_ime, test_dict);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void press_key(const char * txt)
+{
+    const char * const * map = lv_buttonmatrix_get_map(kb);
+    uint32_t id = 0;
+    uint32_t i;
+    for(i = 0; map[i][0] != '\0'; i++) {
+        if(lv_strcmp(map[i], "\n") == 0) continue;
+        if(lv_strcmp(map[i], txt) == 0) {
+            lv_buttonmatrix_set_selected_button(kb, id);
+            lv_obj_send_event(kb, LV_EVENT_VALUE_CHANGED, NULL);
+            return;
+        }
+        id++;
+    }
+
+    TEST_FAIL_MESSAGE("key not found");
+}
+
+static const char * get_cand(uint32_t index)
+{
+    return lv_buttonmatrix_get_button_text(lv_ime_pinyin_get_cand_panel(pinyin_ime), index + 1);
+}
+
+void test_ime_pinyin_prefix(void)
+{
+    lv_obj_t * cand_panel = lv_ime_pinyin_get_cand_panel(pinyin_ime);
+
+    /*The first entry with the typed prefix is used*/
+    press_key("b");
+    TEST_ASSERT_FALSE(lv_obj_has_flag(cand_panel, LV_OBJ_FLAG_HIDDEN));
+    TEST_ASSERT_EQUAL_STRING("吧", get_cand(0));
+    TEST_ASSERT_EQUAL_STRING("八", get_cand(1));
+
+    press_key("a");
+    TEST_ASSERT_EQUAL_STRING("吧", get_cand(0));
+
+    press_key("i");
+    TEST_ASSERT_EQUAL_STRING("白", get_cand(0));
+    TEST_ASSERT_EQUAL_STRING("百", get_cand(1));
+
+    press_key(LV_SYMBOL_BACKSPACE);
+    press_key(LV_SYMBOL_BACKSPACE);
+    press_key(LV_SYMBOL_BACKSPACE);
+    TEST_ASSERT_TRUE(lv_obj_has_flag(cand_panel, LV_OBJ_FLAG_HIDDEN));
+
+    press_key("z");
+    press_key("h");
+    TEST_ASSERT_EQUAL_STRING("猪", get_cand(0));
+    press_key("o");
+    TEST_ASSERT_EQUAL_STRING("中", get_cand(0));
+
+    /*Not in the dictionary: the candidates are kept*/
+    press_key("x");
+    TEST_ASSERT_EQUAL_STRING("中", get_cand(0));
+}
+
+void test_ime_pinyin_shared_trie(void)
+{
+    lv_obj_t * pinyin_ime_2 = lv_ime_pinyin_create(lv_screen_active());
+    lv_ime_pinyin_set_dict(pinyin_ime_2, test_dict);
+
+    /*The prefix tree is built only once for a dictionary*/
+    lv_ime_pinyin_t * ime_1 = (lv_ime_pinyin_t *)pinyin_ime;
+    lv_ime_pinyin_t * ime_2 = (lv_ime_pinyin_t *)pinyin_ime_2;
+    TEST_ASSERT_NOT_NULL(ime_1->shared_trie);
+    TEST_ASSERT_EQUAL_PTR(ime_1->shared_trie, ime_2->shared_trie);
+    TEST_ASSERT_EQUAL_PTR(ime_1->trie, ime_2->trie);
+    TEST_ASSERT_EQUAL_UINT32(2, ime_1->shared_trie->ref_cnt);
+
+    lv_obj_delete(pinyin_ime_2);
+    TEST_ASSERT_EQUAL_UINT32(1, ime_1->shared_trie->ref_cnt);
+
+    press_key("b");
+    TEST_ASSERT_EQUAL_STRING("吧", get_cand(0));
+}
+
+void test_ime_pinyin_trie_node_cnt(void)
+{
+    static lv_ime_pinyin_trie_node_t trie[16];
+
+    /*The count is exact for sorted dictionaries: the root, "a", "b-a-i", "z-h-o-n-g" and "u"*/
+    TEST_ASSERT_EQUAL_UINT32(11, lv_ime_pinyin_get_trie_node_cnt(sorted_dict));
+    TEST_ASSERT_EQUAL_UINT32(11, lv_ime_pinyin_build_trie(sorted_dict, trie));
+
+    /*"zhong" shares its prefix with "zhu" which is not the previous entry*/
+    TEST_ASSERT_EQUAL_UINT32(13, lv_ime_pinyin_get_trie_node_cnt(test_dict));
+    TEST_ASSERT_EQUAL_UINT32(11, lv_ime_pinyin_build_trie(test_dict, trie));
+}
+
+void test_ime_pinyin_prebuilt_trie(void)
+{
+    /*Could be a constant array generated from the dictionary*/
+    static lv_ime_pinyin_trie_node_t trie[16];
+    lv_ime_pinyin_build_trie(sorted_dict, trie);
+
+    lv_ime_pinyin_set_dict_with_trie(pinyin_ime, sorted_dict, trie);
+    lv_ime_pinyin_t * ime = (lv_ime_pinyin_t *)pinyin_ime;
+    TEST_ASSERT_NULL(ime->shared_trie);
+    TEST_ASSERT_EQUAL_PTR(trie, ime->trie);
+    TEST_ASSERT_EQUAL_PTR(sorted_dict, lv_ime_pinyin_get_dict(pinyin_ime));
+
+    press_key("z");
+    press_key("h");
+    TEST_ASSERT_EQUAL_STRING("中", get_cand(0));
+    press_key("u");
+    TEST_ASSERT_EQUAL_STRING("猪", get_cand(0));
+}
+
+#if LV_IME_PINYIN_USE_K9_MODE
+void test_ime_pinyin_k9(void)
+{
+    lv_ime_pinyin_set_mode(pinyin_ime, LV_IME_PINYIN_MODE_K9);
+
+    /*Only "zh" of the 12 combinations is a prefix in the dictionary*/
+    press_key("wxyz");
+    press_key("ghi");
+    TEST_ASSERT_EQUAL_STRING("zh", lv_textarea_get_text(ta));
+    TEST_ASSERT_EQUAL_STRING("猪", get_cand(0));
+
+    press_key("mno");
+    TEST_ASSERT_EQUAL_STRING("zho", lv_textarea_get_text(ta));
+    TEST_ASSERT_EQUAL_STRING("中", get_cand(0));
+}
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,141 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+static uint32_t draw_main_cnt;
+
+static lv_obj_t * create_cached_layer(int32_t w, int32_t h)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, w, h);
+    lv_obj_center(cont);
+    lv_obj_set_style_transform_rotation(cont, 100, 0);
+    lv_obj_set_style_transform_pivot_x(cont, LV_PCT(50), 0);
+    lv_obj_set_style_transform_pivot_y(cont, LV_PCT(50), 0);
+    lv_obj_set_layer_cache(cont, true);
+
+    lv_obj_t * label = lv_label_create(cont);
+    lv_label_set_text(label, "Cached layer");
+    lv_test_count_draw_main(label, &draw_main_cnt);
+
+    return cont;
+}
+
+void setUp(void)
+{
+    draw_main_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_layer_cache_reused_while_transformed(void)
+{
+    lv_obj_t * cont = create_cached_layer(200, 100);
+    TEST_ASSERT_TRUE(lv_obj_get_layer_cache(cont));
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_main_cnt);
+
+    lv_obj_set_style_transform_rotation(cont, 200, 0);
+    lv_refr_now(NULL);
+    lv_obj_set_style_transform_scale(cont, 300, 0);
+    lv_refr_now(NULL);
+    lv_obj_set_style_opa_layered(cont, LV_OPA_50, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_main_cnt);
+
+    /*The content has changed*/
+    lv_label_set_text(lv_obj_get_child(cont, 0), "Changed");
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+
+    lv_obj_set_style_bg_color(cont, lv_color_hex(0x00ff00), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, draw_main_cnt);
+
+    lv_obj_set_layer_cache(cont, false);
+    TEST_ASSERT_FALSE(lv_obj_get_layer_cache(cont));
+    lv_obj_invalidate(cont);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, draw_main_cnt);
+}
+
+void test_layer_cache_inherited_style(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(parent, 400, 300);
+    lv_obj_center(parent);
+    lv_obj_t * cont = create_cached_layer(200, 100);
+    lv_obj_set_parent(cont, parent);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_main_cnt);
+
+    /*The label inherits the text color so the cached layer must be rendered again*/
+    lv_obj_set_style_text_color(parent, lv_color_hex(0xff0000), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_main_cnt);
+}
+
+void test_layer_cache_same_result(void)
+{
+    lv_obj_t * cont = create_cached_layer(200, 100);
+    lv_refr_now(NULL);
+
+    lv_draw_buf_t * cached = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(cached);
+
+    lv_obj_set_layer_cache(cont, false);
+    lv_draw_buf_t * normal = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(normal);
+
+    /*The layers start at different positions so the antialiased edges might be rounded differently*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(32, lv_test_draw_buf_max_diff(normal, cached));
+
+    lv_draw_buf_destroy(cached);
+    lv_draw_buf_destroy(normal);
+}
+
+void test_layer_cache_too_large_layer(void)
+{
+    /*Doesn't fit into LV_OBJ_LAYER_CACHE_SIZE so it's rendered normally*/
+    lv_obj_t * cont = create_cached_layer(800, 480);
+
+    lv_refr_now(NULL);
+    uint32_t cnt = draw_main_cnt;
+    TEST_ASSERT_NOT_EQUAL(0, cnt);
+
+    lv_obj_set_style_transform_rotation(cont, 200, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(cnt, draw_main_cnt);
+}
+
+void test_layer_cache_freed_on_delete(void)
+{
+    lv_ll_t * layer_cache_ll = &LV_GLOBAL_DEFAULT()->layer_cache_ll;
+
+    lv_obj_t * cont = create_cached_layer(200, 100);
+    lv_obj_t * cont_2 = create_cached_layer(100, 100);
+    lv_refr_now(NULL);
+
+    /*The bytes of the rendered layers are accounted in the cache*/
+    TEST_ASSERT_EQUAL_UINT32(2, lv_ll_get_len(layer_cache_ll));
+    uint32_t used = LV_GLOBAL_DEFAULT()->layer_cache_used;
+    TEST_ASSERT_EQUAL_UINT32(cont->spec_attr->layer_cache->draw_buf->data_size +
+                             cont_2->spec_attr->layer_cache->draw_buf->data_size, used);
+
+    lv_obj_delete(cont);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_ll_get_len(layer_cache_ll));
+    TEST_ASSERT_EQUAL_UINT32(cont_2->spec_attr->layer_cache->draw_buf->data_size, LV_GLOBAL_DEFAULT()->layer_cache_used);
+
+    lv_obj_delete(cont_2);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_ll_get_len(layer_cache_ll));
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->layer_cache_used);
+}
+
+#endif
@@ -0,0 +1,159 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define ITEM_CNT    20
+
+static lv_obj_t * active_screen;
+static uint32_t layout_cnt[2];
+
+static void layout_changed_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+/*A content sized flex column in a content sized wrapper*/
+static lv_obj_t * column_create(int32_t x, uint32_t * cnt)
+{
+    lv_obj_t * wrapper = lv_obj_create(active_screen);
+    lv_obj_set_size(wrapper, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_pos(wrapper, x, 0);
+
+    lv_obj_t * col = lv_obj_create(wrapper);
+    lv_obj_set_size(col, 200, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(col, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_event_cb(col, layout_changed_cb, LV_EVENT_LAYOUT_CHANGED, cnt);
+
+    uint32_t i;
+    for(i = 0; i < ITEM_CNT; i++) {
+        lv_obj_t * label = lv_label_create(col);
+        lv_label_set_text_fmt(label, "Item %" LV_PRIu32, i);
+    }
+
+    return col;
+}
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+    layout_cnt[0] = 0;
+    layout_cnt[1] = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+void test_layout_dirty_leaf_change(void)
+{
+    lv_obj_t * col1 = column_create(0, &layout_cnt[0]);
+    lv_obj_t * col2 = column_create(300, &layout_cnt[1]);
+    lv_obj_update_layout(active_screen);
+
+    int32_t col1_h = lv_obj_get_height(col1);
+    int32_t wrapper_h = lv_obj_get_height(lv_obj_get_parent(col1));
+    lv_obj_t * label = lv_obj_get_child(col1, 5);
+    lv_obj_t * next = lv_obj_get_child(col1, 6);
+    int32_t label_h = lv_obj_get_height(label);
+    int32_t next_y = lv_obj_get_y(next);
+    layout_cnt[0] = 0;
+    layout_cnt[1] = 0;
+
+    /*A taller leaf moves its siblings and grows the content sized ancestors*/
+    lv_label_set_text(label, "Line 1\nLine 2");
+    lv_obj_update_layout(active_screen);
+
+    int32_t diff = lv_obj_get_height(label) - label_h;
+    TEST_ASSERT_GREATER_THAN(0, diff);
+    TEST_ASSERT_EQUAL_INT32(next_y + diff, lv_obj_get_y(next));
+    TEST_ASSERT_EQUAL_INT32(col1_h + diff, lv_obj_get_height(col1));
+    TEST_ASSERT_EQUAL_INT32(wrapper_h + diff, lv_obj_get_height(lv_obj_get_parent(col1)));
+
+    TEST_ASSERT_GREATER_THAN(0, layout_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, layout_cnt[1]);
+
+    /*No path is left marked for the next update*/
+    TEST_ASSERT_FALSE(active_screen->layout_path_inv);
+    TEST_ASSERT_FALSE(col1->layout_path_inv);
+    TEST_ASSERT_FALSE(label->layout_path_inv);
+
+    /*Nothing is left to do*/
+    layout_cnt[0] = 0;
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_EQUAL_UINT32(0, layout_cnt[0]);
+    TEST_ASSERT_EQUAL_INT32(col1_h, lv_obj_get_height(col2));
+}
+
+void test_layout_dirty_set_parent(void)
+{
+    lv_obj_t * col1 = column_create(0, &layout_cnt[0]);
+    lv_obj_t * col2 = column_create(300, &layout_cnt[1]);
+    lv_obj_update_layout(active_screen);
+
+    int32_t col2_h = lv_obj_get_height(col2);
+    lv_obj_t * label = lv_obj_get_child(col1, 0);
+    int32_t label_h = lv_obj_get_height(label);
+
+    /*Mark the label while it's still in the first column then move it*/
+    lv_label_set_text(label, "Moved");
+    lv_obj_set_parent(label, col2);
+    lv_obj_update_layout(active_screen);
+
+    lv_obj_t * last = lv_obj_get_child(col2, ITEM_CNT - 1);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_y(last) + lv_obj_get_height(last) + lv_obj_get_style_pad_row(col2, 0),
+                            lv_obj_get_y(label));
+    TEST_ASSERT_EQUAL_INT32(col2_h + label_h + lv_obj_get_style_pad_row(col2, 0), lv_obj_get_height(col2));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_y(lv_obj_get_child(col1, 0)));
+}
+
+void test_layout_dirty_scroll_readjust(void)
+{
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 200, 100);
+    lv_obj_t * child = lv_obj_create(cont);
+    lv_obj_set_size(child, 50, 400);
+    lv_obj_update_layout(active_screen);
+
+    lv_obj_scroll_to_y(cont, 1000, LV_ANIM_OFF);
+    TEST_ASSERT_GREATER_THAN(0, lv_obj_get_scroll_y(cont));
+
+    /*The container grows so the scroll position is corrected on the next layout update*/
+    lv_obj_set_height(cont, 500);
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_y(cont));
+}
+
+void test_layout_dirty_scroll_readjust_by_parent_layout(void)
+{
+    lv_obj_t * col = lv_obj_create(active_screen);
+    lv_obj_set_size(col, 200, 300);
+    lv_obj_set_flex_flow(col, LV_FLEX_FLOW_COLUMN);
+
+    lv_obj_t * spacer = lv_obj_create(col);
+    lv_obj_set_size(spacer, 100, 150);
+
+    /*A label has no children, so nothing else marks its path when it's resized*/
+    lv_obj_t * label = lv_label_create(col);
+    lv_obj_set_width(label, 150);
+    lv_obj_set_flex_grow(label, 1);
+    lv_label_set_text(label, "1\n2\n3\n4\n5\n6\n7\n8\n9\n10\n11\n12\n13\n14\n15\n16\n17\n18\n19\n20");
+    lv_obj_update_layout(active_screen);
+
+    lv_obj_scroll_to_y(label, 1000, LV_ANIM_OFF);
+    int32_t scroll_y = lv_obj_get_scroll_y(label);
+    TEST_ASSERT_GREATER_THAN(0, scroll_y);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_bottom(label));
+
+    /*The flex layout of the parent makes the label taller and the scroll position is corrected*/
+    lv_obj_set_height(spacer, 20);
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_LESS_THAN(scroll_y, lv_obj_get_scroll_y(label));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_bottom(label));
+    TEST_ASSERT_FALSE(label->readjust_scroll_after_layout);
+}
+
+#endif
@@ -0,0 +1,114 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+#include <sched.h>
+#endif
+
+typedef struct {
+    uint32_t producer;
+    uint32_t seq;
+} item_t;
+
+static lv_mpsc_queue_t queue;
+
+void setUp(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mpsc_queue_init(&queue, sizeof(item_t), 5));
+}
+
+void tearDown(void)
+{
+    lv_mpsc_queue_deinit(&queue);
+}
+
+void test_mpsc_queue_fifo(void)
+{
+    /*Rounded up to a power of 2*/
+    TEST_ASSERT_EQUAL_UINT32(8, lv_mpsc_queue_get_capacity(&queue));
+
+    item_t item;
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_mpsc_queue_pop(&queue, &item));
+
+    /*Go around a few times*/
+    uint32_t round;
+    uint32_t i;
+    for(round = 0; round < 3; round++) {
+        for(i = 0; i < 8; i++) {
+            item.producer = round;
+            item.seq = i;
+            TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mpsc_queue_push(&queue, &item));
+        }
+        TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_mpsc_queue_push(&queue, &item));
+        TEST_ASSERT_EQUAL_UINT32(8, lv_mpsc_queue_get_count(&queue));
+
+        item_t * peeked = lv_mpsc_queue_peek(&queue, 7);
+        TEST_ASSERT_NOT_NULL(peeked);
+        TEST_ASSERT_EQUAL_UINT32(7, peeked->seq);
+        TEST_ASSERT_NULL(lv_mpsc_queue_peek(&queue, 8));
+
+        for(i = 0; i < 8; i++) {
+            TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mpsc_queue_pop(&queue, &item));
+            TEST_ASSERT_EQUAL_UINT32(round, item.producer);
+            TEST_ASSERT_EQUAL_UINT32(i, item.seq);
+        }
+        TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_mpsc_queue_pop(&queue, &item));
+        TEST_ASSERT_NULL(lv_mpsc_queue_peek(&queue, 0));
+        TEST_ASSERT_EQUAL_UINT32(0, lv_mpsc_queue_get_count(&queue));
+    }
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+
+#define PRODUCER_CNT    3
+#define ITEM_CNT        2000
+
+static void producer_cb(void * user_data)
+{
+    item_t item;
+    item.producer = (uint32_t)(uintptr_t)user_data;
+    for(item.seq = 0; item.seq < ITEM_CNT; item.seq++) {
+        while(lv_mpsc_queue_push(&queue, &item) != LV_RESULT_OK) {
+            sched_yield();
+        }
+    }
+}
+
+void test_mpsc_queue_threads(void)
+{
+    lv_thread_t threads[PRODUCER_CNT];
+    uint32_t next_seq[PRODUCER_CNT] = {0};
+    uint32_t i;
+    for(i = 0; i < PRODUCER_CNT; i++) {
+        lv_thread_init(&threads[i], LV_THREAD_PRIO_MID, producer_cb, 16 * 1024, (void *)(uintptr_t)i);
+    }
+
+    /*Every item arrives once and in order for each producer*/
+    uint32_t received = 0;
+    while(received < PRODUCER_CNT * ITEM_CNT) {
+        item_t item;
+        if(lv_mpsc_queue_pop(&queue, &item) != LV_RESULT_OK) {
+            sched_yield();
+            continue;
+        }
+
+        TEST_ASSERT_LESS_THAN_UINT32(PRODUCER_CNT, item.producer);
+        TEST_ASSERT_EQUAL_UINT32(next_seq[item.producer], item.seq);
+        next_seq[item.producer]++;
+        received++;
+    }
+
+    for(i = 0; i < PRODUCER_CNT; i++) {
+        lv_thread_delete(&threads[i]);
+    }
+
+    item_t item;
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_mpsc_queue_pop(&queue, &item));
+}
+
+#endif
+
+#endif
@@ -0,0 +1,189 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * active_screen;
+static uint32_t changed_cnt;
+static uint32_t created_cnt;
+static uint32_t deleted_cnt;
+
+static void child_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if(code == LV_EVENT_CHILD_CHANGED) changed_cnt++;
+    else if(code == LV_EVENT_CHILD_CREATED) created_cnt++;
+    else if(code == LV_EVENT_CHILD_DELETED) deleted_cnt++;
+}
+
+static uint32_t delete_order[8];
+static uint32_t delete_order_cnt;
+
+static void delete_order_event_cb(lv_event_t * e)
+{
+    delete_order[delete_order_cnt++] = (uint32_t)(uintptr_t)lv_event_get_user_data(e);
+}
+
+static lv_obj_t * cont_create(void)
+{
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 300, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_event_cb(cont, child_event_cb, LV_EVENT_ALL, NULL);
+    return cont;
+}
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+    changed_cnt = 0;
+    created_cnt = 0;
+    deleted_cnt = 0;
+    delete_order_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+void test_obj_children_capacity(void)
+{
+    lv_obj_t * cont = cont_create();
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_obj_create(cont);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(i + 1, cont->spec_attr->child_capacity);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * (i + 1), cont->spec_attr->child_capacity);
+    }
+    TEST_ASSERT_EQUAL_UINT32(100, created_cnt);
+
+    /*Shrinks when mostly empty*/
+    for(i = 0; i < 90; i++) {
+        lv_obj_delete(lv_obj_get_child(cont, 0));
+    }
+    TEST_ASSERT_EQUAL_UINT32(10, lv_obj_get_child_count(cont));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(40, cont->spec_attr->child_capacity);
+
+    lv_obj_clean(cont);
+    TEST_ASSERT_NULL(cont->spec_attr->children);
+    TEST_ASSERT_EQUAL_UINT32(0, cont->spec_attr->child_capacity);
+}
+
+void test_obj_children_batch_create(void)
+{
+    lv_obj_t * cont = cont_create();
+
+    /*Reference created one by one*/
+    lv_obj_t * ref = cont_create();
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        lv_obj_t * label = lv_label_create(ref);
+        lv_label_set_text_fmt(label, "Row %" LV_PRIu32, i);
+    }
+    changed_cnt = 0;
+    created_cnt = 0;
+
+    lv_obj_children_batch_begin(cont, 50);
+    TEST_ASSERT_EQUAL_UINT32(50, cont->spec_attr->child_capacity);
+    for(i = 0; i < 50; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_label_set_text_fmt(label, "Row %" LV_PRIu32, i);
+        lv_obj_set_style_text_color(label, lv_color_hex(0xff0000), 0);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, changed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, created_cnt);
+    lv_obj_children_batch_end(cont);
+
+    TEST_ASSERT_EQUAL_UINT32(1, changed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, created_cnt);
+    TEST_ASSERT_EQUAL_UINT32(50, lv_obj_get_child_count(cont));
+    TEST_ASSERT_FALSE(lv_obj_is_in_children_batch(cont));
+
+    /*The result is the same as without the batch*/
+    lv_obj_update_layout(active_screen);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_height(ref), lv_obj_get_height(cont));
+    for(i = 0; i < 50; i++) {
+        lv_obj_t * child = lv_obj_get_child(cont, i);
+        lv_obj_t * ref_child = lv_obj_get_child(ref, i);
+        TEST_ASSERT_FALSE(child->batch_new);
+        TEST_ASSERT_EQUAL_INT32(lv_obj_get_y(ref_child), lv_obj_get_y(child));
+        TEST_ASSERT_EQUAL_INT32(lv_obj_get_width(ref_child), lv_obj_get_width(child));
+    }
+}
+
+void test_obj_children_batch_delete(void)
+{
+    lv_obj_t * cont = cont_create();
+    uint32_t i;
+    for(i = 0; i < 64; i++) {
+        lv_obj_create(cont);
+    }
+    changed_cnt = 0;
+
+    lv_obj_children_batch_begin(cont, 0);
+    for(i = 0; i < 60; i++) {
+        lv_obj_delete(lv_obj_get_child(cont, -1));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, changed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, deleted_cnt);
+    TEST_ASSERT_EQUAL_UINT32(64, cont->spec_attr->child_capacity);
+    lv_obj_children_batch_end(cont);
+
+    TEST_ASSERT_EQUAL_UINT32(1, changed_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, deleted_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, lv_obj_get_child_count(cont));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(16, cont->spec_attr->child_capacity);
+}
+
+void test_obj_children_batch_set_parent(void)
+{
+    lv_obj_t * cont = cont_create();
+    lv_obj_t * cont2 = cont_create();
+
+    lv_obj_children_batch_begin(cont, 2);
+    lv_obj_t * obj1 = lv_obj_create(cont);
+    lv_obj_t * obj2 = lv_obj_create(cont);
+    TEST_ASSERT_TRUE(obj1->batch_new);
+
+    /*Leaving the batch refreshes the child right away*/
+    lv_obj_set_parent(obj2, cont2);
+    TEST_ASSERT_FALSE(obj2->batch_new);
+    lv_obj_children_batch_end(cont);
+    TEST_ASSERT_FALSE(obj1->batch_new);
+
+    TEST_ASSERT_EQUAL_PTR(obj1, lv_obj_get_child(cont, 0));
+    TEST_ASSERT_EQUAL_PTR(obj2, lv_obj_get_child(cont2, 0));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_obj_get_child_count(cont));
+}
+
+static void delete_order_children_create(lv_obj_t * cont)
+{
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * child = lv_obj_create(cont);
+        lv_obj_add_event_cb(child, delete_order_event_cb, LV_EVENT_DELETE, (void *)(uintptr_t)i);
+    }
+}
+
+void test_obj_children_delete_order(void)
+{
+    uint32_t i;
+
+    /*`LV_EVENT_DELETE` is sent to the children in the order of creation*/
+    lv_obj_t * cont = cont_create();
+    delete_order_children_create(cont);
+    lv_obj_clean(cont);
+    TEST_ASSERT_EQUAL_UINT32(4, delete_order_cnt);
+    for(i = 0; i < 4; i++) TEST_ASSERT_EQUAL_UINT32(i, delete_order[i]);
+
+    delete_order_cnt = 0;
+    delete_order_children_create(cont);
+    lv_obj_delete(cont);
+    TEST_ASSERT_EQUAL_UINT32(4, delete_order_cnt);
+    for(i = 0; i < 4; i++) TEST_ASSERT_EQUAL_UINT32(i, delete_order[i]);
+}
+
+#endif
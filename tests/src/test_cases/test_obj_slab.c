@@ -0,0 +1,120 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_OBJ_SLAB_ITEM_CNT
+
+static lv_obj_t * active_screen;
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+}
+
+void tearDown(void)
+{
+    lv_obj_class_reserve(&lv_button_class, 0);
+    lv_obj_clean(active_screen);
+}
+
+void test_obj_slab_usage(void)
+{
+    lv_slab_monitor_t mon;
+    lv_obj_class_slab_monitor(&lv_button_class, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.chunk_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(sizeof(lv_button_t), mon.item_size);
+
+    lv_obj_t * cont = lv_obj_create(active_screen);
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_SLAB_ITEM_CNT * 3; i++) {
+        lv_obj_t * btn = lv_button_create(cont);
+        lv_obj_add_flag(btn, LV_OBJ_FLAG_CHECKABLE);
+    }
+
+    lv_obj_class_slab_monitor(&lv_button_class, &mon);
+    TEST_ASSERT_EQUAL_UINT32(LV_OBJ_SLAB_ITEM_CNT * 3, mon.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, mon.chunk_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_OBJ_SLAB_ITEM_CNT * 3, mon.max_used_cnt);
+
+    /*Every button has spec_attr for its event list*/
+    lv_slab_monitor_t spec_mon;
+    lv_obj_class_slab_monitor(NULL, &spec_mon);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(LV_OBJ_SLAB_ITEM_CNT * 3, spec_mon.used_cnt);
+
+    /*The emptied chunks are given back to the heap except the last one*/
+    lv_obj_delete(cont);
+    lv_obj_class_slab_monitor(&lv_button_class, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, mon.chunk_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_OBJ_SLAB_ITEM_CNT * 3, mon.max_used_cnt);
+
+    lv_obj_class_slab_reclaim();
+    lv_obj_class_slab_monitor(&lv_button_class, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.chunk_cnt);
+}
+
+void test_obj_slab_reserve(void)
+{
+    lv_obj_class_reserve(&lv_button_class, LV_OBJ_SLAB_ITEM_CNT * 2);
+
+    lv_slab_monitor_t mon;
+    lv_obj_class_slab_monitor(&lv_button_class, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_OBJ_SLAB_ITEM_CNT * 2, mon.total_cnt);
+
+    /*The reserved chunks are kept after deleting the widgets*/
+    uint32_t i;
+    for(i = 0; i < LV_OBJ_SLAB_ITEM_CNT * 3; i++) {
+        lv_button_create(active_screen);
+    }
+    lv_obj_clean(active_screen);
+    lv_obj_class_slab_monitor(&lv_button_class, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.used_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_OBJ_SLAB_ITEM_CNT * 2, mon.total_cnt);
+
+    lv_obj_class_reserve(&lv_button_class, 0);
+    lv_obj_class_slab_monitor(&lv_button_class, &mon);
+    TEST_ASSERT_EQUAL_UINT32(0, mon.chunk_cnt);
+}
+
+void test_obj_slab_reuse(void)
+{
+    /*A deleted widget's memory is reused by the next one*/
+    lv_obj_t * btn1 = lv_button_create(active_screen);
+    lv_obj_t * btn2 = lv_button_create(active_screen);
+    lv_obj_delete(btn1);
+    lv_obj_t * btn3 = lv_button_create(active_screen);
+    TEST_ASSERT_EQUAL_PTR(btn1, btn3);
+    TEST_ASSERT_EQUAL_PTR(active_screen, lv_obj_get_parent(btn3));
+    TEST_ASSERT_EQUAL_UINT32(2, lv_obj_get_child_count(active_screen));
+    TEST_ASSERT_EQUAL_PTR(btn2, lv_obj_get_child(active_screen, 0));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_obj_slab_usage(void)
+{
+}
+
+void test_obj_slab_reserve(void)
+{
+}
+
+void test_obj_slab_reuse(void)
+{
+}
+
+#endif
+
+#endif
@@ -527,4 +527,176 @@ void test_observer_deinit(void)
     TEST_ASSERT_MEM_LEAK_LESS_THAN(mem, 32);
 }
 
+static uint32_t observer_cnt;
+
+static void observer_int_cnt(lv_observer_t * observer, lv_subject_t * subject)
+{
+    observer_int(observer, subject);
+    observer_cnt++;
+}
+
+void test_observer_deferred(void)
+{
+    static lv_subject_t subject;
+    lv_subject_init_int(&subject, 0);
+    lv_subject_set_deferred(&subject, true);
+
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_bind_text(label, &subject, "%d");
+    observer_cnt = 0;
+    lv_subject_add_observer(&subject, observer_int_cnt, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, observer_cnt);
+
+    /*Only the last value is delivered in the next refresh cycle*/
+    uint32_t i;
+    for(i = 1; i <= 100; i++) {
+        lv_subject_set_int(&subject, i);
+    }
+    TEST_ASSERT_EQUAL(100, lv_subject_get_int(&subject));
+    TEST_ASSERT_EQUAL_STRING("0", lv_label_get_text(label));
+    TEST_ASSERT_EQUAL_UINT32(1, observer_cnt);
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_STRING("100", lv_label_get_text(label));
+    TEST_ASSERT_EQUAL_UINT32(2, observer_cnt);
+    TEST_ASSERT_EQUAL(0, prev_v);
+    TEST_ASSERT_EQUAL(100, current_v);
+    TEST_ASSERT_EQUAL_UINT32(100, lv_subject_get_change_count(&subject));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_subject_get_notify_count(&subject));
+
+    /*Nothing to notify if unchanged*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, observer_cnt);
+
+    /*Disabling the deferred mode delivers the pending change*/
+    lv_subject_set_int(&subject, 101);
+    lv_subject_set_deferred(&subject, false);
+    TEST_ASSERT_EQUAL_STRING("101", lv_label_get_text(label));
+    TEST_ASSERT_EQUAL_UINT32(3, observer_cnt);
+    lv_subject_set_int(&subject, 102);
+    TEST_ASSERT_EQUAL_STRING("102", lv_label_get_text(label));
+
+    lv_subject_deinit(&subject);
+}
+
+void test_observer_deferred_immediate(void)
+{
+    static lv_subject_t subject;
+    lv_subject_init_int(&subject, 0);
+    lv_subject_set_deferred(&subject, true);
+
+    lv_obj_t * slider = lv_slider_create(lv_screen_active());
+    lv_slider_bind_value(slider, &subject);
+    observer_cnt = 0;
+    lv_observer_t * observer = lv_subject_add_observer(&subject, observer_int_cnt, NULL);
+    lv_observer_set_immediate(observer, true);
+
+    lv_subject_set_int(&subject, 10);
+    lv_subject_set_int(&subject, 20);
+    TEST_ASSERT_EQUAL_UINT32(3, observer_cnt);
+    TEST_ASSERT_EQUAL(20, current_v);
+    TEST_ASSERT_EQUAL(0, lv_slider_get_value(slider));
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, observer_cnt);
+    TEST_ASSERT_EQUAL(20, lv_slider_get_value(slider));
+
+    /*A deinitialized subject is not notified anymore*/
+    lv_subject_set_int(&subject, 30);
+    lv_subject_deinit(&subject);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(20, lv_slider_get_value(slider));
+}
+
+void test_observer_deferred_group(void)
+{
+    static lv_subject_t subject_1;
+    static lv_subject_t subject_2;
+    static lv_subject_t subject_all;
+    static lv_subject_t * subject_list[2] = {&subject_1, &subject_2};
+    lv_subject_init_int(&subject_1, 1);
+    lv_subject_init_int(&subject_2, 2);
+    lv_subject_set_deferred(&subject_1, true);
+    lv_subject_set_deferred(&subject_2, true);
+    lv_subject_init_group(&subject_all, subject_list, 2);
+
+    observer_cnt = 0;
+    lv_subject_add_observer(&subject_all, observer_int_cnt, NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, observer_cnt);
+
+    lv_subject_set_int(&subject_1, 10);
+    lv_subject_set_int(&subject_2, 20);
+    lv_subject_set_int(&subject_1, 30);
+    TEST_ASSERT_EQUAL_UINT32(1, observer_cnt);
+
+    /*The group itself is not deferred, so it's notified once for each dirty element*/
+    lv_subject_notify_deferred();
+    TEST_ASSERT_EQUAL_UINT32(3, observer_cnt);
+
+    lv_subject_deinit(&subject_all);
+    lv_subject_deinit(&subject_1);
+    lv_subject_deinit(&subject_2);
+}
+
+
+#if LV_OBSERVER_POST_QUEUE_SIZE
+void test_observer_post(void)
+{
+    static lv_subject_t subject_int;
+    static lv_subject_t subject_color;
+    lv_subject_init_int(&subject_int, 0);
+    lv_subject_init_color(&subject_color, lv_color_black());
+    observer_cnt = 0;
+    lv_subject_add_observer(&subject_int, observer_int_cnt, NULL);
+    observer_cnt = 0;
+
+    /*Applied in the next timer handler, only the last value of each subject*/
+    int32_t i;
+    for(i = 1; i <= 10; i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_post_int(&subject_int, i));
+    }
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_post_color(&subject_color, lv_color_hex(0xff0000)));
+    TEST_ASSERT_EQUAL(0, lv_subject_get_int(&subject_int));
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(10, lv_subject_get_int(&subject_int));
+    TEST_ASSERT_EQUAL_UINT32(1, observer_cnt);
+    TEST_ASSERT_EQUAL(0, prev_v);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_subject_get_color(&subject_color));
+
+    /*The posts are rejected if the queue is full*/
+    for(i = 0; i < LV_OBSERVER_POST_QUEUE_SIZE; i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_post_int(&subject_int, 100 + i));
+    }
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_subject_post_int(&subject_int, 1000));
+
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(100 + LV_OBSERVER_POST_QUEUE_SIZE - 1, lv_subject_get_int(&subject_int));
+    TEST_ASSERT_EQUAL_UINT32(2, observer_cnt);
+
+    lv_subject_deinit(&subject_int);
+    lv_subject_deinit(&subject_color);
+}
+
+void test_observer_post_deinit(void)
+{
+    static lv_subject_t subject_2;
+    lv_subject_t * subject_1 = lv_malloc(sizeof(lv_subject_t));
+    lv_subject_init_int(subject_1, 0);
+    lv_subject_init_int(&subject_2, 0);
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_post_int(subject_1, 1));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_post_int(&subject_2, 2));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_subject_post_int(subject_1, 3));
+
+    /*The pending posts of a deinitialized subject are dropped, the others are still applied*/
+    lv_subject_deinit(subject_1);
+    lv_free(subject_1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(2, lv_subject_get_int(&subject_2));
+
+    lv_subject_deinit(&subject_2);
+}
+#endif
+
 #endif
@@ -0,0 +1,155 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * active_screen;
+static lv_obj_t * cont;
+
+/*Compare the scroll values from the incrementally updated cache with the freshly measured ones*/
+static void check_scroll(lv_obj_t * obj)
+{
+    lv_obj_update_layout(obj);
+    int32_t bottom = lv_obj_get_scroll_bottom(obj);
+    int32_t right = lv_obj_get_scroll_right(obj);
+    int32_t left = lv_obj_get_scroll_left(obj);
+
+    lv_obj_scroll_invalidate_child_ext(obj);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_scroll_bottom(obj), bottom);
+    lv_obj_scroll_invalidate_child_ext(obj);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_scroll_right(obj), right);
+    lv_obj_scroll_invalidate_child_ext(obj);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_scroll_left(obj), left);
+}
+
+static lv_obj_t * child_create(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    lv_obj_t * obj = lv_obj_create(cont);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, w, h);
+    return obj;
+}
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+    cont = lv_obj_create(active_screen);
+    lv_obj_set_size(cont, 200, 150);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+void test_scroll_child_ext_move_and_resize(void)
+{
+    lv_obj_t * c1 = child_create(0, 0, 50, 50);
+    lv_obj_t * c2 = child_create(100, 300, 50, 50);
+    child_create(250, 20, 50, 50);
+    check_scroll(cont);
+
+    /*Grow outward, then shrink the edge child inward*/
+    lv_obj_set_pos(c1, 10, 400);
+    check_scroll(cont);
+    lv_obj_set_pos(c1, 10, 10);
+    check_scroll(cont);
+    lv_obj_set_size(c2, 50, 10);
+    check_scroll(cont);
+    lv_obj_set_size(c2, 400, 10);
+    check_scroll(cont);
+}
+
+void test_scroll_child_ext_flags(void)
+{
+    lv_obj_t * c1 = child_create(0, 0, 50, 50);
+    lv_obj_t * c2 = child_create(100, 300, 50, 50);
+    check_scroll(cont);
+
+    lv_obj_add_flag(c2, LV_OBJ_FLAG_HIDDEN);
+    check_scroll(cont);
+    lv_obj_remove_flag(c2, LV_OBJ_FLAG_HIDDEN);
+    check_scroll(cont);
+
+    lv_obj_add_flag(c2, LV_OBJ_FLAG_FLOATING);
+    check_scroll(cont);
+    lv_obj_set_pos(c2, 500, 500);
+    check_scroll(cont);
+    lv_obj_remove_flag(c2, LV_OBJ_FLAG_FLOATING);
+    check_scroll(cont);
+
+    lv_obj_set_style_margin_bottom(c1, 600, 0);
+    check_scroll(cont);
+    lv_obj_set_style_margin_bottom(c1, 0, 0);
+    check_scroll(cont);
+}
+
+void test_scroll_child_ext_tree(void)
+{
+    lv_obj_t * c1 = child_create(0, 0, 50, 50);
+    lv_obj_t * c2 = child_create(300, 300, 50, 50);
+    check_scroll(cont);
+
+    child_create(400, 20, 50, 50);
+    check_scroll(cont);
+
+    lv_obj_delete(c2);
+    check_scroll(cont);
+
+    lv_obj_t * cont2 = lv_obj_create(active_screen);
+    lv_obj_set_size(cont2, 100, 100);
+    lv_obj_set_parent(c1, cont2);
+    lv_obj_set_pos(c1, 200, 200);
+    check_scroll(cont);
+    check_scroll(cont2);
+
+    lv_obj_clean(cont);
+    check_scroll(cont);
+}
+
+void test_scroll_child_ext_scroll_and_move(void)
+{
+    child_create(0, 0, 50, 50);
+    child_create(300, 400, 50, 50);
+    check_scroll(cont);
+
+    lv_obj_scroll_to(cont, 50, 100, LV_ANIM_OFF);
+    check_scroll(cont);
+
+    /*Moving or resizing the parent moves its children too*/
+    lv_obj_set_pos(cont, 30, 40);
+    check_scroll(cont);
+    lv_obj_set_size(cont, 100, 100);
+    check_scroll(cont);
+}
+
+void test_scroll_child_ext_flex(void)
+{
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        child_create(0, 0, 100 + i * 10, 40);
+    }
+    check_scroll(cont);
+
+    lv_obj_set_height(lv_obj_get_child(cont, 0), 200);
+    check_scroll(cont);
+    lv_obj_delete(lv_obj_get_child(cont, 9));
+    check_scroll(cont);
+}
+
+void test_scroll_child_ext_rtl(void)
+{
+    lv_obj_set_style_base_dir(cont, LV_BASE_DIR_RTL, 0);
+    lv_obj_t * c1 = child_create(0, 0, 50, 50);
+    child_create(-300, 30, 50, 50);
+    check_scroll(cont);
+
+    lv_obj_set_pos(c1, -500, 0);
+    check_scroll(cont);
+    lv_obj_set_width(cont, 300);
+    check_scroll(cont);
+}
+
+#endif
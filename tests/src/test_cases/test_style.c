@@ -141,4 +141,140 @@ void test_style_has_prop(void)
     lv_style_reset(&style);
 }
 
+#if LV_OBJ_STYLE_USER_INDEX
+
+static uint32_t style_changed_cnt;
+
+static void style_changed_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    style_changed_cnt++;
+}
+
+static bool style_is_indexed(const lv_style_t * style)
+{
+    /*The key is compared by the style pointer at its start*/
+    const lv_style_t * key = style;
+    return lv_rb_find(&LV_GLOBAL_DEFAULT()->style_user_index, &key) != NULL;
+}
+
+void test_style_report_change_users(void)
+{
+    /*The other tests leave objects behind with styles from the stack*/
+    lv_obj_clean(lv_screen_active());
+
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0xff0000));
+
+    lv_obj_t * obj1 = lv_obj_create(lv_screen_active());
+    lv_obj_t * obj2 = lv_obj_create(lv_screen_active());
+    lv_obj_t * obj3 = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj1, &style, LV_PART_MAIN);
+    lv_obj_add_style(obj2, &style, LV_PART_MAIN);
+    lv_obj_add_style(obj2, &style, LV_PART_SCROLLBAR);
+    lv_obj_add_event_cb(obj1, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_add_event_cb(obj2, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_add_event_cb(obj3, style_changed_cb, LV_EVENT_STYLE_CHANGED, NULL);
+    lv_obj_set_width(obj1, 100);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(style_is_indexed(&style));
+
+    /*A color change only invalidates the users of the style*/
+    style_changed_cnt = 0;
+    lv_style_set_bg_color(&style, lv_color_hex(0x00ff00));
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_UINT32(0, style_changed_cnt);
+    TEST_ASSERT_FALSE(obj1->layout_inv);
+    TEST_ASSERT_GREATER_THAN(0, lv_display_get_default()->inv_p);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj2, LV_PART_MAIN));
+    lv_refr_now(NULL);
+
+    /*A size change updates the layout of the users but not of the others*/
+    lv_style_set_width(&style, 50);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_UINT32(2, style_changed_cnt);
+    TEST_ASSERT_TRUE(obj1->layout_inv);
+    TEST_ASSERT_FALSE(obj3->layout_inv);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_INT32(100, lv_obj_get_width(obj1));
+    TEST_ASSERT_EQUAL_INT32(50, lv_obj_get_width(obj2));
+
+    /*A removed size property updates the layout too*/
+    style_changed_cnt = 0;
+    lv_style_remove_prop(&style, LV_STYLE_WIDTH);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_UINT32(2, style_changed_cnt);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_EQUAL(50, lv_obj_get_width(obj2));
+
+    /*Still used by obj2 with the other selector*/
+    lv_obj_remove_style(obj2, &style, LV_PART_MAIN);
+    lv_obj_delete(obj1);
+    TEST_ASSERT_TRUE(style_is_indexed(&style));
+
+    lv_obj_replace_style(obj2, &style, &const_style, LV_PART_SCROLLBAR);
+    TEST_ASSERT_FALSE(style_is_indexed(&style));
+
+    lv_obj_clean(lv_screen_active());
+    lv_style_reset(&style);
+}
+
+static lv_style_t remover_style;
+
+static void style_remover_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+
+    /*Remove the style from an other user while the users are being reported*/
+    lv_obj_t * first = lv_obj_get_child(lv_screen_active(), 0);
+    if(lv_obj_get_child(lv_screen_active(), -1) == lv_event_get_target(e)) {
+        lv_obj_remove_style(first, &remover_style, LV_PART_MAIN);
+    }
+}
+
+void test_style_report_change_users_removed_in_event(void)
+{
+    lv_obj_clean(lv_screen_active());
+
+    lv_style_init(&remover_style);
+    lv_style_set_bg_color(&remover_style, lv_color_hex(0xff0000));
+
+    uint32_t cnt[4] = {0};
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_add_style(obj, &remover_style, LV_PART_MAIN);
+        lv_obj_add_event_cb(obj, style_remover_cb, LV_EVENT_STYLE_CHANGED, &cnt[i]);
+    }
+    lv_refr_now(NULL);
+
+    lv_memzero(cnt, sizeof(cnt));
+    lv_style_set_width(&remover_style, 50);
+    lv_obj_report_style_change(&remover_style);
+
+    /*The remaining users are all reported even if the handler removed a user before them*/
+    TEST_ASSERT_EQUAL_UINT32(1, cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, cnt[2]);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, cnt[3]);
+    TEST_ASSERT_EQUAL_INT32(50, lv_obj_get_style_width(lv_obj_get_child(lv_screen_active(), 2), LV_PART_MAIN));
+
+    lv_obj_clean(lv_screen_active());
+    TEST_ASSERT_FALSE(style_is_indexed(&remover_style));
+    lv_style_reset(&remover_style);
+}
+
+#else
+
+void test_style_report_change_users(void)
+{
+}
+
+void test_style_report_change_users_removed_in_event(void)
+{
+}
+
+#endif
+
 #endif
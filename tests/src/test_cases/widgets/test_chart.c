@@ -193,4 +193,130 @@ void test_draw_task_hooking(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_bar_draw_hook.png");
 }
 
+static uint32_t rnd_state;
+
+static int32_t rnd_value(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return (int32_t)((rnd_state >> 16) % 1000) - 200;
+}
+
+static void check_min_max(lv_chart_series_t * ser, uint32_t id, uint32_t cnt)
+{
+    /*Find the expected values point by point in the drawing order*/
+    uint32_t point_cnt = lv_chart_get_point_count(chart);
+    uint32_t start = lv_chart_get_x_start_point(chart, ser);
+    int32_t * y = lv_chart_get_y_array(chart, ser);
+    int32_t min_exp = INT32_MAX;
+    int32_t max_exp = INT32_MIN;
+    uint32_t i;
+    for(i = id; i < id + cnt && i < point_cnt; i++) {
+        int32_t v = y[(start + i) % point_cnt];
+        if(v == LV_CHART_POINT_NONE) continue;
+        min_exp = LV_MIN(min_exp, v);
+        max_exp = LV_MAX(max_exp, v);
+    }
+
+    int32_t min;
+    int32_t max;
+    bool has_value = lv_chart_get_min_max_value(chart, ser, id, cnt, &min, &max);
+    TEST_ASSERT_EQUAL(min_exp <= max_exp, has_value);
+    if(has_value) {
+        TEST_ASSERT_EQUAL_INT32(min_exp, min);
+        TEST_ASSERT_EQUAL_INT32(max_exp, max);
+    }
+}
+
+void test_chart_minmax_decimation_values(void)
+{
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_point_count(chart, 1000);
+    lv_chart_set_minmax_decimation(chart, true);
+    TEST_ASSERT_TRUE(lv_chart_get_minmax_decimation(chart));
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+
+    /*Nothing is set yet*/
+    int32_t min;
+    int32_t max;
+    TEST_ASSERT_FALSE(lv_chart_get_min_max_value(chart, ser, 0, 1000, &min, &max));
+
+    /*Wrap around the ring buffer a few times while the summary is updated point by point*/
+    rnd_state = 1;
+    uint32_t i;
+    for(i = 0; i < 2500; i++) {
+        lv_chart_set_next_value(chart, ser, i % 97 == 0 ? LV_CHART_POINT_NONE : rnd_value());
+    }
+
+    for(i = 0; i < 200; i++) {
+        uint32_t id = (uint32_t)rnd_value() % 1000;
+        uint32_t cnt = (uint32_t)rnd_value() % 1000;
+        check_min_max(ser, id, cnt);
+    }
+    check_min_max(ser, 0, 1000);
+    check_min_max(ser, 999, 1);
+    check_min_max(ser, 3, 5);
+
+    /*Modify the array directly*/
+    int32_t * y = lv_chart_get_y_array(chart, ser);
+    y[500] = 10000;
+    y[501] = -10000;
+    lv_chart_refresh(chart);
+    check_min_max(ser, 0, 1000);
+
+    lv_chart_set_value_by_id(chart, ser, 500, 0);
+    lv_chart_set_value_by_id(chart, ser, 501, 0);
+    check_min_max(ser, 0, 1000);
+
+    /*Works the same without the summary*/
+    lv_chart_set_minmax_decimation(chart, false);
+    check_min_max(ser, 0, 1000);
+    check_min_max(ser, 123, 456);
+}
+
+void test_chart_minmax_decimation_render(void)
+{
+    lv_obj_set_size(chart, 600, 400);
+    lv_obj_center(chart);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_chart_set_point_count(chart, 100000);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, -300, 900);
+
+    rnd_state = 1;
+    uint32_t i;
+    for(i = 0; i < 130000; i++) {
+        int32_t v = (i / 5000) % 3 == 1 ? rnd_value() / 4 + 400 : rnd_value();
+        lv_chart_set_next_value(chart, ser, i % 40000 < 300 ? LV_CHART_POINT_NONE : v);
+    }
+
+    lv_draw_buf_t * ref = lv_snapshot_take(active_screen, LV_COLOR_FORMAT_XRGB8888);
+
+    /*The same result is drawn from the min. max. summary*/
+    lv_chart_set_minmax_decimation(chart, true);
+    lv_draw_buf_t * decimated = lv_snapshot_take(active_screen, LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_EQUAL_MEMORY(ref->data, decimated->data, ref->data_size);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_minmax_decimation.png");
+
+    lv_draw_buf_destroy(ref);
+    lv_draw_buf_destroy(decimated);
+}
+
+void test_chart_no_content_width(void)
+{
+    /*The paddings leave no room for the content*/
+    lv_obj_set_size(chart, 40, 100);
+    lv_obj_set_style_pad_hor(chart, 20, 0);
+    lv_chart_set_point_count(chart, 10);
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_chart_set_next_value(chart, ser, (int32_t)i * 10);
+    }
+
+    /*Shouldn't crash*/
+    lv_refr_now(NULL);
+}
+
 #endif